@@ -0,0 +1,237 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// dlfcn isn't part of strict C11
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+	#define _DEFAULT_SOURCE
+#endif
+
+#include "ti83.h"
+#include "aot.h"
+#include "memory.h"
+#include "crc32.h"
+
+#ifdef EMU83_AOT
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <dlfcn.h>
+#endif
+
+// blocks precompiled for one specific ROM by tools/aot.c, see AOTPlugin_t
+// a plugin is looked up by the ROM's CRC32 in the directory named by EMU83_AOT_DIR when a context is created
+// and from then on its blocks run the same way JIT blocks do: at the start of a block, with no callbacks, and only if it ends before the next event
+// nothing is searched for if EMU83_AOT_DIR isn't set, so plugins are never picked up from the working directory by accident
+
+struct AOT_t {
+	void* Handle;
+	const AOTPlugin_t* Plugin;
+	u32 ROMCRC;
+	bool CheckROM; // ROM was handed out through TI83_GetMemoryArea, and may have been patched
+	const AOTBlock_t* Blocks[0x40000]; // indexed by ROM offset
+};
+
+static const AOTHost_t Host = { ReadMem, WriteMem };
+
+static void* OpenPlugin(const char* path) {
+#if defined(_WIN32)
+	return LoadLibraryA(path);
+#else
+	return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+static void ClosePlugin(void* handle) {
+#if defined(_WIN32)
+	FreeLibrary(handle);
+#else
+	dlclose(handle);
+#endif
+}
+
+static const AOTPlugin_t* FindPlugin(void* handle) {
+#if defined(_WIN32)
+	// GetProcAddress only hands out function pointers, even for data
+	FARPROC sym = GetProcAddress(handle, "TI83_AOTPlugin");
+	const AOTPlugin_t* plugin;
+	memcpy(&plugin, &sym, sizeof (plugin));
+	return plugin;
+#else
+	return dlsym(handle, "TI83_AOTPlugin");
+#endif
+}
+
+void LoadAOT(TI83_t* TI83) {
+	const char* dir = getenv("EMU83_AOT_DIR");
+	if (!dir || !*dir) {
+		return;
+	}
+
+	u32 crc = CRC32(TI83->ROM, sizeof (TI83->ROM));
+	char path[4096];
+	if (snprintf(path, sizeof (path), "%s/emu83aot_%08X" AOT_PLUGIN_SUFFIX, dir, crc) >= (int)sizeof (path)) {
+		return;
+	}
+
+	void* handle = OpenPlugin(path);
+	if (!handle) {
+		return;
+	}
+
+	// the version comes first, as the rest of AOTPlugin_t may be laid out differently in other versions
+	static const u32 contextLayout[AOT_CONTEXT_LAYOUT_SIZE] = AOT_CONTEXT_LAYOUT;
+	const AOTPlugin_t* plugin = FindPlugin(handle);
+	AOT_t* aot = NULL;
+	if (plugin && plugin->Version == AOT_VERSION && plugin->ContextSize == sizeof (TI83_t)
+		&& !memcmp(plugin->ContextLayout, contextLayout, sizeof (contextLayout)) && plugin->ROMCRC == crc) {
+		aot = calloc(1, sizeof (AOT_t));
+	}
+
+	if (!aot) {
+		ClosePlugin(handle);
+		return;
+	}
+
+	aot->Handle = handle;
+	aot->Plugin = plugin;
+	aot->ROMCRC = crc;
+	for (u32 i = 0; i < plugin->NumBlocks; i++) {
+		const AOTBlock_t* block = &plugin->Blocks[i];
+		// the start is also a decoded instruction for the interpreter, see CompileBlock in jit.c
+		if (block->Index < sizeof (TI83->ROM) && (block->Index & 0x3FFF) <= 0x3FFD) {
+			aot->Blocks[block->Index] = block;
+		}
+	}
+
+	TI83->AOT = aot;
+	TI83->AOTEnabled = true;
+}
+
+void DestroyAOT(TI83_t* TI83) {
+	if (TI83->AOT) {
+		ClosePlugin(TI83->AOT->Handle);
+		free(TI83->AOT);
+		TI83->AOT = NULL;
+	}
+	TI83->AOTEnabled = false;
+}
+
+bool SetAOTEnabled(TI83_t* TI83, bool enabled) {
+	if (enabled && !TI83->AOT) {
+		return false;
+	}
+
+	if (!enabled && TI83->AOTEnabled) {
+		// drops the DECODE_BLOCK marks, which would otherwise keep the interpreter off its fast path
+		memset(TI83->DecodeCache, 0, sizeof (TI83->ROM) * sizeof (DecodedOp_t));
+	}
+
+	TI83->AOTEnabled = enabled;
+	return true;
+}
+
+void InvalidateAOT(TI83_t* TI83) {
+	if (TI83->AOT) {
+		TI83->AOT->CheckROM = true;
+	}
+}
+
+void CheckAOT(TI83_t* TI83) {
+	if (TI83->AOT && TI83->AOT->CheckROM) {
+		// the blocks have the ROM's code baked in, so they're only good for the exact ROM they were built from
+		if (CRC32(TI83->ROM, sizeof (TI83->ROM)) != TI83->AOT->ROMCRC) {
+			DestroyAOT(TI83);
+			return;
+		}
+		TI83->AOT->CheckROM = false;
+	}
+}
+
+bool RunAOTBlock(TI83_t* TI83, u64* cycleCount) {
+	// callbacks and the memory log need to see every access (and breakpoints every instruction), so they're left to the interpreter
+	if (TI83->ReadCallback || TI83->WriteCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints) {
+		return false;
+	}
+
+	// blocks have the PCs they run at built in, and plugins only compile page 0 at 0x0000-0x3FFF (see tools/aot.c)
+	u16 pc = TI83->PC;
+	if (pc >= 0x8000 || (pc >= 0x4000 && !TI83->ROMPage)) {
+		return false;
+	}
+
+	u32 index = pc < 0x4000 ? pc : TI83->ROMPage * 0x4000 + pc - 0x4000;
+	const AOTBlock_t* block = TI83->AOT->Blocks[index];
+	if (!block) {
+		return false;
+	}
+
+	// marked before the event check, as the interpreter would otherwise decode (and fuse) this and never come back
+	DecodedOp_t* decoded = &TI83->DecodePtrs[pc >> 14][pc];
+	if (decoded->Kind == DECODE_NONE) {
+		decoded->Kind = DECODE_BLOCK;
+		decoded->Opcode = ReadMem(TI83, pc);
+		decoded->Operand[0] = ReadMem(TI83, pc + 1);
+		decoded->Operand[1] = ReadMem(TI83, pc + 2);
+	}
+
+	if (*cycleCount + block->LastStart >= TI83->NextEventTime) {
+		return false;
+	}
+
+	*cycleCount += block->Code(TI83, &Host);
+	TI83->R = (TI83->R & 0x80) | ((TI83->R + block->Fetches) & 0x7F);
+	return true;
+}
+
+#else
+
+void LoadAOT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+void DestroyAOT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+bool SetAOTEnabled(TI83_t* TI83, bool enabled) {
+	(void)TI83;
+	return !enabled;
+}
+
+void InvalidateAOT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+void CheckAOT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+bool RunAOTBlock(TI83_t* TI83, u64* cycleCount) {
+	(void)TI83;
+	(void)cycleCount;
+	return false;
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AOT_H
+#define AOT_H
+
+#include <stddef.h>
+
+#include "ti83.h"
+
+// precompiled blocks for a specific ROM, generated offline by tools/aot.c and loaded from a plugin library (see aot.c)
+// the blocks cover the same instructions as the JIT and follow the same rules, the interpreter runs everything else
+// plugins include this header too, so anything changing TI83_t or the semantics below must bump AOT_VERSION
+
+#define AOT_VERSION 7
+
+// where each field blocks use is, as a new field can move them without changing the size of TI83_t
+#define AOT_CONTEXT_LAYOUT { \
+	offsetof(TI83_t, MainRegs.F), offsetof(TI83_t, MainRegs.A), offsetof(TI83_t, MainRegs.C), offsetof(TI83_t, MainRegs.B), \
+	offsetof(TI83_t, MainRegs.E), offsetof(TI83_t, MainRegs.D), offsetof(TI83_t, MainRegs.L), offsetof(TI83_t, MainRegs.H), \
+	offsetof(TI83_t, LazyFlags.Op), offsetof(TI83_t, LazyFlags.N1), offsetof(TI83_t, LazyFlags.N2), \
+	offsetof(TI83_t, LazyFlags.Res), offsetof(TI83_t, LazyFlags.Carry), \
+	offsetof(TI83_t, PC), offsetof(TI83_t, PCL), offsetof(TI83_t, PCH), offsetof(TI83_t, SP), \
+	offsetof(TI83_t, WZ), offsetof(TI83_t, Z), offsetof(TI83_t, W), \
+}
+
+#define AOT_CONTEXT_LAYOUT_SIZE 20
+
+// a plugin's library is emu83aot_XXXXXXXX (the ROM's CRC32 in upper case hex) plus the platform's suffix
+#if defined(_WIN32)
+	#define AOT_PLUGIN_SUFFIX ".dll"
+#elif defined(__APPLE__)
+	#define AOT_PLUGIN_SUFFIX ".dylib"
+#else
+	#define AOT_PLUGIN_SUFFIX ".so"
+#endif
+
+// the core's memory access, which plugins can't link against
+typedef struct {
+	u8 (*ReadMem)(TI83_t* TI83, u16 addr);
+	void (*WriteMem)(TI83_t* TI83, u16 addr, u8 val);
+} AOTHost_t;
+
+typedef u32 (*AOTCode_t)(TI83_t* TI83, const AOTHost_t* host);
+
+typedef struct {
+	u32 Index; // ROM offset of the first instruction (page * 0x4000 + (addr & 0x3FFF))
+	u32 LastStart; // cycles before the last instruction starts, this must be before the next event
+	u32 Fetches; // opcode fetches, for R
+	AOTCode_t Code; // returns the cycles taken, and leaves PC at the next instruction
+} AOTBlock_t;
+
+// exported by the plugin as TI83_AOTPlugin
+typedef struct {
+	u32 Version; // AOT_VERSION
+	u32 ContextSize; // sizeof (TI83_t), as a sanity check on the layout
+	u32 ContextLayout[AOT_CONTEXT_LAYOUT_SIZE]; // AOT_CONTEXT_LAYOUT
+	u32 ROMCRC; // of the whole (padded) ROM, as TI83_CreateContext has it
+	u32 NumBlocks;
+	const AOTBlock_t* Blocks;
+} AOTPlugin_t;
+
+// the lazy flag handling shared by every generated block, matching the interpreter (see LazyFlags_t)
+
+static inline u8 AOTFlagCF(TI83_t* TI83) {
+	return TI83->LazyFlags.Op != FLAGS_NONE ? TI83->LazyFlags.Carry : (TI83->MainRegs.F & 0x01);
+}
+
+static inline u8 AOTFlagZF(TI83_t* TI83) {
+	return TI83->LazyFlags.Op != FLAGS_NONE ? !TI83->LazyFlags.Res : ((TI83->MainRegs.F >> 6) & 1);
+}
+
+// inc r / dec r
+static inline void AOTIncDec8(TI83_t* TI83, u8* r, bool dec) {
+	TI83->LazyFlags.Carry = AOTFlagCF(TI83);
+	TI83->LazyFlags.N1 = *r;
+	*r = dec ? *r - 1 : *r + 1;
+	TI83->LazyFlags.Res = *r;
+	TI83->LazyFlags.N2 = 1;
+	TI83->LazyFlags.Op = dec ? FLAGS_SUB : FLAGS_ADD;
+}
+
+// add/adc/sub/sbc/and/xor/or/cp a, with op being bits 3-5 of the opcode
+static inline void AOTALU(TI83_t* TI83, u8 op, u8 n) {
+	static const u8 LazyOps[8] = { FLAGS_ADD, FLAGS_ADD, FLAGS_SUB, FLAGS_SUB, FLAGS_AND, FLAGS_LOGIC, FLAGS_LOGIC, FLAGS_CP };
+	u32 carry = (op == 1 || op == 3) ? AOTFlagCF(TI83) : 0;
+	u32 a = TI83->MainRegs.A;
+	u32 res;
+	switch (op) {
+		case 0: case 1: res = a + n + carry; break;
+		case 4: res = a & n; break;
+		case 5: res = a ^ n; break;
+		case 6: res = a | n; break;
+		default: res = a - n - carry; break;
+	}
+
+	if (op < 4 || op == 7) {
+		TI83->LazyFlags.N1 = a;
+		TI83->LazyFlags.N2 = n;
+		TI83->LazyFlags.Carry = res > 0xFF;
+	} else {
+		TI83->LazyFlags.Carry = false;
+	}
+
+	if (op != 7) {
+		TI83->MainRegs.A = res;
+	}
+
+	TI83->LazyFlags.Res = res;
+	TI83->LazyFlags.Op = LazyOps[op];
+}
+
+void LoadAOT(TI83_t* TI83);
+void DestroyAOT(TI83_t* TI83);
+bool SetAOTEnabled(TI83_t* TI83, bool enabled);
+void InvalidateAOT(TI83_t* TI83);
+void CheckAOT(TI83_t* TI83);
+bool RunAOTBlock(TI83_t* TI83, u64* cycleCount);
+
+#endif
@@ -0,0 +1,45 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// the whole library as a single translation unit (see EMU83_UNITY in CMakeLists.txt)
+// so ReadMem/WriteMem and the port handlers can be inlined into RunFrame without LTO
+// new source files need to be added here as well
+// except z80ref.c, whose macros share their names with z80.c's, so it's always its own translation unit
+
+// jit.c and aot.c need this, and it has to come before any system header
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+	#define _DEFAULT_SOURCE
+#endif
+
+#include "aot.c"
+#include "crc32.c"
+#include "events.c"
+#include "jit.c"
+#include "link.c"
+#include "memory.c"
+#include "queue.c"
+#include "savestate.c"
+#include "stream.c"
+#include "ti83.c"
+#include "z80.c"
@@ -25,9 +25,7 @@ SOFTWARE.
 #include "ti83.h"
 #include "memory.h"
 
-void ScheduleEvent(TI83_t* TI83, EventId_t eventId, u64 newEventTime) {
-	TI83->EventSchedule[eventId] = newEventTime;
-
+void UpdateNextEvent(TI83_t* TI83) {
 	// schedule the next event
 	EventId_t nextEventId = NUM_EVENTS;
 	u64 nextEventTime = EVENT_TIME_NEVER;
@@ -38,7 +36,13 @@ void ScheduleEvent(TI83_t* TI83, EventId_t eventId, u64 newEventTime) {
 		}
 	}
 	TI83->NextEventId = nextEventId;
-	TI83->NextEventTime = nextEventTime;
+	// RunFrame is switching variants, keep it stopping at the next instruction (see CallbacksChanged)
+	TI83->NextEventTime = TI83->CallbacksChanged ? EVENT_TIME_NOW : nextEventTime;
+}
+
+void ScheduleEvent(TI83_t* TI83, EventId_t eventId, u64 newEventTime) {
+	TI83->EventSchedule[eventId] = newEventTime;
+	UpdateNextEvent(TI83);
 }
 
 u64 Event(TI83_t* TI83, u64 cycleCount) {
@@ -28,6 +28,7 @@ SOFTWARE.
 #include "ti83.h"
 
 void ScheduleEvent(TI83_t* TI83, EventId_t eventId, u64 newEventTime);
+void UpdateNextEvent(TI83_t* TI83);
 u64 Event(TI83_t* TI83, u64 cycleCount);
 
 #endif
@@ -0,0 +1,101 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// generated by tools/fusegen.c, don't edit by hand (see README.md)
+
+#ifndef FUSION_H
+#define FUSION_H
+
+static const FusedOp_t FusedOps[] = {
+	// dec bc / ld a,b / or a,c / jr nz,e (184030 pairs)
+	{ 5, 14, { 0x0B, 0x78, 0xB1, 0x20, 0x00 }, { 0xFF, 0xFF, 0xFF, 0xFF, 0x00 } },
+	// inc hl / ld (de),a / inc de / djnz e (94908 pairs)
+	{ 5, 19, { 0x23, 0x12, 0x13, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0xFF, 0x00 } },
+	// inc hl / add a,c / ld c,a / djnz e (92032 pairs)
+	{ 5, 14, { 0x23, 0x81, 0x4F, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0xFF, 0x00 } },
+	// add hl,de / inc hl / ld (de),a / inc de (46000 pairs)
+	{ 4, 24, { 0x19, 0x23, 0x12, 0x13 }, { 0xFF, 0xFF, 0xFF, 0xFF } },
+	// add hl,de / ld a,(hl) / inc hl / ld (de),a (46000 pairs)
+	{ 4, 24, { 0x19, 0x7E, 0x23, 0x12 }, { 0xFF, 0xFF, 0xFF, 0xFF } },
+	// ld de,nn / ld b,n / ex de,hl / djnz e (5751 pairs)
+	{ 8, 21, { 0x11, 0x00, 0x00, 0x06, 0x00, 0xEB, 0x10, 0x00 }, { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00 } },
+	// ld (de),a / inc de / djnz e (94908 pairs)
+	{ 4, 13, { 0x12, 0x13, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0x00 } },
+	// inc hl / or a,a / jr nz,e (94908 pairs)
+	{ 4, 10, { 0x23, 0xB7, 0x20, 0x00 }, { 0xFF, 0xFF, 0xFF, 0x00 } },
+	// add hl,de / ex de,hl / djnz e (46000 pairs)
+	{ 4, 15, { 0x19, 0xEB, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0x00 } },
+	// inc hl / ex de,hl / djnz e (46000 pairs)
+	{ 4, 10, { 0x23, 0xEB, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0x00 } },
+	// ld a,(hl) / ex de,hl / djnz e (46000 pairs)
+	{ 4, 11, { 0x7E, 0xEB, 0x10, 0x00 }, { 0xFF, 0xFF, 0xFF, 0x00 } },
+	// ld b,n / ex de,hl / djnz e (8625 pairs)
+	{ 5, 11, { 0x06, 0x00, 0xEB, 0x10, 0x00 }, { 0xFF, 0x00, 0xFF, 0xFF, 0x00 } },
+	// ld a,(hl) / inc hl (281848 pairs)
+	{ 2, 7, { 0x7E, 0x23 }, { 0xFF, 0xFF } },
+	// ex de,hl / djnz e (138000 pairs)
+	{ 3, 4, { 0xEB, 0x10, 0x00 }, { 0xFF, 0xFF, 0x00 } },
+	// ex de,hl / add hl,de (138000 pairs)
+	{ 2, 4, { 0xEB, 0x19 }, { 0xFF, 0xFF } },
+	// ld b,n / call nn (5752 pairs)
+	{ 5, 7, { 0x06, 0x00, 0xCD, 0x00, 0x00 }, { 0xFF, 0x00, 0xFF, 0x00, 0x00 } },
+};
+
+#define FUSED_OP_HANDLERS \
+	FUSED_OP(0): DEC_RR(BC); FUSED_NEXT(); LD_R_R(A, B); FUSED_NEXT(); OR_A_R(C); FUSED_NEXT(); JR_CC_E(!FLAG_ZF()); NEXT_OPCODE(); \
+	FUSED_OP(1): INC_RR(HL); FUSED_NEXT(); LD_DRR_A(DE); FUSED_NEXT(); INC_RR(DE); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(2): INC_RR(HL); FUSED_NEXT(); ADD_A_R(C); FUSED_NEXT(); LD_R_R(C, A); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(3): ADD_RR_RR(HL, DE); FUSED_NEXT(); INC_RR(HL); FUSED_NEXT(); LD_DRR_A(DE); FUSED_NEXT(); INC_RR(DE); NEXT_OPCODE(); \
+	FUSED_OP(4): ADD_RR_RR(HL, DE); FUSED_NEXT(); LD_R_DHL(A); FUSED_NEXT(); INC_RR(HL); FUSED_NEXT(); LD_DRR_A(DE); NEXT_OPCODE(); \
+	FUSED_OP(5): LD_RR_NN(D, E); FUSED_NEXT(); LD_R_N(B); FUSED_NEXT(); EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(6): LD_DRR_A(DE); FUSED_NEXT(); INC_RR(DE); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(7): INC_RR(HL); FUSED_NEXT(); OR_A_R(A); FUSED_NEXT(); JR_CC_E(!FLAG_ZF()); NEXT_OPCODE(); \
+	FUSED_OP(8): ADD_RR_RR(HL, DE); FUSED_NEXT(); EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(9): INC_RR(HL); FUSED_NEXT(); EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(10): LD_R_DHL(A); FUSED_NEXT(); EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(11): LD_R_N(B); FUSED_NEXT(); EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(12): LD_R_DHL(A); FUSED_NEXT(); INC_RR(HL); NEXT_OPCODE(); \
+	FUSED_OP(13): EX_DE_HL(); FUSED_NEXT(); DJNZ_E(); NEXT_OPCODE(); \
+	FUSED_OP(14): EX_DE_HL(); FUSED_NEXT(); ADD_RR_RR(HL, DE); NEXT_OPCODE(); \
+	FUSED_OP(15): LD_R_N(B); FUSED_NEXT(); CALL_CC_NN(true); NEXT_OPCODE();
+
+#define FUSED_OP_LABELS \
+	&&FUSED_OP(0), \
+	&&FUSED_OP(1), \
+	&&FUSED_OP(2), \
+	&&FUSED_OP(3), \
+	&&FUSED_OP(4), \
+	&&FUSED_OP(5), \
+	&&FUSED_OP(6), \
+	&&FUSED_OP(7), \
+	&&FUSED_OP(8), \
+	&&FUSED_OP(9), \
+	&&FUSED_OP(10), \
+	&&FUSED_OP(11), \
+	&&FUSED_OP(12), \
+	&&FUSED_OP(13), \
+	&&FUSED_OP(14), \
+	&&FUSED_OP(15),
+
+#endif
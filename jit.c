@@ -0,0 +1,831 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// mmap's MAP_ANONYMOUS isn't part of strict C11/POSIX
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+	#define _DEFAULT_SOURCE
+#endif
+
+#include "ti83.h"
+#include "jit.h"
+#include "memory.h"
+
+#ifdef JIT_SUPPORTED
+
+#include <stddef.h>
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#ifndef MAP_ANONYMOUS
+		#define MAP_ANONYMOUS MAP_ANON
+	#endif
+#endif
+
+// straight-line runs of simple unprefixed instructions are compiled into native code
+// a block ends at the first control transfer, or before anything it can't compile (prefixes, port i/o, ei/di, halt, etc.)
+// those, along with interrupts and events, are left to the interpreter, which remains the reference implementation
+// blocks work on TI83_t directly (rbx holds the context) and set LazyFlags exactly like the interpreter would
+// so switching between the two at any block boundary is invisible
+// a block is compiled the first time its start is executed (i.e. on a decode miss), and marked DECODE_BLOCK in the decode cache
+// so the interpreter's decoded instruction fast path stays untouched for everything else
+
+#define JIT_MAX_BLOCK_LENGTH 64
+
+#define JIT_ARENA_SIZE (8 * 1024 * 1024)
+
+// more than the largest instruction plus a block exit will emit
+#define JIT_MAX_INSTRUCTION_SIZE 192
+
+// one entry per ROM byte, then one per RAM byte (like DecodeCache)
+// then one per byte of ROM page 0 as seen through bank 1, as blocks have the PCs they run at built in
+#define JIT_NUM_ENTRIES (0x40000 + 0x8000 + 0x4000)
+
+typedef u32 (*JITCode_t)(TI83_t* TI83);
+
+typedef struct {
+	JITCode_t Code; // returns the cycles taken
+	u32 LastStart; // cycles before the last instruction starts, this must be before the next event
+	u8 Fetches; // opcode fetches, for R
+} JITBlock_t;
+
+struct JIT_t {
+	u8* Arena;
+	u32 ArenaUsed;
+	JITBlock_t* Blocks[JIT_NUM_ENTRIES];
+};
+
+// x86-64 registers, only the low 8 (and r8/r9) are ever used
+typedef enum {
+	EAX, ECX, EDX, EBX, ESP, EBP, ESI, EDI, R8D, R9D,
+} HostReg_t;
+
+#if defined(_WIN32)
+	#define ARG1 EDX
+	#define ARG2 R8D
+#else
+	#define ARG1 ESI
+	#define ARG2 EDX
+#endif
+
+#define OFFSET(FIELD) ((u32)offsetof(TI83_t, FIELD))
+
+typedef struct {
+	u8* Ptr;
+} Emitter_t;
+
+static void Emit8(Emitter_t* e, u8 val) {
+	*e->Ptr++ = val;
+}
+
+static void Emit16(Emitter_t* e, u16 val) {
+	memcpy(e->Ptr, &val, sizeof (val));
+	e->Ptr += sizeof (val);
+}
+
+static void Emit32(Emitter_t* e, u32 val) {
+	memcpy(e->Ptr, &val, sizeof (val));
+	e->Ptr += sizeof (val);
+}
+
+static void Emit64(Emitter_t* e, u64 val) {
+	memcpy(e->Ptr, &val, sizeof (val));
+	e->Ptr += sizeof (val);
+}
+
+// [rbx + disp32] operand, with REG in the reg field
+static void EmitRBX(Emitter_t* e, u8 reg, u32 disp) {
+	Emit8(e, 0x80 | ((reg & 7) << 3) | EBX);
+	Emit32(e, disp);
+}
+
+static void EmitRexR(Emitter_t* e, HostReg_t reg) {
+	if (reg >= R8D) {
+		Emit8(e, 0x44);
+	}
+}
+
+// movzx reg, byte [rbx + disp]
+static void EmitLoad8(Emitter_t* e, HostReg_t reg, u32 disp) {
+	EmitRexR(e, reg);
+	Emit8(e, 0x0F);
+	Emit8(e, 0xB6);
+	EmitRBX(e, reg, disp);
+}
+
+// movzx reg, word [rbx + disp]
+static void EmitLoad16(Emitter_t* e, HostReg_t reg, u32 disp) {
+	EmitRexR(e, reg);
+	Emit8(e, 0x0F);
+	Emit8(e, 0xB7);
+	EmitRBX(e, reg, disp);
+}
+
+// mov byte [rbx + disp], reg (al, cl, dl, or bl)
+static void EmitStore8(Emitter_t* e, HostReg_t reg, u32 disp) {
+	Emit8(e, 0x88);
+	EmitRBX(e, reg, disp);
+}
+
+// mov word [rbx + disp], reg
+static void EmitStore16(Emitter_t* e, HostReg_t reg, u32 disp) {
+	Emit8(e, 0x66);
+	EmitRexR(e, reg);
+	Emit8(e, 0x89);
+	EmitRBX(e, reg, disp);
+}
+
+// mov byte [rbx + disp], imm
+static void EmitStoreImm8(Emitter_t* e, u32 disp, u8 imm) {
+	Emit8(e, 0xC6);
+	EmitRBX(e, 0, disp);
+	Emit8(e, imm);
+}
+
+// mov word [rbx + disp], imm
+static void EmitStoreImm16(Emitter_t* e, u32 disp, u16 imm) {
+	Emit8(e, 0x66);
+	Emit8(e, 0xC7);
+	EmitRBX(e, 0, disp);
+	Emit16(e, imm);
+}
+
+// inc/dec word [rbx + disp]
+static void EmitIncDec16(Emitter_t* e, u32 disp, bool dec) {
+	Emit8(e, 0x66);
+	Emit8(e, 0xFF);
+	EmitRBX(e, dec, disp);
+}
+
+// cmp byte [rbx + disp], 0
+static void EmitTestZero8(Emitter_t* e, u32 disp) {
+	Emit8(e, 0x80);
+	EmitRBX(e, 7, disp);
+	Emit8(e, 0);
+}
+
+// mov reg, imm
+static void EmitMovImm32(Emitter_t* e, HostReg_t reg, u32 imm) {
+	if (reg >= R8D) {
+		Emit8(e, 0x41);
+	}
+	Emit8(e, 0xB8 | (reg & 7));
+	Emit32(e, imm);
+}
+
+// emits a jcc rel32 with no target yet, returns where the target goes
+static u8* EmitJcc(Emitter_t* e, u8 cc) {
+	Emit8(e, 0x0F);
+	Emit8(e, 0x80 | cc);
+	u8* rel = e->Ptr;
+	Emit32(e, 0);
+	return rel;
+}
+
+static void PatchJump(Emitter_t* e, u8* rel) {
+	u32 disp = (u32)(e->Ptr - (rel + 4));
+	memcpy(rel, &disp, sizeof (disp));
+}
+
+#define CC_Z 0x4
+#define CC_NZ 0x5
+
+// the first argument is always the context
+static void EmitCall(Emitter_t* e, const void* fn) {
+#if defined(_WIN32)
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xD9); // mov rcx, rbx
+#else
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xDF); // mov rdi, rbx
+#endif
+	Emit8(e, 0x48); Emit8(e, 0xB8); Emit64(e, (u64)(uintptr_t)fn); // mov rax, fn
+	Emit8(e, 0xFF); Emit8(e, 0xD0); // call rax
+}
+
+static const void* FunctionAddress(u8 (*fn)(TI83_t*, u16)) {
+	const void* ret;
+	memcpy(&ret, &fn, sizeof (ret));
+	return ret;
+}
+
+static const void* WriteFunctionAddress(void (*fn)(TI83_t*, u16, u8)) {
+	const void* ret;
+	memcpy(&ret, &fn, sizeof (ret));
+	return ret;
+}
+
+// al = ReadMem(TI83, word [rbx + disp])
+static void EmitReadMem(Emitter_t* e, u32 addrDisp) {
+	EmitLoad16(e, ARG1, addrDisp);
+	EmitCall(e, FunctionAddress(ReadMem));
+}
+
+// al = ReadMem(TI83, addr)
+static void EmitReadMemImm(Emitter_t* e, u16 addr) {
+	EmitMovImm32(e, ARG1, addr);
+	EmitCall(e, FunctionAddress(ReadMem));
+}
+
+// WriteMem(TI83, word [rbx + addrDisp], byte [rbx + valDisp])
+static void EmitWriteMem(Emitter_t* e, u32 addrDisp, u32 valDisp) {
+	EmitLoad16(e, ARG1, addrDisp);
+	EmitLoad8(e, ARG2, valDisp);
+	EmitCall(e, WriteFunctionAddress(WriteMem));
+}
+
+// WriteMem(TI83, word [rbx + addrDisp], val)
+static void EmitWriteMemImmVal(Emitter_t* e, u32 addrDisp, u8 val) {
+	EmitLoad16(e, ARG1, addrDisp);
+	EmitMovImm32(e, ARG2, val);
+	EmitCall(e, WriteFunctionAddress(WriteMem));
+}
+
+// WriteMem(TI83, addr, byte [rbx + valDisp])
+static void EmitWriteMemImmAddr(Emitter_t* e, u16 addr, u32 valDisp) {
+	EmitMovImm32(e, ARG1, addr);
+	EmitLoad8(e, ARG2, valDisp);
+	EmitCall(e, WriteFunctionAddress(WriteMem));
+}
+
+static void EmitPrologue(Emitter_t* e) {
+	Emit8(e, 0x53); // push rbx
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xEC); Emit8(e, 0x20); // sub rsp, 32 (shadow space on win64, keeps alignment)
+#if defined(_WIN32)
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xCB); // mov rbx, rcx
+#else
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xFB); // mov rbx, rdi
+#endif
+}
+
+static void EmitReturn(Emitter_t* e, u32 cycles) {
+	EmitMovImm32(e, EAX, cycles);
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xC4); Emit8(e, 0x20); // add rsp, 32
+	Emit8(e, 0x5B); // pop rbx
+	Emit8(e, 0xC3); // ret
+}
+
+static void EmitExit(Emitter_t* e, u16 pc, u32 cycles) {
+	EmitStoreImm16(e, OFFSET(PC), pc);
+	EmitReturn(e, cycles);
+}
+
+// ecx = FLAG_CF()
+static void EmitFlagCF(Emitter_t* e) {
+	EmitLoad8(e, ECX, OFFSET(LazyFlags.Carry));
+	EmitLoad8(e, R8D, OFFSET(MainRegs.F));
+	Emit8(e, 0x41); Emit8(e, 0x83); Emit8(e, 0xE0); Emit8(e, 0x01); // and r8d, 1
+	EmitTestZero8(e, OFFSET(LazyFlags.Op));
+	Emit8(e, 0x41); Emit8(e, 0x0F); Emit8(e, 0x44); Emit8(e, 0xC8); // cmove ecx, r8d
+}
+
+// ecx = FLAG_ZF()
+static void EmitFlagZF(Emitter_t* e) {
+	EmitTestZero8(e, OFFSET(LazyFlags.Res));
+	Emit8(e, 0x0F); Emit8(e, 0x94); Emit8(e, 0xC1); // sete cl
+	Emit8(e, 0x0F); Emit8(e, 0xB6); Emit8(e, 0xC9); // movzx ecx, cl
+	EmitLoad8(e, R8D, OFFSET(MainRegs.F));
+	Emit8(e, 0x41); Emit8(e, 0xC1); Emit8(e, 0xE8); Emit8(e, 0x06); // shr r8d, 6
+	Emit8(e, 0x41); Emit8(e, 0x83); Emit8(e, 0xE0); Emit8(e, 0x01); // and r8d, 1
+	EmitTestZero8(e, OFFSET(LazyFlags.Op));
+	Emit8(e, 0x41); Emit8(e, 0x0F); Emit8(e, 0x44); Emit8(e, 0xC8); // cmove ecx, r8d
+}
+
+// ecx = the condition of a jr/jp/ret cc (nz, z, nc, c)
+static void EmitCondition(Emitter_t* e, u8 cc) {
+	if (cc & 2) {
+		EmitFlagCF(e);
+	} else {
+		EmitFlagZF(e);
+	}
+	if (!(cc & 1)) {
+		Emit8(e, 0x83); Emit8(e, 0xF1); Emit8(e, 0x01); // xor ecx, 1
+	}
+}
+
+static const u32 Reg8Offsets[8] = {
+	OFFSET(MainRegs.B), OFFSET(MainRegs.C), OFFSET(MainRegs.D), OFFSET(MainRegs.E),
+	OFFSET(MainRegs.H), OFFSET(MainRegs.L), 0, OFFSET(MainRegs.A),
+};
+
+static const u32 Reg16Offsets[4] = {
+	OFFSET(MainRegs.BC), OFFSET(MainRegs.DE), OFFSET(MainRegs.HL), OFFSET(SP),
+};
+
+// high, low
+static const u32 PushPopOffsets[3][2] = {
+	{ OFFSET(MainRegs.B), OFFSET(MainRegs.C) },
+	{ OFFSET(MainRegs.D), OFFSET(MainRegs.E) },
+	{ OFFSET(MainRegs.H), OFFSET(MainRegs.L) },
+};
+
+// INC_R/DEC_R
+static void EmitIncDec8(Emitter_t* e, u32 reg, bool dec) {
+	EmitFlagCF(e);
+	EmitLoad8(e, EAX, reg);
+	EmitStore8(e, EAX, OFFSET(LazyFlags.N1));
+	Emit8(e, dec ? 0x2C : 0x04); Emit8(e, 0x01); // sub/add al, 1
+	EmitStore8(e, EAX, reg);
+	EmitStore8(e, EAX, OFFSET(LazyFlags.Res));
+	EmitStoreImm8(e, OFFSET(LazyFlags.N2), 1);
+	EmitStore8(e, ECX, OFFSET(LazyFlags.Carry));
+	EmitStoreImm8(e, OFFSET(LazyFlags.Op), dec ? FLAGS_SUB : FLAGS_ADD);
+}
+
+// ADD_A/ADC_A/SUB_A/SBC_A/AND_A/XOR_A/OR_A/CP_A, with the operand in edx
+static void EmitALU(Emitter_t* e, u8 op) {
+	static const u8 LazyOps[8] = { FLAGS_ADD, FLAGS_ADD, FLAGS_SUB, FLAGS_SUB, FLAGS_AND, FLAGS_LOGIC, FLAGS_LOGIC, FLAGS_CP };
+	if (op == 1 || op == 3) {
+		EmitFlagCF(e);
+	}
+	EmitLoad8(e, EAX, OFFSET(MainRegs.A));
+	switch (op) {
+		case 0: case 1: case 2: case 3: case 7:
+			EmitStore8(e, EAX, OFFSET(LazyFlags.N1));
+			EmitStore8(e, EDX, OFFSET(LazyFlags.N2));
+			if (op < 2) {
+				Emit8(e, 0x01); Emit8(e, 0xD0); // add eax, edx
+				if (op == 1) {
+					Emit8(e, 0x01); Emit8(e, 0xC8); // add eax, ecx
+				}
+			} else {
+				Emit8(e, 0x29); Emit8(e, 0xD0); // sub eax, edx
+				if (op == 3) {
+					Emit8(e, 0x29); Emit8(e, 0xC8); // sub eax, ecx
+				}
+			}
+			Emit8(e, 0x3D); Emit32(e, 0xFF); // cmp eax, 0xFF
+			Emit8(e, 0x0F); Emit8(e, 0x97); Emit8(e, 0xC1); // seta cl
+			EmitStore8(e, ECX, OFFSET(LazyFlags.Carry));
+			break;
+		case 4: Emit8(e, 0x21); Emit8(e, 0xD0); break; // and eax, edx
+		case 5: Emit8(e, 0x31); Emit8(e, 0xD0); break; // xor eax, edx
+		case 6: Emit8(e, 0x09); Emit8(e, 0xD0); break; // or eax, edx
+	}
+	if (op >= 4 && op <= 6) {
+		EmitStoreImm8(e, OFFSET(LazyFlags.Carry), 0);
+	}
+	if (op != 7) {
+		EmitStore8(e, EAX, OFFSET(MainRegs.A));
+	}
+	EmitStore8(e, EAX, OFFSET(LazyFlags.Res));
+	EmitStoreImm8(e, OFFSET(LazyFlags.Op), LazyOps[op]);
+}
+
+// POP_RR, low then high
+static void EmitPop(Emitter_t* e, u32 high, u32 low) {
+	EmitReadMem(e, OFFSET(SP));
+	EmitStore8(e, EAX, low);
+	EmitIncDec16(e, OFFSET(SP), false);
+	EmitReadMem(e, OFFSET(SP));
+	EmitStore8(e, EAX, high);
+	EmitIncDec16(e, OFFSET(SP), false);
+}
+
+static u32 BlockIndex(TI83_t* TI83, u16 addr) {
+	if (addr < 0x4000) {
+		return addr;
+	} else if (addr < 0x8000) {
+		return TI83->ROMPage ? TI83->ROMPage * 0x4000 + addr - 0x4000 : 0x48000 + addr - 0x4000;
+	} else {
+		return 0x40000 + addr - 0x8000;
+	}
+}
+
+static bool SameRegion(u16 start, u16 addr) {
+	// RAM blocks stay within a 256 byte page, so a write only needs to drop that page's blocks (see InvalidateJITPage)
+	if (start >= 0x8000) {
+		return (start >> 8) == (addr >> 8);
+	}
+	return (start >> 14) == (addr >> 14);
+}
+
+static JITBlock_t* CompileBlock(TI83_t* TI83, u16 start) {
+	JIT_t* jit = TI83->JIT;
+	if (jit->ArenaUsed + sizeof (JITBlock_t) + JIT_MAX_BLOCK_LENGTH * JIT_MAX_INSTRUCTION_SIZE > JIT_ARENA_SIZE) {
+		FlushJIT(TI83);
+	}
+
+	// the start is also a decoded instruction for the interpreter (see DecodeOp), which has the same restriction
+	u16 last = start + 2;
+	if ((start ^ last) & 0xC000) {
+		return NULL;
+	}
+
+	bool inRAM = start >= 0x8000;
+
+	JITBlock_t* block = (JITBlock_t*)(jit->Arena + jit->ArenaUsed);
+	u8* code = (u8*)(block + 1);
+	Emitter_t emitter = { code };
+	Emitter_t* e = &emitter;
+	EmitPrologue(e);
+
+	u16 pc = start;
+	u32 cycles = 0, lastStart = 0, count = 0;
+	bool terminated = false;
+	while (!terminated && count < JIT_MAX_BLOCK_LENGTH) {
+		u8 opcode = ReadMem(TI83, pc);
+		u32 len;
+		switch (opcode) {
+			case 0x01: case 0x11: case 0x21: case 0x31: // ld rr,nn
+			case 0x32: case 0x3A: // ld (nn),a / ld a,(nn)
+			case 0xC3: case 0xC2: case 0xCA: case 0xD2: case 0xDA: // jp (cc,)nn
+			case 0xCD: // call nn
+				len = 3;
+				break;
+			case 0x06: case 0x0E: case 0x16: case 0x1E: case 0x26: case 0x2E: case 0x3E: // ld r,n
+			case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE: // alu a,n
+			case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: // djnz / jr (cc,)e
+				len = 2;
+				break;
+			case 0x00: // nop
+			case 0x02: case 0x12: case 0x0A: case 0x1A: // ld (rr),a / ld a,(rr)
+			case 0x03: case 0x13: case 0x23: case 0x33: case 0x0B: case 0x1B: case 0x2B: case 0x3B: // inc/dec rr
+			case 0x04: case 0x0C: case 0x14: case 0x1C: case 0x24: case 0x2C: case 0x3C: // inc r
+			case 0x05: case 0x0D: case 0x15: case 0x1D: case 0x25: case 0x2D: case 0x3D: // dec r
+			case 0xEB: // ex de,hl
+			case 0xC1: case 0xD1: case 0xE1: case 0xC5: case 0xD5: case 0xE5: // pop/push rr
+			case 0xC9: case 0xC0: case 0xC8: case 0xD0: case 0xD8: // ret (cc)
+				len = 1;
+				break;
+			default:
+				// ld r,r' / ld r,(hl) / ld (hl),r / alu a,r / alu a,(hl), but not halt
+				len = (opcode >= 0x40 && opcode < 0xC0 && opcode != 0x76) ? 1 : 0;
+				break;
+		}
+
+		if (!len || !SameRegion(start, pc + len - 1) || pc + len - 1 > 0xFFFF) {
+			break;
+		}
+
+		u8 n1 = len > 1 ? ReadMem(TI83, pc + 1) : 0;
+		u8 n2 = len > 2 ? ReadMem(TI83, pc + 2) : 0;
+		u16 nn = n1 | (n2 << 8);
+		u16 next = pc + len;
+		bool wrote = false;
+		lastStart = cycles;
+		++count;
+
+		switch (opcode) {
+			case 0x00:
+				cycles += 4;
+				break;
+			case 0x01: case 0x11: case 0x21: case 0x31:
+				EmitStoreImm16(e, Reg16Offsets[opcode >> 4], nn);
+				cycles += 10;
+				break;
+			case 0x02: case 0x12: {
+				u32 rr = Reg16Offsets[opcode >> 4];
+				EmitWriteMem(e, rr, OFFSET(MainRegs.A));
+				// W = A, Z = (RR + 1) & 0xFF
+				EmitLoad8(e, EAX, OFFSET(MainRegs.A));
+				EmitStore8(e, EAX, OFFSET(W));
+				EmitLoad8(e, EAX, rr);
+				Emit8(e, 0x04); Emit8(e, 0x01); // add al, 1
+				EmitStore8(e, EAX, OFFSET(Z));
+				cycles += 7;
+				wrote = true;
+				break;
+			}
+			case 0x0A: case 0x1A: {
+				u32 rr = Reg16Offsets[opcode >> 4];
+				EmitReadMem(e, rr);
+				EmitStore8(e, EAX, OFFSET(MainRegs.A));
+				EmitLoad16(e, EAX, rr);
+				Emit8(e, 0xFF); Emit8(e, 0xC0); // inc eax
+				EmitStore16(e, EAX, OFFSET(WZ));
+				cycles += 7;
+				break;
+			}
+			case 0x32:
+				EmitWriteMemImmAddr(e, nn, OFFSET(MainRegs.A));
+				EmitLoad8(e, EAX, OFFSET(MainRegs.A));
+				EmitStore8(e, EAX, OFFSET(W));
+				EmitStoreImm8(e, OFFSET(Z), (u8)(n1 + 1));
+				cycles += 13;
+				wrote = true;
+				break;
+			case 0x3A:
+				EmitReadMemImm(e, nn);
+				EmitStore8(e, EAX, OFFSET(MainRegs.A));
+				EmitStoreImm16(e, OFFSET(WZ), nn + 1);
+				cycles += 13;
+				break;
+			case 0x03: case 0x13: case 0x23: case 0x33:
+			case 0x0B: case 0x1B: case 0x2B: case 0x3B:
+				EmitIncDec16(e, Reg16Offsets[opcode >> 4], opcode & 8);
+				cycles += 6;
+				break;
+			case 0x04: case 0x0C: case 0x14: case 0x1C: case 0x24: case 0x2C: case 0x3C:
+			case 0x05: case 0x0D: case 0x15: case 0x1D: case 0x25: case 0x2D: case 0x3D:
+				EmitIncDec8(e, Reg8Offsets[opcode >> 3], opcode & 1);
+				cycles += 4;
+				break;
+			case 0x06: case 0x0E: case 0x16: case 0x1E: case 0x26: case 0x2E: case 0x3E:
+				EmitStoreImm8(e, Reg8Offsets[opcode >> 3], n1);
+				cycles += 7;
+				break;
+			case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE:
+				EmitMovImm32(e, EDX, n1);
+				EmitALU(e, (opcode >> 3) & 7);
+				cycles += 7;
+				break;
+			case 0xEB:
+				EmitLoad16(e, EAX, OFFSET(MainRegs.DE));
+				EmitLoad16(e, ECX, OFFSET(MainRegs.HL));
+				EmitStore16(e, ECX, OFFSET(MainRegs.DE));
+				EmitStore16(e, EAX, OFFSET(MainRegs.HL));
+				cycles += 4;
+				break;
+			case 0xC1: case 0xD1: case 0xE1: {
+				const u32* rr = PushPopOffsets[(opcode >> 4) - 0xC];
+				EmitPop(e, rr[0], rr[1]);
+				cycles += 10;
+				break;
+			}
+			case 0xC5: case 0xD5: case 0xE5: {
+				const u32* rr = PushPopOffsets[(opcode >> 4) - 0xC];
+				EmitIncDec16(e, OFFSET(SP), true);
+				EmitWriteMem(e, OFFSET(SP), rr[0]);
+				EmitIncDec16(e, OFFSET(SP), true);
+				EmitWriteMem(e, OFFSET(SP), rr[1]);
+				cycles += 11;
+				wrote = true;
+				break;
+			}
+			case 0xC3:
+				EmitStoreImm16(e, OFFSET(WZ), nn);
+				EmitExit(e, nn, cycles + 10);
+				terminated = true;
+				break;
+			case 0xC2: case 0xCA: case 0xD2: case 0xDA: {
+				EmitStoreImm16(e, OFFSET(WZ), nn);
+				EmitCondition(e, (opcode >> 3) & 3);
+				Emit8(e, 0x85); Emit8(e, 0xC9); // test ecx, ecx
+				u8* notTaken = EmitJcc(e, CC_Z);
+				EmitExit(e, nn, cycles + 10);
+				PatchJump(e, notTaken);
+				EmitExit(e, next, cycles + 10);
+				terminated = true;
+				break;
+			}
+			case 0xCD:
+				EmitStoreImm16(e, OFFSET(WZ), nn);
+				EmitIncDec16(e, OFFSET(SP), true);
+				EmitWriteMemImmVal(e, OFFSET(SP), next >> 8);
+				EmitIncDec16(e, OFFSET(SP), true);
+				EmitWriteMemImmVal(e, OFFSET(SP), next & 0xFF);
+				EmitExit(e, nn, cycles + 17);
+				terminated = true;
+				break;
+			case 0xC9:
+				EmitPop(e, OFFSET(PCH), OFFSET(PCL));
+				EmitLoad16(e, EAX, OFFSET(PC));
+				EmitStore16(e, EAX, OFFSET(WZ));
+				EmitReturn(e, cycles + 10);
+				terminated = true;
+				break;
+			case 0xC0: case 0xC8: case 0xD0: case 0xD8: {
+				EmitCondition(e, (opcode >> 3) & 3);
+				Emit8(e, 0x85); Emit8(e, 0xC9); // test ecx, ecx
+				u8* notTaken = EmitJcc(e, CC_Z);
+				EmitPop(e, OFFSET(PCH), OFFSET(PCL));
+				EmitLoad16(e, EAX, OFFSET(PC));
+				EmitStore16(e, EAX, OFFSET(WZ));
+				EmitReturn(e, cycles + 11);
+				PatchJump(e, notTaken);
+				EmitExit(e, next, cycles + 5);
+				terminated = true;
+				break;
+			}
+			case 0x18: {
+				u16 target = next + (s8)n1;
+				EmitStoreImm16(e, OFFSET(WZ), target);
+				EmitExit(e, target, cycles + 12);
+				terminated = true;
+				break;
+			}
+			case 0x10: case 0x20: case 0x28: case 0x30: case 0x38: {
+				u16 target = next + (s8)n1;
+				u8* notTaken;
+				if (opcode == 0x10) {
+					Emit8(e, 0xFE); EmitRBX(e, 1, OFFSET(MainRegs.B)); // dec byte [b]
+					notTaken = EmitJcc(e, CC_Z);
+				} else {
+					EmitCondition(e, (opcode >> 3) & 3);
+					Emit8(e, 0x85); Emit8(e, 0xC9); // test ecx, ecx
+					notTaken = EmitJcc(e, CC_Z);
+				}
+				u32 base = opcode == 0x10 ? 8 : 7;
+				EmitStoreImm16(e, OFFSET(WZ), target);
+				EmitExit(e, target, cycles + base + 5);
+				PatchJump(e, notTaken);
+				EmitExit(e, next, cycles + base);
+				terminated = true;
+				break;
+			}
+			default: {
+				u8 dst = (opcode >> 3) & 7, src = opcode & 7;
+				if (opcode < 0x80) {
+					if (src == 6) {
+						EmitReadMem(e, OFFSET(MainRegs.HL));
+						EmitStore8(e, EAX, Reg8Offsets[dst]);
+						cycles += 7;
+					} else if (dst == 6) {
+						EmitWriteMem(e, OFFSET(MainRegs.HL), Reg8Offsets[src]);
+						cycles += 7;
+						wrote = true;
+					} else {
+						EmitLoad8(e, EAX, Reg8Offsets[src]);
+						EmitStore8(e, EAX, Reg8Offsets[dst]);
+						cycles += 4;
+					}
+				} else {
+					if (src == 6) {
+						EmitReadMem(e, OFFSET(MainRegs.HL));
+						Emit8(e, 0x0F); Emit8(e, 0xB6); Emit8(e, 0xD0); // movzx edx, al
+						cycles += 7;
+					} else {
+						EmitLoad8(e, EDX, Reg8Offsets[src]);
+						cycles += 4;
+					}
+					EmitALU(e, dst);
+				}
+				break;
+			}
+		}
+
+		pc = next;
+
+		// a write could have modified this block's own code
+		if (inRAM && wrote) {
+			break;
+		}
+	}
+
+	if (!count) {
+		return NULL;
+	}
+
+	if (inRAM) {
+		// blocks depend on the page's contents just like decoded instructions
+		TI83->DecodedPages[start >> 8] = true;
+		TI83->DecodedPages[last >> 8] = true;
+	}
+
+	DecodedOp_t* decoded = &TI83->DecodePtrs[start >> 14][start];
+	decoded->Kind = DECODE_BLOCK;
+	decoded->Opcode = ReadMem(TI83, start);
+	decoded->Operand[0] = ReadMem(TI83, start + 1);
+	decoded->Operand[1] = ReadMem(TI83, last);
+
+	if (!terminated) {
+		EmitExit(e, pc, cycles);
+	}
+
+	memcpy(&block->Code, &code, sizeof (block->Code));
+	block->LastStart = lastStart;
+	block->Fetches = count;
+	jit->ArenaUsed += ((u32)(e->Ptr - (u8*)block) + 15) & ~15u;
+	return block;
+}
+
+bool SetJITEnabled(TI83_t* TI83, bool enabled) {
+	if (enabled && !TI83->JIT) {
+		JIT_t* jit = calloc(1, sizeof (JIT_t));
+		if (!jit) {
+			return false;
+		}
+#if defined(_WIN32)
+		jit->Arena = VirtualAlloc(NULL, JIT_ARENA_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+		jit->Arena = mmap(NULL, JIT_ARENA_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (jit->Arena == MAP_FAILED) {
+			jit->Arena = NULL;
+		}
+#endif
+		if (!jit->Arena) {
+			free(jit);
+			return false;
+		}
+		TI83->JIT = jit;
+	}
+
+	if (!enabled) {
+		// drops the DECODE_BLOCK marks, which would otherwise keep the interpreter off its fast path
+		FlushJIT(TI83);
+	}
+
+	TI83->JITEnabled = enabled;
+	return true;
+}
+
+void DestroyJIT(TI83_t* TI83) {
+	if (TI83->JIT) {
+#if defined(_WIN32)
+		VirtualFree(TI83->JIT->Arena, 0, MEM_RELEASE);
+#else
+		munmap(TI83->JIT->Arena, JIT_ARENA_SIZE);
+#endif
+		free(TI83->JIT);
+		TI83->JIT = NULL;
+	}
+}
+
+void FlushJIT(TI83_t* TI83) {
+	if (TI83->JIT) {
+		TI83->JIT->ArenaUsed = 0;
+		memset(TI83->JIT->Blocks, 0, sizeof (TI83->JIT->Blocks));
+		memset(TI83->DecodeCache, 0, (sizeof (TI83->ROM) + sizeof (TI83->RAM)) * sizeof (DecodedOp_t));
+	}
+}
+
+void InvalidateJITPage(TI83_t* TI83, u8 page) {
+	if (TI83->JIT) {
+		u32 start = 0x40000 + (page << 8) - 0x8000;
+		memset(&TI83->JIT->Blocks[start], 0, 0x100 * sizeof (JITBlock_t*));
+	}
+}
+
+bool RunJITBlock(TI83_t* TI83, u64* cycleCount) {
+	// callbacks and the memory log need to see every access (and breakpoints every instruction), so they're left to the interpreter
+	if (TI83->ReadCallback || TI83->WriteCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints) {
+		return false;
+	}
+
+	JIT_t* jit = TI83->JIT;
+	u32 index = BlockIndex(TI83, TI83->PC);
+	JITBlock_t* block = jit->Blocks[index];
+	if (!block) {
+		// page 0 shares its decode cache between both banks, so a block compiled for the other one is compiled again for this one
+		u8 kind = TI83->DecodePtrs[TI83->PC >> 14][TI83->PC].Kind;
+		if (kind != DECODE_NONE && kind != DECODE_BLOCK) {
+			return false;
+		}
+
+		// first time here, if this can't start a block the interpreter decodes it as usual and won't ask again
+		block = CompileBlock(TI83, TI83->PC);
+		if (!block) {
+			return false;
+		}
+
+		// compiling may have flushed the table, so the index is only written afterwards
+		jit->Blocks[index] = block;
+	}
+
+	if (*cycleCount + block->LastStart >= TI83->NextEventTime) {
+		return false;
+	}
+
+	*cycleCount += block->Code(TI83);
+	TI83->R = (TI83->R & 0x80) | ((TI83->R + block->Fetches) & 0x7F);
+	return true;
+}
+
+#else
+
+bool SetJITEnabled(TI83_t* TI83, bool enabled) {
+	(void)TI83;
+	return !enabled;
+}
+
+void DestroyJIT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+void FlushJIT(TI83_t* TI83) {
+	(void)TI83;
+}
+
+void InvalidateJITPage(TI83_t* TI83, u8 page) {
+	(void)TI83;
+	(void)page;
+}
+
+bool RunJITBlock(TI83_t* TI83, u64* cycleCount) {
+	(void)TI83;
+	(void)cycleCount;
+	return false;
+}
+
+#endif
@@ -0,0 +1,41 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef JIT_H
+#define JIT_H
+
+#include "ti83.h"
+
+// the recompiler only knows how to emit x86-64
+#if defined(EMU83_JIT) && (defined(__x86_64__) || defined(_M_X64))
+	#define JIT_SUPPORTED
+#endif
+
+bool SetJITEnabled(TI83_t* TI83, bool enabled);
+void DestroyJIT(TI83_t* TI83);
+void FlushJIT(TI83_t* TI83);
+void InvalidateJITPage(TI83_t* TI83, u8 page);
+bool RunJITBlock(TI83_t* TI83, u64* cycleCount);
+
+#endif
@@ -25,13 +25,115 @@ SOFTWARE.
 #include "ti83.h"
 #include "events.h"
 #include "link.h"
+#include "jit.h"
 
 u8 ReadMem(TI83_t* TI83, u16 addr) {
 	return TI83->ReadPtrs[addr >> 14][addr];
 }
 
+NOINLINE void InvalidateDecodedRAMPage(TI83_t* TI83, u8 page) {
+	// a decoded instruction spans up to 4 bytes, so the previous page's last 3 might also have read from this page
+	u32 start = page > 0x80 ? (page << 8) - 3 : 0x8000;
+	u32 end = (page << 8) + 0x100;
+	memset(&TI83->DecodePtrs[2][start], 0, (end - start) * sizeof (DecodedOp_t));
+	InvalidateJITPage(TI83, page);
+	TI83->DecodedPages[page] = false;
+}
+
 void WriteMem(TI83_t* TI83, u16 addr, u8 val) {
 	TI83->WritePtrs[addr >> 14][addr] = val;
+	if (UNLIKELY(TI83->DecodedPages[addr >> 8])) {
+		InvalidateDecodedRAMPage(TI83, addr >> 8);
+	}
+}
+
+// copies len bytes exactly like repeated LDI (or LDD if dec) would, without going through ReadMem/WriteMem for each
+// so an overlapping copy that runs into bytes it already wrote repeats them, rather than acting like memmove
+void BulkCopyMem(TI83_t* TI83, u16 dst, u16 src, u32 len, bool dec) {
+	while (len) {
+		// neither address may leave its 16KB region (or wrap) within a chunk
+		u32 chunk = len;
+		u32 srcLeft = dec ? (src & 0x3FFFu) + 1 : 0x4000 - (src & 0x3FFFu);
+		u32 dstLeft = dec ? (dst & 0x3FFFu) + 1 : 0x4000 - (dst & 0x3FFFu);
+		if (chunk > srcLeft) chunk = srcLeft;
+		if (chunk > dstLeft) chunk = dstLeft;
+
+		const u8* s = &TI83->ReadPtrs[src >> 14][src];
+		u8* d = &TI83->WritePtrs[dst >> 14][dst];
+		if (!dec) {
+			if ((uintptr_t)d > (uintptr_t)s && (uintptr_t)d < (uintptr_t)s + chunk) {
+				for (u32 i = 0; i < chunk; i++) {
+					d[i] = s[i];
+				}
+			} else {
+				memmove(d, s, chunk);
+			}
+		} else {
+			if ((uintptr_t)d < (uintptr_t)s && (uintptr_t)d + chunk > (uintptr_t)s) {
+				for (u32 i = 0; i < chunk; i++) {
+					*(d - i) = *(s - i);
+				}
+			} else {
+				memmove(d - (chunk - 1), s - (chunk - 1), chunk);
+			}
+		}
+
+		u16 low = dec ? dst - (chunk - 1) : dst;
+		for (u32 page = low >> 8; page <= (low + chunk - 1u) >> 8; page++) {
+			if (TI83->DecodedPages[page]) {
+				InvalidateDecodedRAMPage(TI83, page);
+			}
+		}
+
+		src = dec ? src - chunk : src + chunk;
+		dst = dec ? dst - chunk : dst + chunk;
+		len -= chunk;
+	}
+}
+
+// counts the bytes from addr (going up, or down if dec) before the first one equal to val, giving up after len
+u32 ScanMem(TI83_t* TI83, u16 addr, u32 len, u8 val, bool dec) {
+	u32 count = 0;
+	while (count < len) {
+		u32 chunk = dec ? (addr & 0x3FFFu) + 1 : 0x4000 - (addr & 0x3FFFu);
+		if (chunk > len - count) chunk = len - count;
+
+		const u8* p = &TI83->ReadPtrs[addr >> 14][addr];
+		if (!dec) {
+			const u8* found = memchr(p, val, chunk);
+			if (found) {
+				return count + (u32)(found - p);
+			}
+		} else {
+			for (u32 i = 0; i < chunk; i++) {
+				if (*(p - i) == val) {
+					return count + i;
+				}
+			}
+		}
+
+		addr = dec ? addr - chunk : addr + chunk;
+		count += chunk;
+	}
+
+	return len;
+}
+
+// hands the records logged so far to the host, and starts the buffer over (see TI83_SetMemoryLog)
+void FlushMemoryLog(TI83_t* TI83) {
+	u32 length = TI83->MemoryLogLength;
+	if (length) {
+		TI83->MemoryLogLength = 0;
+		TI83->MemoryLogCallback(TI83->CallbackUserdata, TI83->MemoryLog, length);
+	}
+}
+
+void InvalidateDecodedRAM(TI83_t* TI83) {
+	for (u32 i = 0x80; i < 0x100; i++) {
+		if (TI83->DecodedPages[i]) {
+			InvalidateDecodedRAMPage(TI83, i);
+		}
+	}
 }
 
 static void DispMove(TI83_t* TI83) {
@@ -48,6 +150,7 @@ static void DispMove(TI83_t* TI83) {
 
 static void SetROMPagePtr(TI83_t* TI83) {
 	TI83->ReadPtrs[1] = TI83->ROM + (0x4000 * TI83->ROMPage) - 0x4000;
+	TI83->DecodePtrs[1] = TI83->DecodeCache + (0x4000 * TI83->ROMPage) - 0x4000;
 }
 
 static u32 TimerPeriods[16] = {
@@ -67,6 +170,48 @@ typedef enum {
 	PORT_DISPDATA = 17,
 } Port_t;
 
+static u8 ReadDispData(TI83_t* TI83) {
+	if (TI83->CursorMoved) {
+		TI83->CursorMoved = false;
+		return 0x00;
+	}
+
+	u8 ret;
+	if (TI83->DisplayMode) {
+		ret = TI83->VRAM[(TI83->DisplayY * 12) + TI83->DisplayX];
+	} else {
+		u32 column = 6 * TI83->DisplayX;
+		u32 offset = TI83->DisplayY * 12 + (column >> 3);
+		u32 shift = 10 - (column & 7);
+		ret = ((TI83->VRAM[offset] << 8) | TI83->VRAM[offset + 1]) >> shift;
+	}
+
+	DispMove(TI83);
+	return ret;
+}
+
+static void WriteDispData(TI83_t* TI83, u8 val) {
+	if (TI83->DisplayMode) {
+		TI83->VRAM[TI83->DisplayY * 12 + TI83->DisplayX] = val;
+	} else {
+		u32 column = 6 * TI83->DisplayX;
+		u32 offset = TI83->DisplayY * 12 + (column >> 3);
+		if (offset < 0x300) {
+			u32 shift = column & 7;
+			u32 mask = ~(252 >> shift);
+			u32 data = val << 2;
+			TI83->VRAM[offset] = (TI83->VRAM[offset] & mask) | (data >> shift);
+			if (shift > 2 && offset < 0x2FF) {
+				++offset;
+				shift = 8 - shift;
+				mask = ~(252 << shift);
+				TI83->VRAM[offset] = (TI83->VRAM[offset] & mask) | (data << shift);
+			}
+		}
+	}
+	DispMove(TI83);
+}
+
 u8 ReadPort(TI83_t* TI83, u8 port) {
 	switch (port) {
 		case PORT_LINK:
@@ -78,7 +223,7 @@ u8 ReadPort(TI83_t* TI83, u8 port) {
 		case PORT_KEYBOARD:
 		{
 			TI83->Lagged = false;
-			return TI83->InputCallback ? TI83->InputCallback(TI83->KeyboardMask) : 0xFF;
+			return TI83->InputCallback ? TI83->InputCallback(TI83->CallbackUserdata, TI83->KeyboardMask) : 0xFF;
 		}
 		case PORT_ROMPAGE:
 		{
@@ -94,23 +239,7 @@ u8 ReadPort(TI83_t* TI83, u8 port) {
 		}
 		case PORT_DISPDATA:
 		{
-			if (TI83->CursorMoved) {
-				TI83->CursorMoved = false;
-				return 0x00;
-			}
-
-			u8 ret;
-			if (TI83->DisplayMode) {
-				ret = TI83->VRAM[(TI83->DisplayY * 12) + TI83->DisplayX];
-			} else {
-				u32 column = 6 * TI83->DisplayX;
-				u32 offset = TI83->DisplayY * 12 + (column >> 3);
-				u32 shift = 10 - (column & 7);
-				ret = ((TI83->VRAM[offset] << 8) | TI83->VRAM[offset + 1]) >> shift;
-			}
-
-			DispMove(TI83);
-			return ret;
+			return ReadDispData(TI83);
 		}
 	}
 
@@ -186,26 +315,55 @@ void WritePort(TI83_t* TI83, u8 port, u8 val, u64 cycleCount) {
 		}
 		case PORT_DISPDATA:
 		{
-			if (TI83->DisplayMode) {
-				TI83->VRAM[TI83->DisplayY * 12 + TI83->DisplayX] = val;
-			} else {
-				u32 column = 6 * TI83->DisplayX;
-				u32 offset = TI83->DisplayY * 12 + (column >> 3);
-				if (offset < 0x300) {
-					u32 shift = column & 7;
-					u32 mask = ~(252 >> shift);
-					u32 data = val << 2;
-					TI83->VRAM[offset] = (TI83->VRAM[offset] & mask) | (data >> shift);
-					if (shift > 2 && offset < 0x2FF) {
-						++offset;
-						shift = 8 - shift;
-						mask = ~(252 << shift);
-						TI83->VRAM[offset] = (TI83->VRAM[offset] & mask) | (data << shift);
-					}
-				}
-			}
-			DispMove(TI83);
+			WriteDispData(TI83, val);
 			break;
 		}
 	}
 }
+
+// whether reading a port again returns the same value and changes nothing, until the next event or frame
+bool PortReadIsPure(TI83_t* TI83, u8 port) {
+	switch (port) {
+		case PORT_LINK:
+		case PORT_INTCTRL:
+		{
+			return TI83->LinkStatus == LINK_INACTIVE; // otherwise every read steps the link
+		}
+		case PORT_DISPDATA:
+		{
+			return false; // moves the cursor
+		}
+		default:
+		{
+			return true;
+		}
+	}
+}
+
+// block transfers for INIR/INDR and OTIR/OTDR, the same as reading/writing each byte in turn
+// only ports where the time of each access doesn't matter are handled (i.e. display data)
+// anything else returns false, having done nothing, and is left to go a byte at a time
+
+bool ReadPortBlock(TI83_t* TI83, u8 port, u8* data, u32 len) {
+	if (port != PORT_DISPDATA) {
+		return false;
+	}
+
+	for (u32 i = 0; i < len; i++) {
+		data[i] = ReadDispData(TI83);
+	}
+
+	return true;
+}
+
+bool WritePortBlock(TI83_t* TI83, u8 port, const u8* data, u32 len) {
+	if (port != PORT_DISPDATA) {
+		return false;
+	}
+
+	for (u32 i = 0; i < len; i++) {
+		WriteDispData(TI83, data[i]);
+	}
+
+	return true;
+}
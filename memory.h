@@ -29,8 +29,16 @@ SOFTWARE.
 
 u8 ReadMem(TI83_t* TI83, u16 addr);
 void WriteMem(TI83_t* TI83, u16 addr, u8 val);
+void InvalidateDecodedRAMPage(TI83_t* TI83, u8 page);
+void InvalidateDecodedRAM(TI83_t* TI83);
+void BulkCopyMem(TI83_t* TI83, u16 dst, u16 src, u32 len, bool dec);
+u32 ScanMem(TI83_t* TI83, u16 addr, u32 len, u8 val, bool dec);
+void FlushMemoryLog(TI83_t* TI83);
 
 u8 ReadPort(TI83_t* TI83, u8 port);
 void WritePort(TI83_t* TI83, u8 port, u8 val, u64 cycleCount);
+bool PortReadIsPure(TI83_t* TI83, u8 port);
+bool ReadPortBlock(TI83_t* TI83, u8 port, u8* data, u32 len);
+bool WritePortBlock(TI83_t* TI83, u8 port, const u8* data, u32 len);
 
 #endif
@@ -0,0 +1,3795 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// the body of RunFrame, included by z80.c once per variant (see RunFrameVariant_t) with the opcode macros defined there
+// RUN_FRAME_NAME is the function to define, RUN_FRAME_VARIANT the callbacks it checks for
+// FAST_MODE is defined for the fast mode variant, which keeps WZ in a local (and not R)
+// returns false if it stopped early because a callback it doesn't check for was set mid frame, or at a breakpoint
+
+static bool RUN_FRAME_NAME(TI83_t* TI83, u64 nextFrameCycleCount) {
+	u64 eventTime;
+	s32 cyclesLeft;
+	u8 opcode;
+	const u8* operand;
+#ifdef CACHE_REGISTERS
+	Addr_t pc, sp;
+#endif
+#if defined(CACHE_REGISTERS) || defined(FAST_MODE)
+	Addr_t wz;
+#endif
+#if defined(CACHE_REGISTERS) && !defined(FAST_MODE)
+	u8 refresh;
+#endif
+
+#ifdef THREADED_DISPATCH
+	static const void* const PrefixTable[] = {
+		[DECODE_CB] = &&cb_dispatch,
+		[DECODE_DD] = &&dd_dispatch,
+		[DECODE_ED] = &&ed_dispatch,
+		[DECODE_FD] = &&fd_dispatch,
+	};
+
+	static const void* const OpcodeTable[256] = {
+		OPCODE_ROW(0), OPCODE_ROW(1), OPCODE_ROW(2), OPCODE_ROW(3),
+		OPCODE_ROW(4), OPCODE_ROW(5), OPCODE_ROW(6), OPCODE_ROW(7),
+		OPCODE_ROW(8), OPCODE_ROW(9), OPCODE_ROW(A), OPCODE_ROW(B),
+		OPCODE_ROW(C), OPCODE_ROW(D), OPCODE_ROW(E), OPCODE_ROW(F),
+	};
+
+	static const void* const FusedTable[] = {
+		FUSED_OP_LABELS
+	};
+#endif
+
+	SET_CYCLE_COUNT(TI83->CycleCount);
+	RELOAD_REGS();
+	while (CYCLE_COUNT() < nextFrameCycleCount) {
+		if (TI83->Halted) {
+			if (cyclesLeft > 0) {
+				u32 inc = cyclesLeft;
+				inc += (-inc & 3);
+				cyclesLeft -= inc;
+				ADVANCE_R(inc >> 2);
+			}
+		} else while (cyclesLeft > 0) {
+			CHECK_BREAKPOINT();
+			if (TRACE_CALLBACK && UNLIKELY(TI83->TraceCallback)) {
+				SPILL_REGS();
+				TI83->TraceCallback(TI83->CallbackUserdata, CYCLE_COUNT());
+				SYNC_BUDGET();
+			}
+#ifdef THREADED_DISPATCH
+		fetch:
+#endif
+#ifdef JIT_SUPPORTED
+			if (UNLIKELY(TI83->JITEnabled)) {
+				u8 kind = TI83->DecodePtrs[REGS(PC) >> 14][REGS(PC)].Kind;
+				if (kind == DECODE_BLOCK || kind == DECODE_NONE) {
+					u64 cycleCount = CYCLE_COUNT();
+					SPILL_REGS();
+					if (RunJITBlock(TI83, &cycleCount)) {
+						RELOAD_REGS();
+						SET_CYCLE_COUNT(cycleCount);
+						TI83->IdleLoop.End = 0; // its branches aren't watched
+						continue;
+					}
+				}
+			}
+#endif
+			if (UNLIKELY(TI83->AOTEnabled)) {
+				u8 kind = TI83->DecodePtrs[REGS(PC) >> 14][REGS(PC)].Kind;
+				if (kind == DECODE_BLOCK || kind == DECODE_NONE) {
+					u64 cycleCount = CYCLE_COUNT();
+					SPILL_REGS();
+					if (RunAOTBlock(TI83, &cycleCount)) {
+						RELOAD_REGS();
+						SET_CYCLE_COUNT(cycleCount);
+						TI83->IdleLoop.End = 0;
+						continue;
+					}
+				}
+			}
+			FETCH_OPCODE();
+			switch (opcode) {
+				// nop
+				OPCODE(0x00): NEXT_OPCODE();
+				// ld bc,nn
+				OPCODE(0x01): LD_RR_NN(B, C); NEXT_OPCODE();
+				// ld (bc),a
+				OPCODE(0x02): LD_DRR_A(BC); NEXT_OPCODE();
+				// inc bc
+				OPCODE(0x03): INC_RR(BC); NEXT_OPCODE();
+				// inc b
+				OPCODE(0x04): INC_R(B); NEXT_OPCODE();
+				// dec b
+				OPCODE(0x05): DEC_R(B); NEXT_OPCODE();
+				// ld b,n
+				OPCODE(0x06): LD_R_N(B); NEXT_OPCODE();
+				// rlca
+				OPCODE(0x07): RLCA(); NEXT_OPCODE();
+				// ex af,af'
+				OPCODE(0x08): EX_AF_AF(); NEXT_OPCODE();
+				// add hl,bc
+				OPCODE(0x09): ADD_RR_RR(HL, BC); NEXT_OPCODE();
+				// ld a,(bc)
+				OPCODE(0x0A): LD_A_DRR(BC); NEXT_OPCODE();
+				// dec bc
+				OPCODE(0x0B): DEC_RR(BC); NEXT_OPCODE();
+				// inc c
+				OPCODE(0x0C): INC_R(C); NEXT_OPCODE();
+				// dec c
+				OPCODE(0x0D): DEC_R(C); NEXT_OPCODE();
+				// ld c,n
+				OPCODE(0x0E): LD_R_N(C); NEXT_OPCODE();
+				// rrca
+				OPCODE(0x0F): RRCA(); NEXT_OPCODE();
+				// djnz e
+				OPCODE(0x10): DJNZ_E(); NEXT_OPCODE();
+				// ld de,nn
+				OPCODE(0x11): LD_RR_NN(D, E); NEXT_OPCODE();
+				// ld (de),a
+				OPCODE(0x12): LD_DRR_A(DE); NEXT_OPCODE();
+				// inc de
+				OPCODE(0x13): INC_RR(DE); NEXT_OPCODE();
+				// inc d
+				OPCODE(0x14): INC_R(D); NEXT_OPCODE();
+				// dec d
+				OPCODE(0x15): DEC_R(D); NEXT_OPCODE();
+				// ld d,n
+				OPCODE(0x16): LD_R_N(D); NEXT_OPCODE();
+				// rla
+				OPCODE(0x17): RLA(); NEXT_OPCODE();
+				// jr e
+				OPCODE(0x18): JR_CC_E(true); NEXT_OPCODE();
+				// add hl,de
+				OPCODE(0x19): ADD_RR_RR(HL, DE); NEXT_OPCODE();
+				// ld a,(de)
+				OPCODE(0x1A): LD_A_DRR(DE); NEXT_OPCODE();
+				// dec de
+				OPCODE(0x1B): DEC_RR(DE); NEXT_OPCODE();
+				// inc e
+				OPCODE(0x1C): INC_R(E); NEXT_OPCODE();
+				// dec e
+				OPCODE(0x1D): DEC_R(E); NEXT_OPCODE();
+				// ld e,n
+				OPCODE(0x1E): LD_R_N(E); NEXT_OPCODE();
+				// rra
+				OPCODE(0x1F): RRA(); NEXT_OPCODE();
+				// jr nz,e
+				OPCODE(0x20): JR_CC_E(!FLAG_ZF()); NEXT_OPCODE();
+				// ld hl,nn
+				OPCODE(0x21): LD_RR_NN(H, L); NEXT_OPCODE();
+				// ld (nn),hl
+				OPCODE(0x22): LD_DNN_RR(H, L); NEXT_OPCODE();
+				// inc hl
+				OPCODE(0x23): INC_RR(HL); NEXT_OPCODE();
+				// inc h
+				OPCODE(0x24): INC_R(H); NEXT_OPCODE();
+				// dec h
+				OPCODE(0x25): DEC_R(H); NEXT_OPCODE();
+				// ld h,n
+				OPCODE(0x26): LD_R_N(H); NEXT_OPCODE();
+				// daa
+				OPCODE(0x27): DAA(); NEXT_OPCODE();
+				// jr z,e
+				OPCODE(0x28): JR_CC_E(FLAG_ZF()); NEXT_OPCODE();
+				// add hl,hl
+				OPCODE(0x29): ADD_RR_RR(HL, HL); NEXT_OPCODE();
+				// ld hl,(nn)
+				OPCODE(0x2A): LD_RR_DNN(H, L); NEXT_OPCODE();
+				// dec hl
+				OPCODE(0x2B): DEC_RR(HL); NEXT_OPCODE();
+				// inc l
+				OPCODE(0x2C): INC_R(L); NEXT_OPCODE();
+				// dec l
+				OPCODE(0x2D): DEC_R(L); NEXT_OPCODE();
+				// ld l,n
+				OPCODE(0x2E): LD_R_N(L); NEXT_OPCODE();
+				// cpl
+				OPCODE(0x2F): CPL(); NEXT_OPCODE();
+				// jr nc,e
+				OPCODE(0x30): JR_CC_E(!FLAG_CF()); NEXT_OPCODE();
+				// ld sp,nn
+				OPCODE(0x31): LD_RR_NN(SPH, SPL); NEXT_OPCODE();
+				// ld (nn),a
+				OPCODE(0x32): LD_DNN_A(); NEXT_OPCODE();
+				// inc sp
+				OPCODE(0x33): INC_RR(SP); NEXT_OPCODE();
+				// inc (hl)
+				OPCODE(0x34): INC_DHL(); NEXT_OPCODE();
+				// dec (hl)
+				OPCODE(0x35): DEC_DHL(); NEXT_OPCODE();
+				// ld (hl),n
+				OPCODE(0x36): LD_DHL_N(); NEXT_OPCODE();
+				// scf
+				OPCODE(0x37): SCF(); NEXT_OPCODE();
+				// jr c,e
+				OPCODE(0x38): JR_CC_E(FLAG_CF()); NEXT_OPCODE();
+				// add hl,sp
+				OPCODE(0x39): ADD_RR_RR(HL, SP); NEXT_OPCODE();
+				// ld a,(nn)
+				OPCODE(0x3A): LD_A_DNN(); NEXT_OPCODE();
+				// dec sp
+				OPCODE(0x3B): DEC_RR(SP); NEXT_OPCODE();
+				// inc a
+				OPCODE(0x3C): INC_R(A); NEXT_OPCODE();
+				// dec a
+				OPCODE(0x3D): DEC_R(A); NEXT_OPCODE();
+				// ld a,n
+				OPCODE(0x3E): LD_R_N(A); NEXT_OPCODE();
+				// ccf
+				OPCODE(0x3F): CCF(); NEXT_OPCODE();
+				// ld b,b
+				OPCODE(0x40): LD_R_R(B, B); NEXT_OPCODE();
+				// ld b,c
+				OPCODE(0x41): LD_R_R(B, C); NEXT_OPCODE();
+				// ld b,d
+				OPCODE(0x42): LD_R_R(B, D); NEXT_OPCODE();
+				// ld b,e
+				OPCODE(0x43): LD_R_R(B, E); NEXT_OPCODE();
+				// ld b,h
+				OPCODE(0x44): LD_R_R(B, H); NEXT_OPCODE();
+				// ld b,l
+				OPCODE(0x45): LD_R_R(B, L); NEXT_OPCODE();
+				// ld b,(hl)
+				OPCODE(0x46): LD_R_DHL(B); NEXT_OPCODE();
+				// ld b,a
+				OPCODE(0x47): LD_R_R(B, A); NEXT_OPCODE();
+				// ld c,b
+				OPCODE(0x48): LD_R_R(C, B); NEXT_OPCODE();
+				// ld c,c
+				OPCODE(0x49): LD_R_R(C, C); NEXT_OPCODE();
+				// ld c,d
+				OPCODE(0x4A): LD_R_R(C, D); NEXT_OPCODE();
+				// ld c,e
+				OPCODE(0x4B): LD_R_R(C, E); NEXT_OPCODE();
+				// ld c,h
+				OPCODE(0x4C): LD_R_R(C, H); NEXT_OPCODE();
+				// ld c,l
+				OPCODE(0x4D): LD_R_R(C, L); NEXT_OPCODE();
+				// ld c,(hl)
+				OPCODE(0x4E): LD_R_DHL(C); NEXT_OPCODE();
+				// ld c,a
+				OPCODE(0x4F): LD_R_R(C, A); NEXT_OPCODE();
+				// ld d,b
+				OPCODE(0x50): LD_R_R(D, B); NEXT_OPCODE();
+				// ld d,c
+				OPCODE(0x51): LD_R_R(D, C); NEXT_OPCODE();
+				// ld d,d
+				OPCODE(0x52): LD_R_R(D, D); NEXT_OPCODE();
+				// ld d,e
+				OPCODE(0x53): LD_R_R(D, E); NEXT_OPCODE();
+				// ld d,h
+				OPCODE(0x54): LD_R_R(D, H); NEXT_OPCODE();
+				// ld d,l
+				OPCODE(0x55): LD_R_R(D, L); NEXT_OPCODE();
+				// ld d,(hl)
+				OPCODE(0x56): LD_R_DHL(D); NEXT_OPCODE();
+				// ld d,a
+				OPCODE(0x57): LD_R_R(D, A); NEXT_OPCODE();
+				// ld e,b
+				OPCODE(0x58): LD_R_R(E, B); NEXT_OPCODE();
+				// ld e,c
+				OPCODE(0x59): LD_R_R(E, C); NEXT_OPCODE();
+				// ld e,d
+				OPCODE(0x5A): LD_R_R(E, D); NEXT_OPCODE();
+				// ld e,e
+				OPCODE(0x5B): LD_R_R(E, E); NEXT_OPCODE();
+				// ld e,h
+				OPCODE(0x5C): LD_R_R(E, H); NEXT_OPCODE();
+				// ld e,l
+				OPCODE(0x5D): LD_R_R(E, L); NEXT_OPCODE();
+				// ld e,(hl)
+				OPCODE(0x5E): LD_R_DHL(E); NEXT_OPCODE();
+				// ld e,a
+				OPCODE(0x5F): LD_R_R(E, A); NEXT_OPCODE();
+				// ld h,b
+				OPCODE(0x60): LD_R_R(H, B); NEXT_OPCODE();
+				// ld h,c
+				OPCODE(0x61): LD_R_R(H, C); NEXT_OPCODE();
+				// ld h,d
+				OPCODE(0x62): LD_R_R(H, D); NEXT_OPCODE();
+				// ld h,e
+				OPCODE(0x63): LD_R_R(H, E); NEXT_OPCODE();
+				// ld h,h
+				OPCODE(0x64): LD_R_R(H, H); NEXT_OPCODE();
+				// ld h,l
+				OPCODE(0x65): LD_R_R(H, L); NEXT_OPCODE();
+				// ld h,(hl)
+				OPCODE(0x66): LD_R_DHL(H); NEXT_OPCODE();
+				// ld h,a
+				OPCODE(0x67): LD_R_R(H, A); NEXT_OPCODE();
+				// ld l,b
+				OPCODE(0x68): LD_R_R(L, B); NEXT_OPCODE();
+				// ld l,c
+				OPCODE(0x69): LD_R_R(L, C); NEXT_OPCODE();
+				// ld l,d
+				OPCODE(0x6A): LD_R_R(L, D); NEXT_OPCODE();
+				// ld l,e
+				OPCODE(0x6B): LD_R_R(L, E); NEXT_OPCODE();
+				// ld l,h
+				OPCODE(0x6C): LD_R_R(L, H); NEXT_OPCODE();
+				// ld l,l
+				OPCODE(0x6D): LD_R_R(L, L); NEXT_OPCODE();
+				// ld l,(hl)
+				OPCODE(0x6E): LD_R_DHL(L); NEXT_OPCODE();
+				// ld l,a
+				OPCODE(0x6F): LD_R_R(L, A); NEXT_OPCODE();
+				// ld (hl),b
+				OPCODE(0x70): LD_DHL_R(B); NEXT_OPCODE();
+				// ld (hl),c
+				OPCODE(0x71): LD_DHL_R(C); NEXT_OPCODE();
+				// ld (hl),d
+				OPCODE(0x72): LD_DHL_R(D); NEXT_OPCODE();
+				// ld (hl),e
+				OPCODE(0x73): LD_DHL_R(E); NEXT_OPCODE();
+				// ld (hl),h
+				OPCODE(0x74): LD_DHL_R(H); NEXT_OPCODE();
+				// ld (hl),l
+				OPCODE(0x75): LD_DHL_R(L); NEXT_OPCODE();
+				// halt
+				OPCODE(0x76): HALT(); NEXT_OPCODE();
+				// ld (hl),a
+				OPCODE(0x77): LD_DHL_R(A); NEXT_OPCODE();
+				// ld a,b
+				OPCODE(0x78): LD_R_R(A, B); NEXT_OPCODE();
+				// ld a,c
+				OPCODE(0x79): LD_R_R(A, C); NEXT_OPCODE();
+				// ld a,d
+				OPCODE(0x7A): LD_R_R(A, D); NEXT_OPCODE();
+				// ld a,e
+				OPCODE(0x7B): LD_R_R(A, E); NEXT_OPCODE();
+				// ld a,h
+				OPCODE(0x7C): LD_R_R(A, H); NEXT_OPCODE();
+				// ld a,l
+				OPCODE(0x7D): LD_R_R(A, L); NEXT_OPCODE();
+				// ld a,(hl)
+				OPCODE(0x7E): LD_R_DHL(A); NEXT_OPCODE();
+				// ld a,a
+				OPCODE(0x7F): LD_R_R(A, A); NEXT_OPCODE();
+				// add a,b
+				OPCODE(0x80): ADD_A_R(B); NEXT_OPCODE();
+				// add a,c
+				OPCODE(0x81): ADD_A_R(C); NEXT_OPCODE();
+				// add a,d
+				OPCODE(0x82): ADD_A_R(D); NEXT_OPCODE();
+				// add a,e
+				OPCODE(0x83): ADD_A_R(E); NEXT_OPCODE();
+				// add a,h
+				OPCODE(0x84): ADD_A_R(H); NEXT_OPCODE();
+				// add a,l
+				OPCODE(0x85): ADD_A_R(L); NEXT_OPCODE();
+				// add a,(hl)
+				OPCODE(0x86): ADD_A_DHL(); NEXT_OPCODE();
+				// add a,a
+				OPCODE(0x87): ADD_A_R(A); NEXT_OPCODE();
+				// adc a,b
+				OPCODE(0x88): ADC_A_R(B); NEXT_OPCODE();
+				// adc a,c
+				OPCODE(0x89): ADC_A_R(C); NEXT_OPCODE();
+				// adc a,d
+				OPCODE(0x8A): ADC_A_R(D); NEXT_OPCODE();
+				// adc a,e
+				OPCODE(0x8B): ADC_A_R(E); NEXT_OPCODE();
+				// adc a,h
+				OPCODE(0x8C): ADC_A_R(H); NEXT_OPCODE();
+				// adc a,l
+				OPCODE(0x8D): ADC_A_R(L); NEXT_OPCODE();
+				// adc a,(hl)
+				OPCODE(0x8E): ADC_A_DHL(); NEXT_OPCODE();
+				// adc a,a
+				OPCODE(0x8F): ADC_A_R(A); NEXT_OPCODE();
+				// sub a,b
+				OPCODE(0x90): SUB_A_R(B); NEXT_OPCODE();
+				// sub a,c
+				OPCODE(0x91): SUB_A_R(C); NEXT_OPCODE();
+				// sub a,d
+				OPCODE(0x92): SUB_A_R(D); NEXT_OPCODE();
+				// sub a,e
+				OPCODE(0x93): SUB_A_R(E); NEXT_OPCODE();
+				// sub a,h
+				OPCODE(0x94): SUB_A_R(H); NEXT_OPCODE();
+				// sub a,l
+				OPCODE(0x95): SUB_A_R(L); NEXT_OPCODE();
+				// sub a,(hl)
+				OPCODE(0x96): SUB_A_DHL(); NEXT_OPCODE();
+				// sub a,a
+				OPCODE(0x97): SUB_A_R(A); NEXT_OPCODE();
+				// sbc a,b
+				OPCODE(0x98): SBC_A_R(B); NEXT_OPCODE();
+				// sbc a,c
+				OPCODE(0x99): SBC_A_R(C); NEXT_OPCODE();
+				// sbc a,d
+				OPCODE(0x9A): SBC_A_R(D); NEXT_OPCODE();
+				// sbc a,e
+				OPCODE(0x9B): SBC_A_R(E); NEXT_OPCODE();
+				// sbc a,h
+				OPCODE(0x9C): SBC_A_R(H); NEXT_OPCODE();
+				// sbc a,l
+				OPCODE(0x9D): SBC_A_R(L); NEXT_OPCODE();
+				// sbc a,(hl)
+				OPCODE(0x9E): SBC_A_DHL(); NEXT_OPCODE();
+				// sbc a,a
+				OPCODE(0x9F): SBC_A_R(A); NEXT_OPCODE();
+				// and a,b
+				OPCODE(0xA0): AND_A_R(B); NEXT_OPCODE();
+				// and a,c
+				OPCODE(0xA1): AND_A_R(C); NEXT_OPCODE();
+				// and a,d
+				OPCODE(0xA2): AND_A_R(D); NEXT_OPCODE();
+				// and a,e
+				OPCODE(0xA3): AND_A_R(E); NEXT_OPCODE();
+				// and a,h
+				OPCODE(0xA4): AND_A_R(H); NEXT_OPCODE();
+				// and a,l
+				OPCODE(0xA5): AND_A_R(L); NEXT_OPCODE();
+				// and a,(hl)
+				OPCODE(0xA6): AND_A_DHL(); NEXT_OPCODE();
+				// and a,a
+				OPCODE(0xA7): AND_A_R(A); NEXT_OPCODE();
+				// xor a,b
+				OPCODE(0xA8): XOR_A_R(B); NEXT_OPCODE();
+				// xor a,c
+				OPCODE(0xA9): XOR_A_R(C); NEXT_OPCODE();
+				// xor a,d
+				OPCODE(0xAA): XOR_A_R(D); NEXT_OPCODE();
+				// xor a,e
+				OPCODE(0xAB): XOR_A_R(E); NEXT_OPCODE();
+				// xor a,h
+				OPCODE(0xAC): XOR_A_R(H); NEXT_OPCODE();
+				// xor a,l
+				OPCODE(0xAD): XOR_A_R(L); NEXT_OPCODE();
+				// xor a,(hl)
+				OPCODE(0xAE): XOR_A_DHL(); NEXT_OPCODE();
+				// xor a,a
+				OPCODE(0xAF): XOR_A_R(A); NEXT_OPCODE();
+				// or a,b
+				OPCODE(0xB0): OR_A_R(B); NEXT_OPCODE();
+				// or a,c
+				OPCODE(0xB1): OR_A_R(C); NEXT_OPCODE();
+				// or a,d
+				OPCODE(0xB2): OR_A_R(D); NEXT_OPCODE();
+				// or a,e
+				OPCODE(0xB3): OR_A_R(E); NEXT_OPCODE();
+				// or a,h
+				OPCODE(0xB4): OR_A_R(H); NEXT_OPCODE();
+				// or a,l
+				OPCODE(0xB5): OR_A_R(L); NEXT_OPCODE();
+				// or a,(hl)
+				OPCODE(0xB6): OR_A_DHL(); NEXT_OPCODE();
+				// or a,a
+				OPCODE(0xB7): OR_A_R(A); NEXT_OPCODE();
+				// cp a,b
+				OPCODE(0xB8): CP_A_R(B); NEXT_OPCODE();
+				// cp a,c
+				OPCODE(0xB9): CP_A_R(C); NEXT_OPCODE();
+				// cp a,d
+				OPCODE(0xBA): CP_A_R(D); NEXT_OPCODE();
+				// cp a,e
+				OPCODE(0xBB): CP_A_R(E); NEXT_OPCODE();
+				// cp a,h
+				OPCODE(0xBC): CP_A_R(H); NEXT_OPCODE();
+				// cp a,l
+				OPCODE(0xBD): CP_A_R(L); NEXT_OPCODE();
+				// cp a,(hl)
+				OPCODE(0xBE): CP_A_DHL(); NEXT_OPCODE();
+				// cp a,a
+				OPCODE(0xBF): CP_A_R(A); NEXT_OPCODE();
+				// ret nz
+				OPCODE(0xC0): RET_CC(!FLAG_ZF()); NEXT_OPCODE();
+				// pop bc
+				OPCODE(0xC1): POP(B, C); NEXT_OPCODE();
+				// jp nz,nn
+				OPCODE(0xC2): JP_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+				// jp nn
+				OPCODE(0xC3): JP_CC_NN(true); NEXT_OPCODE();
+				// call nz,nn
+				OPCODE(0xC4): CALL_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+				// push bc
+				OPCODE(0xC5): PUSH(B, C); NEXT_OPCODE();
+				// add a,n
+				OPCODE(0xC6): ADD_A_N(); NEXT_OPCODE();
+				// rst 0x00
+				OPCODE(0xC7): RST(0x00); NEXT_OPCODE();
+				// ret z
+				OPCODE(0xC8): RET_CC(FLAG_ZF()); NEXT_OPCODE();
+				// ret
+				OPCODE(0xC9): RET(); NEXT_OPCODE();
+				// jp z,nn
+				OPCODE(0xCA): JP_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+				// 0xCB prefix
+				OPCODE(0xCB):
+				{
+					FETCH(opcode, REGS(PC)++);
+				cb_dispatch:
+					switch (opcode) {
+						// rlc b
+						case 0x00: RLC_R(B); NEXT_OPCODE();
+						// rlc c
+						case 0x01: RLC_R(C); NEXT_OPCODE();
+						// rlc d
+						case 0x02: RLC_R(D); NEXT_OPCODE();
+						// rlc e
+						case 0x03: RLC_R(E); NEXT_OPCODE();
+						// rlc h
+						case 0x04: RLC_R(H); NEXT_OPCODE();
+						// rlc l
+						case 0x05: RLC_R(L); NEXT_OPCODE();
+						// rlc (hl)
+						case 0x06: RLC_DHL(); NEXT_OPCODE();
+						// rlc a
+						case 0x07: RLC_R(A); NEXT_OPCODE();
+						// rrc b
+						case 0x08: RRC_R(B); NEXT_OPCODE();
+						// rrc c
+						case 0x09: RRC_R(C); NEXT_OPCODE();
+						// rrc d
+						case 0x0A: RRC_R(D); NEXT_OPCODE();
+						// rrc e
+						case 0x0B: RRC_R(E); NEXT_OPCODE();
+						// rrc h
+						case 0x0C: RRC_R(H); NEXT_OPCODE();
+						// rrc l
+						case 0x0D: RRC_R(L); NEXT_OPCODE();
+						// rrc (hl)
+						case 0x0E: RRC_DHL(); NEXT_OPCODE();
+						// rrc a
+						case 0x0F: RRC_R(A); NEXT_OPCODE();
+						// rl b
+						case 0x10: RL_R(B); NEXT_OPCODE();
+						// rl c
+						case 0x11: RL_R(C); NEXT_OPCODE();
+						// rl d
+						case 0x12: RL_R(D); NEXT_OPCODE();
+						// rl e
+						case 0x13: RL_R(E); NEXT_OPCODE();
+						// rl h
+						case 0x14: RL_R(H); NEXT_OPCODE();
+						// rl l
+						case 0x15: RL_R(L); NEXT_OPCODE();
+						// rl (hl)
+						case 0x16: RL_DHL(); NEXT_OPCODE();
+						// rl a
+						case 0x17: RL_R(A); NEXT_OPCODE();
+						// rr b
+						case 0x18: RR_R(B); NEXT_OPCODE();
+						// rr c
+						case 0x19: RR_R(C); NEXT_OPCODE();
+						// rr d
+						case 0x1A: RR_R(D); NEXT_OPCODE();
+						// rr e
+						case 0x1B: RR_R(E); NEXT_OPCODE();
+						// rr h
+						case 0x1C: RR_R(H); NEXT_OPCODE();
+						// rr l
+						case 0x1D: RR_R(L); NEXT_OPCODE();
+						// rr (hl)
+						case 0x1E: RR_DHL(); NEXT_OPCODE();
+						// rr a
+						case 0x1F: RR_R(A); NEXT_OPCODE();
+						// sla b
+						case 0x20: SLA_R(B); NEXT_OPCODE();
+						// sla c
+						case 0x21: SLA_R(C); NEXT_OPCODE();
+						// sla d
+						case 0x22: SLA_R(D); NEXT_OPCODE();
+						// sla e
+						case 0x23: SLA_R(E); NEXT_OPCODE();
+						// sla h
+						case 0x24: SLA_R(H); NEXT_OPCODE();
+						// sla l
+						case 0x25: SLA_R(L); NEXT_OPCODE();
+						// sla (hl)
+						case 0x26: SLA_DHL(); NEXT_OPCODE();
+						// sla a
+						case 0x27: SLA_R(A); NEXT_OPCODE();
+						// sra b
+						case 0x28: SRA_R(B); NEXT_OPCODE();
+						// sra c
+						case 0x29: SRA_R(C); NEXT_OPCODE();
+						// sra d
+						case 0x2A: SRA_R(D); NEXT_OPCODE();
+						// sra e
+						case 0x2B: SRA_R(E); NEXT_OPCODE();
+						// sra h
+						case 0x2C: SRA_R(H); NEXT_OPCODE();
+						// sra l
+						case 0x2D: SRA_R(L); NEXT_OPCODE();
+						// sra (hl)
+						case 0x2E: SRA_DHL(); NEXT_OPCODE();
+						// sra a
+						case 0x2F: SRA_R(A); NEXT_OPCODE();
+						// sll b
+						case 0x30: SLL_R(B); NEXT_OPCODE();
+						// sll c
+						case 0x31: SLL_R(C); NEXT_OPCODE();
+						// sll d
+						case 0x32: SLL_R(D); NEXT_OPCODE();
+						// sll e
+						case 0x33: SLL_R(E); NEXT_OPCODE();
+						// sll h
+						case 0x34: SLL_R(H); NEXT_OPCODE();
+						// sll l
+						case 0x35: SLL_R(L); NEXT_OPCODE();
+						// sll (hl)
+						case 0x36: SLL_DHL(); NEXT_OPCODE();
+						// sll a
+						case 0x37: SLL_R(A); NEXT_OPCODE();
+						// srl b
+						case 0x38: SRL_R(B); NEXT_OPCODE();
+						// srl c
+						case 0x39: SRL_R(C); NEXT_OPCODE();
+						// srl d
+						case 0x3A: SRL_R(D); NEXT_OPCODE();
+						// srl e
+						case 0x3B: SRL_R(E); NEXT_OPCODE();
+						// srl h
+						case 0x3C: SRL_R(H); NEXT_OPCODE();
+						// srl l
+						case 0x3D: SRL_R(L); NEXT_OPCODE();
+						// srl (hl)
+						case 0x3E: SRL_DHL(); NEXT_OPCODE();
+						// srl a
+						case 0x3F: SRL_R(A); NEXT_OPCODE();
+						// bit 0,b
+						case 0x40: BIT_N_R(0, B); NEXT_OPCODE();
+						// bit 0,c
+						case 0x41: BIT_N_R(0, C); NEXT_OPCODE();
+						// bit 0,d
+						case 0x42: BIT_N_R(0, D); NEXT_OPCODE();
+						// bit 0,e
+						case 0x43: BIT_N_R(0, E); NEXT_OPCODE();
+						// bit 0,h
+						case 0x44: BIT_N_R(0, H); NEXT_OPCODE();
+						// bit 0,l
+						case 0x45: BIT_N_R(0, L); NEXT_OPCODE();
+						// bit 0,(hl)
+						case 0x46: BIT_N_DHL(0); NEXT_OPCODE();
+						// bit 0,a
+						case 0x47: BIT_N_R(0, A); NEXT_OPCODE();
+						// bit 1,b
+						case 0x48: BIT_N_R(1, B); NEXT_OPCODE();
+						// bit 1,c
+						case 0x49: BIT_N_R(1, C); NEXT_OPCODE();
+						// bit 1,d
+						case 0x4A: BIT_N_R(1, D); NEXT_OPCODE();
+						// bit 1,e
+						case 0x4B: BIT_N_R(1, E); NEXT_OPCODE();
+						// bit 1,h
+						case 0x4C: BIT_N_R(1, H); NEXT_OPCODE();
+						// bit 1,l
+						case 0x4D: BIT_N_R(1, L); NEXT_OPCODE();
+						// bit 1,(hl)
+						case 0x4E: BIT_N_DHL(1); NEXT_OPCODE();
+						// bit 1,a
+						case 0x4F: BIT_N_R(1, A); NEXT_OPCODE();
+						// bit 2,b
+						case 0x50: BIT_N_R(2, B); NEXT_OPCODE();
+						// bit 2,c
+						case 0x51: BIT_N_R(2, C); NEXT_OPCODE();
+						// bit 2,d
+						case 0x52: BIT_N_R(2, D); NEXT_OPCODE();
+						// bit 2,e
+						case 0x53: BIT_N_R(2, E); NEXT_OPCODE();
+						// bit 2,h
+						case 0x54: BIT_N_R(2, H); NEXT_OPCODE();
+						// bit 2,l
+						case 0x55: BIT_N_R(2, L); NEXT_OPCODE();
+						// bit 2,(hl)
+						case 0x56: BIT_N_DHL(2); NEXT_OPCODE();
+						// bit 2,a
+						case 0x57: BIT_N_R(2, A); NEXT_OPCODE();
+						// bit 3,b
+						case 0x58: BIT_N_R(3, B); NEXT_OPCODE();
+						// bit 3,c
+						case 0x59: BIT_N_R(3, C); NEXT_OPCODE();
+						// bit 3,d
+						case 0x5A: BIT_N_R(3, D); NEXT_OPCODE();
+						// bit 3,e
+						case 0x5B: BIT_N_R(3, E); NEXT_OPCODE();
+						// bit 3,h
+						case 0x5C: BIT_N_R(3, H); NEXT_OPCODE();
+						// bit 3,l
+						case 0x5D: BIT_N_R(3, L); NEXT_OPCODE();
+						// bit 3,(hl)
+						case 0x5E: BIT_N_DHL(3); NEXT_OPCODE();
+						// bit 3,a
+						case 0x5F: BIT_N_R(3, A); NEXT_OPCODE();
+						// bit 4,b
+						case 0x60: BIT_N_R(4, B); NEXT_OPCODE();
+						// bit 4,c
+						case 0x61: BIT_N_R(4, C); NEXT_OPCODE();
+						// bit 4,d
+						case 0x62: BIT_N_R(4, D); NEXT_OPCODE();
+						// bit 4,e
+						case 0x63: BIT_N_R(4, E); NEXT_OPCODE();
+						// bit 4,h
+						case 0x64: BIT_N_R(4, H); NEXT_OPCODE();
+						// bit 4,l
+						case 0x65: BIT_N_R(4, L); NEXT_OPCODE();
+						// bit 4,(hl)
+						case 0x66: BIT_N_DHL(4); NEXT_OPCODE();
+						// bit 4,a
+						case 0x67: BIT_N_R(4, A); NEXT_OPCODE();
+						// bit 5,b
+						case 0x68: BIT_N_R(5, B); NEXT_OPCODE();
+						// bit 5,c
+						case 0x69: BIT_N_R(5, C); NEXT_OPCODE();
+						// bit 5,d
+						case 0x6A: BIT_N_R(5, D); NEXT_OPCODE();
+						// bit 5,e
+						case 0x6B: BIT_N_R(5, E); NEXT_OPCODE();
+						// bit 5,h
+						case 0x6C: BIT_N_R(5, H); NEXT_OPCODE();
+						// bit 5,l
+						case 0x6D: BIT_N_R(5, L); NEXT_OPCODE();
+						// bit 5,(hl)
+						case 0x6E: BIT_N_DHL(5); NEXT_OPCODE();
+						// bit 5,a
+						case 0x6F: BIT_N_R(5, A); NEXT_OPCODE();
+						// bit 6,b
+						case 0x70: BIT_N_R(6, B); NEXT_OPCODE();
+						// bit 6,c
+						case 0x71: BIT_N_R(6, C); NEXT_OPCODE();
+						// bit 6,d
+						case 0x72: BIT_N_R(6, D); NEXT_OPCODE();
+						// bit 6,e
+						case 0x73: BIT_N_R(6, E); NEXT_OPCODE();
+						// bit 6,h
+						case 0x74: BIT_N_R(6, H); NEXT_OPCODE();
+						// bit 6,l
+						case 0x75: BIT_N_R(6, L); NEXT_OPCODE();
+						// bit 6,(hl)
+						case 0x76: BIT_N_DHL(6); NEXT_OPCODE();
+						// bit 6,a
+						case 0x77: BIT_N_R(6, A); NEXT_OPCODE();
+						// bit 7,b
+						case 0x78: BIT_N_R(7, B); NEXT_OPCODE();
+						// bit 7,c
+						case 0x79: BIT_N_R(7, C); NEXT_OPCODE();
+						// bit 7,d
+						case 0x7A: BIT_N_R(7, D); NEXT_OPCODE();
+						// bit 7,e
+						case 0x7B: BIT_N_R(7, E); NEXT_OPCODE();
+						// bit 7,h
+						case 0x7C: BIT_N_R(7, H); NEXT_OPCODE();
+						// bit 7,l
+						case 0x7D: BIT_N_R(7, L); NEXT_OPCODE();
+						// bit 7,(hl)
+						case 0x7E: BIT_N_DHL(7); NEXT_OPCODE();
+						// bit 7,a
+						case 0x7F: BIT_N_R(7, A); NEXT_OPCODE();
+						// res 0,b
+						case 0x80: RES_N_R(0, B); NEXT_OPCODE();
+						// res 0,c
+						case 0x81: RES_N_R(0, C); NEXT_OPCODE();
+						// res 0,d
+						case 0x82: RES_N_R(0, D); NEXT_OPCODE();
+						// res 0,e
+						case 0x83: RES_N_R(0, E); NEXT_OPCODE();
+						// res 0,h
+						case 0x84: RES_N_R(0, H); NEXT_OPCODE();
+						// res 0,l
+						case 0x85: RES_N_R(0, L); NEXT_OPCODE();
+						// res 0,(hl)
+						case 0x86: RES_N_DHL(0); NEXT_OPCODE();
+						// res 0,a
+						case 0x87: RES_N_R(0, A); NEXT_OPCODE();
+						// res 1,b
+						case 0x88: RES_N_R(1, B); NEXT_OPCODE();
+						// res 1,c
+						case 0x89: RES_N_R(1, C); NEXT_OPCODE();
+						// res 1,d
+						case 0x8A: RES_N_R(1, D); NEXT_OPCODE();
+						// res 1,e
+						case 0x8B: RES_N_R(1, E); NEXT_OPCODE();
+						// res 1,h
+						case 0x8C: RES_N_R(1, H); NEXT_OPCODE();
+						// res 1,l
+						case 0x8D: RES_N_R(1, L); NEXT_OPCODE();
+						// res 1,(hl)
+						case 0x8E: RES_N_DHL(1); NEXT_OPCODE();
+						// res 1,a
+						case 0x8F: RES_N_R(1, A); NEXT_OPCODE();
+						// res 2,b
+						case 0x90: RES_N_R(2, B); NEXT_OPCODE();
+						// res 2,c
+						case 0x91: RES_N_R(2, C); NEXT_OPCODE();
+						// res 2,d
+						case 0x92: RES_N_R(2, D); NEXT_OPCODE();
+						// res 2,e
+						case 0x93: RES_N_R(2, E); NEXT_OPCODE();
+						// res 2,h
+						case 0x94: RES_N_R(2, H); NEXT_OPCODE();
+						// res 2,l
+						case 0x95: RES_N_R(2, L); NEXT_OPCODE();
+						// res 2,(hl)
+						case 0x96: RES_N_DHL(2); NEXT_OPCODE();
+						// res 2,a
+						case 0x97: RES_N_R(2, A); NEXT_OPCODE();
+						// res 3,b
+						case 0x98: RES_N_R(3, B); NEXT_OPCODE();
+						// res 3,c
+						case 0x99: RES_N_R(3, C); NEXT_OPCODE();
+						// res 3,d
+						case 0x9A: RES_N_R(3, D); NEXT_OPCODE();
+						// res 3,e
+						case 0x9B: RES_N_R(3, E); NEXT_OPCODE();
+						// res 3,h
+						case 0x9C: RES_N_R(3, H); NEXT_OPCODE();
+						// res 3,l
+						case 0x9D: RES_N_R(3, L); NEXT_OPCODE();
+						// res 3,(hl)
+						case 0x9E: RES_N_DHL(3); NEXT_OPCODE();
+						// res 3,a
+						case 0x9F: RES_N_R(3, A); NEXT_OPCODE();
+						// res 4,b
+						case 0xA0: RES_N_R(4, B); NEXT_OPCODE();
+						// res 4,c
+						case 0xA1: RES_N_R(4, C); NEXT_OPCODE();
+						// res 4,d
+						case 0xA2: RES_N_R(4, D); NEXT_OPCODE();
+						// res 4,e
+						case 0xA3: RES_N_R(4, E); NEXT_OPCODE();
+						// res 4,h
+						case 0xA4: RES_N_R(4, H); NEXT_OPCODE();
+						// res 4,l
+						case 0xA5: RES_N_R(4, L); NEXT_OPCODE();
+						// res 4,(hl)
+						case 0xA6: RES_N_DHL(4); NEXT_OPCODE();
+						// res 4,a
+						case 0xA7: RES_N_R(4, A); NEXT_OPCODE();
+						// res 5,b
+						case 0xA8: RES_N_R(5, B); NEXT_OPCODE();
+						// res 5,c
+						case 0xA9: RES_N_R(5, C); NEXT_OPCODE();
+						// res 5,d
+						case 0xAA: RES_N_R(5, D); NEXT_OPCODE();
+						// res 5,e
+						case 0xAB: RES_N_R(5, E); NEXT_OPCODE();
+						// res 5,h
+						case 0xAC: RES_N_R(5, H); NEXT_OPCODE();
+						// res 5,l
+						case 0xAD: RES_N_R(5, L); NEXT_OPCODE();
+						// res 5,(hl)
+						case 0xAE: RES_N_DHL(5); NEXT_OPCODE();
+						// res 5,a
+						case 0xAF: RES_N_R(5, A); NEXT_OPCODE();
+						// res 6,b
+						case 0xB0: RES_N_R(6, B); NEXT_OPCODE();
+						// res 6,c
+						case 0xB1: RES_N_R(6, C); NEXT_OPCODE();
+						// res 6,d
+						case 0xB2: RES_N_R(6, D); NEXT_OPCODE();
+						// res 6,e
+						case 0xB3: RES_N_R(6, E); NEXT_OPCODE();
+						// res 6,h
+						case 0xB4: RES_N_R(6, H); NEXT_OPCODE();
+						// res 6,l
+						case 0xB5: RES_N_R(6, L); NEXT_OPCODE();
+						// res 6,(hl)
+						case 0xB6: RES_N_DHL(6); NEXT_OPCODE();
+						// res 6,a
+						case 0xB7: RES_N_R(6, A); NEXT_OPCODE();
+						// res 7,b
+						case 0xB8: RES_N_R(7, B); NEXT_OPCODE();
+						// res 7,c
+						case 0xB9: RES_N_R(7, C); NEXT_OPCODE();
+						// res 7,d
+						case 0xBA: RES_N_R(7, D); NEXT_OPCODE();
+						// res 7,e
+						case 0xBB: RES_N_R(7, E); NEXT_OPCODE();
+						// res 7,h
+						case 0xBC: RES_N_R(7, H); NEXT_OPCODE();
+						// res 7,l
+						case 0xBD: RES_N_R(7, L); NEXT_OPCODE();
+						// res 7,(hl)
+						case 0xBE: RES_N_DHL(7); NEXT_OPCODE();
+						// res 7,a
+						case 0xBF: RES_N_R(7, A); NEXT_OPCODE();
+						// set 0,b
+						case 0xC0: SET_N_R(0, B); NEXT_OPCODE();
+						// set 0,c
+						case 0xC1: SET_N_R(0, C); NEXT_OPCODE();
+						// set 0,d
+						case 0xC2: SET_N_R(0, D); NEXT_OPCODE();
+						// set 0,e
+						case 0xC3: SET_N_R(0, E); NEXT_OPCODE();
+						// set 0,h
+						case 0xC4: SET_N_R(0, H); NEXT_OPCODE();
+						// set 0,l
+						case 0xC5: SET_N_R(0, L); NEXT_OPCODE();
+						// set 0,(hl)
+						case 0xC6: SET_N_DHL(0); NEXT_OPCODE();
+						// set 0,a
+						case 0xC7: SET_N_R(0, A); NEXT_OPCODE();
+						// set 1,b
+						case 0xC8: SET_N_R(1, B); NEXT_OPCODE();
+						// set 1,c
+						case 0xC9: SET_N_R(1, C); NEXT_OPCODE();
+						// set 1,d
+						case 0xCA: SET_N_R(1, D); NEXT_OPCODE();
+						// set 1,e
+						case 0xCB: SET_N_R(1, E); NEXT_OPCODE();
+						// set 1,h
+						case 0xCC: SET_N_R(1, H); NEXT_OPCODE();
+						// set 1,l
+						case 0xCD: SET_N_R(1, L); NEXT_OPCODE();
+						// set 1,(hl)
+						case 0xCE: SET_N_DHL(1); NEXT_OPCODE();
+						// set 1,a
+						case 0xCF: SET_N_R(1, A); NEXT_OPCODE();
+						// set 2,b
+						case 0xD0: SET_N_R(2, B); NEXT_OPCODE();
+						// set 2,c
+						case 0xD1: SET_N_R(2, C); NEXT_OPCODE();
+						// set 2,d
+						case 0xD2: SET_N_R(2, D); NEXT_OPCODE();
+						// set 2,e
+						case 0xD3: SET_N_R(2, E); NEXT_OPCODE();
+						// set 2,h
+						case 0xD4: SET_N_R(2, H); NEXT_OPCODE();
+						// set 2,l
+						case 0xD5: SET_N_R(2, L); NEXT_OPCODE();
+						// set 2,(hl)
+						case 0xD6: SET_N_DHL(2); NEXT_OPCODE();
+						// set 2,a
+						case 0xD7: SET_N_R(2, A); NEXT_OPCODE();
+						// set 3,b
+						case 0xD8: SET_N_R(3, B); NEXT_OPCODE();
+						// set 3,c
+						case 0xD9: SET_N_R(3, C); NEXT_OPCODE();
+						// set 3,d
+						case 0xDA: SET_N_R(3, D); NEXT_OPCODE();
+						// set 3,e
+						case 0xDB: SET_N_R(3, E); NEXT_OPCODE();
+						// set 3,h
+						case 0xDC: SET_N_R(3, H); NEXT_OPCODE();
+						// set 3,l
+						case 0xDD: SET_N_R(3, L); NEXT_OPCODE();
+						// set 3,(hl)
+						case 0xDE: SET_N_DHL(3); NEXT_OPCODE();
+						// set 3,a
+						case 0xDF: SET_N_R(3, A); NEXT_OPCODE();
+						// set 4,b
+						case 0xE0: SET_N_R(4, B); NEXT_OPCODE();
+						// set 4,c
+						case 0xE1: SET_N_R(4, C); NEXT_OPCODE();
+						// set 4,d
+						case 0xE2: SET_N_R(4, D); NEXT_OPCODE();
+						// set 4,e
+						case 0xE3: SET_N_R(4, E); NEXT_OPCODE();
+						// set 4,h
+						case 0xE4: SET_N_R(4, H); NEXT_OPCODE();
+						// set 4,l
+						case 0xE5: SET_N_R(4, L); NEXT_OPCODE();
+						// set 4,(hl)
+						case 0xE6: SET_N_DHL(4); NEXT_OPCODE();
+						// set 4,a
+						case 0xE7: SET_N_R(4, A); NEXT_OPCODE();
+						// set 5,b
+						case 0xE8: SET_N_R(5, B); NEXT_OPCODE();
+						// set 5,c
+						case 0xE9: SET_N_R(5, C); NEXT_OPCODE();
+						// set 5,d
+						case 0xEA: SET_N_R(5, D); NEXT_OPCODE();
+						// set 5,e
+						case 0xEB: SET_N_R(5, E); NEXT_OPCODE();
+						// set 5,h
+						case 0xEC: SET_N_R(5, H); NEXT_OPCODE();
+						// set 5,l
+						case 0xED: SET_N_R(5, L); NEXT_OPCODE();
+						// set 5,(hl)
+						case 0xEE: SET_N_DHL(5); NEXT_OPCODE();
+						// set 5,a
+						case 0xEF: SET_N_R(5, A); NEXT_OPCODE();
+						// set 6,b
+						case 0xF0: SET_N_R(6, B); NEXT_OPCODE();
+						// set 6,c
+						case 0xF1: SET_N_R(6, C); NEXT_OPCODE();
+						// set 6,d
+						case 0xF2: SET_N_R(6, D); NEXT_OPCODE();
+						// set 6,e
+						case 0xF3: SET_N_R(6, E); NEXT_OPCODE();
+						// set 6,h
+						case 0xF4: SET_N_R(6, H); NEXT_OPCODE();
+						// set 6,l
+						case 0xF5: SET_N_R(6, L); NEXT_OPCODE();
+						// set 6,(hl)
+						case 0xF6: SET_N_DHL(6); NEXT_OPCODE();
+						// set 6,a
+						case 0xF7: SET_N_R(6, A); NEXT_OPCODE();
+						// set 7,b
+						case 0xF8: SET_N_R(7, B); NEXT_OPCODE();
+						// set 7,c
+						case 0xF9: SET_N_R(7, C); NEXT_OPCODE();
+						// set 7,d
+						case 0xFA: SET_N_R(7, D); NEXT_OPCODE();
+						// set 7,e
+						case 0xFB: SET_N_R(7, E); NEXT_OPCODE();
+						// set 7,h
+						case 0xFC: SET_N_R(7, H); NEXT_OPCODE();
+						// set 7,l
+						case 0xFD: SET_N_R(7, L); NEXT_OPCODE();
+						// set 7,(hl)
+						case 0xFE: SET_N_DHL(7); NEXT_OPCODE();
+						// set 7,a
+						case 0xFF: SET_N_R(7, A); NEXT_OPCODE();
+					}
+
+					break;
+				}
+				// call z,nn
+				OPCODE(0xCC): CALL_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+				// call nn
+				OPCODE(0xCD): CALL_CC_NN(true); NEXT_OPCODE();
+				// adc a,n
+				OPCODE(0xCE): ADC_A_N(); NEXT_OPCODE();
+				// rst 0x08
+				OPCODE(0xCF): RST(0x08); NEXT_OPCODE();
+				// ret nc
+				OPCODE(0xD0): RET_CC(!FLAG_CF()); NEXT_OPCODE();
+				// pop de
+				OPCODE(0xD1): POP(D, E); NEXT_OPCODE();
+				// jp nc,nn
+				OPCODE(0xD2): JP_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+				// out (n),a
+				OPCODE(0xD3): OUT_DN_A(); NEXT_OPCODE();
+				// call nc,nn
+				OPCODE(0xD4): CALL_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+				// push de
+				OPCODE(0xD5): PUSH(D, E); NEXT_OPCODE();
+				// sub a,n
+				OPCODE(0xD6): SUB_A_N(); NEXT_OPCODE();
+				// rst 0x10
+				OPCODE(0xD7): RST(0x10); NEXT_OPCODE();
+				// ret c
+				OPCODE(0xD8): RET_CC(FLAG_CF()); NEXT_OPCODE();
+				// exx
+				OPCODE(0xD9): EXX(); NEXT_OPCODE();
+				// jp c,nn
+				OPCODE(0xDA): JP_CC_NN(FLAG_CF()); NEXT_OPCODE();
+				// in a,(n)
+				OPCODE(0xDB): IN_A_DN(); NEXT_OPCODE();
+				// call c,nn
+				OPCODE(0xDC): CALL_CC_NN(FLAG_CF()); NEXT_OPCODE();
+				// 0xDD prefix
+				OPCODE(0xDD):
+				{
+					FETCH(opcode, REGS(PC)++);
+				dd_dispatch:
+					switch (opcode) {
+						// nop
+						case 0x00: NEXT_OPCODE();
+						// ld bc,nn
+						case 0x01: LD_RR_NN(B, C); NEXT_OPCODE();
+						// ld (bc),a
+						case 0x02: LD_DRR_A(BC); NEXT_OPCODE();
+						// inc bc
+						case 0x03: INC_RR(BC); NEXT_OPCODE();
+						// inc b
+						case 0x04: INC_R(B); NEXT_OPCODE();
+						// dec b
+						case 0x05: DEC_R(B); NEXT_OPCODE();
+						// ld b,n
+						case 0x06: LD_R_N(B); NEXT_OPCODE();
+						// rlca
+						case 0x07: RLCA(); NEXT_OPCODE();
+						// ex af,af'
+						case 0x08: EX_AF_AF(); NEXT_OPCODE();
+						// add ix,bc
+						case 0x09: ADD_RR_RR(IX, BC); NEXT_OPCODE();
+						// ld a,(bc)
+						case 0x0A: LD_A_DRR(BC); NEXT_OPCODE();
+						// dec bc
+						case 0x0B: DEC_RR(BC); NEXT_OPCODE();
+						// inc c
+						case 0x0C: INC_R(C); NEXT_OPCODE();
+						// dec c
+						case 0x0D: DEC_R(C); NEXT_OPCODE();
+						// ld c,n
+						case 0x0E: LD_R_N(C); NEXT_OPCODE();
+						// rrca
+						case 0x0F: RRCA(); NEXT_OPCODE();
+						// djnz e
+						case 0x10: DJNZ_E(); NEXT_OPCODE();
+						// ld de,nn
+						case 0x11: LD_RR_NN(D, E); NEXT_OPCODE();
+						// ld (de),a
+						case 0x12: LD_DRR_A(DE); NEXT_OPCODE();
+						// inc de
+						case 0x13: INC_RR(DE); NEXT_OPCODE();
+						// inc d
+						case 0x14: INC_R(D); NEXT_OPCODE();
+						// dec d
+						case 0x15: DEC_R(D); NEXT_OPCODE();
+						// ld d,n
+						case 0x16: LD_R_N(D); NEXT_OPCODE();
+						// rla
+						case 0x17: RLA(); NEXT_OPCODE();
+						// jr e
+						case 0x18: JR_CC_E(true); NEXT_OPCODE();
+						// add ix,de
+						case 0x19: ADD_RR_RR(IX, DE); NEXT_OPCODE();
+						// ld a,(de)
+						case 0x1A: LD_A_DRR(DE); NEXT_OPCODE();
+						// dec de
+						case 0x1B: DEC_RR(DE); NEXT_OPCODE();
+						// inc e
+						case 0x1C: INC_R(E); NEXT_OPCODE();
+						// dec e
+						case 0x1D: DEC_R(E); NEXT_OPCODE();
+						// ld e,n
+						case 0x1E: LD_R_N(E); NEXT_OPCODE();
+						// rra
+						case 0x1F: RRA(); NEXT_OPCODE();
+						// jr nz,e
+						case 0x20: JR_CC_E(!FLAG_ZF()); NEXT_OPCODE();
+						// ld ix,nn
+						case 0x21: LD_RR_NN(IXH, IXL); NEXT_OPCODE();
+						// ld (nn),ix
+						case 0x22: LD_DNN_RR(IXH, IXL); NEXT_OPCODE();
+						// inc ix
+						case 0x23: INC_RR(IX); NEXT_OPCODE();
+						// inc ixh
+						case 0x24: INC_R(IXH); NEXT_OPCODE();
+						// dec ixh
+						case 0x25: DEC_R(IXH); NEXT_OPCODE();
+						// ld ixh,n
+						case 0x26: LD_R_N(IXH); NEXT_OPCODE();
+						// daa
+						case 0x27: DAA(); NEXT_OPCODE();
+						// jr z,e
+						case 0x28: JR_CC_E(FLAG_ZF()); NEXT_OPCODE();
+						// add ix,ix
+						case 0x29: ADD_RR_RR(IX, IX); NEXT_OPCODE();
+						// ld ix,(nn)
+						case 0x2A: LD_RR_DNN(IXH, IXL); NEXT_OPCODE();
+						// dec ix
+						case 0x2B: DEC_RR(IX); NEXT_OPCODE();
+						// inc ixl
+						case 0x2C: INC_R(IXL); NEXT_OPCODE();
+						// dec ixl
+						case 0x2D: DEC_R(IXL); NEXT_OPCODE();
+						// ld ixl,n
+						case 0x2E: LD_R_N(IXL); NEXT_OPCODE();
+						// cpl
+						case 0x2F: CPL(); NEXT_OPCODE();
+						// jr nc,e
+						case 0x30: JR_CC_E(!FLAG_CF()); NEXT_OPCODE();
+						// ld sp,nn
+						case 0x31: LD_RR_NN(SPH, SPL); NEXT_OPCODE();
+						// ld (nn),a
+						case 0x32: LD_DNN_A(); NEXT_OPCODE();
+						// inc sp
+						case 0x33: INC_RR(SP); NEXT_OPCODE();
+						// inc (ix+e)
+						case 0x34: INC_DRR_E(IX); NEXT_OPCODE();
+						// dec (ix+e)
+						case 0x35: DEC_DRR_E(IX); NEXT_OPCODE();
+						// ld (ix+e),n
+						case 0x36: LD_DRR_E_N(IX); NEXT_OPCODE();
+						// scf
+						case 0x37: SCF(); NEXT_OPCODE();
+						// jr c,e
+						case 0x38: JR_CC_E(FLAG_CF()); NEXT_OPCODE();
+						// add ix,sp
+						case 0x39: ADD_RR_RR(IX, SP); NEXT_OPCODE();
+						// ld a,(nn)
+						case 0x3A: LD_A_DNN(); NEXT_OPCODE();
+						// dec sp
+						case 0x3B: DEC_RR(SP); NEXT_OPCODE();
+						// inc a
+						case 0x3C: INC_R(A); NEXT_OPCODE();
+						// dec a
+						case 0x3D: DEC_R(A); NEXT_OPCODE();
+						// ld a,n
+						case 0x3E: LD_R_N(A); NEXT_OPCODE();
+						// ccf
+						case 0x3F: CCF(); NEXT_OPCODE();
+						// ld b,b
+						case 0x40: LD_R_R(B, B); NEXT_OPCODE();
+						// ld b,c
+						case 0x41: LD_R_R(B, C); NEXT_OPCODE();
+						// ld b,d
+						case 0x42: LD_R_R(B, D); NEXT_OPCODE();
+						// ld b,e
+						case 0x43: LD_R_R(B, E); NEXT_OPCODE();
+						// ld b,ixh
+						case 0x44: LD_R_R(B, IXH); NEXT_OPCODE();
+						// ld b,ixl
+						case 0x45: LD_R_R(B, IXL); NEXT_OPCODE();
+						// ld b,(ix+e)
+						case 0x46: LD_R_DRR_E(B, IX); NEXT_OPCODE();
+						// ld b,a
+						case 0x47: LD_R_R(B, A); NEXT_OPCODE();
+						// ld c,b
+						case 0x48: LD_R_R(C, B); NEXT_OPCODE();
+						// ld c,c
+						case 0x49: LD_R_R(C, C); NEXT_OPCODE();
+						// ld c,d
+						case 0x4A: LD_R_R(C, D); NEXT_OPCODE();
+						// ld c,e
+						case 0x4B: LD_R_R(C, E); NEXT_OPCODE();
+						// ld c,ixh
+						case 0x4C: LD_R_R(C, IXH); NEXT_OPCODE();
+						// ld c,ixl
+						case 0x4D: LD_R_R(C, IXL); NEXT_OPCODE();
+						// ld c,(ix+e)
+						case 0x4E: LD_R_DRR_E(C, IX); NEXT_OPCODE();
+						// ld c,a
+						case 0x4F: LD_R_R(C, A); NEXT_OPCODE();
+						// ld d,b
+						case 0x50: LD_R_R(D, B); NEXT_OPCODE();
+						// ld d,c
+						case 0x51: LD_R_R(D, C); NEXT_OPCODE();
+						// ld d,d
+						case 0x52: LD_R_R(D, D); NEXT_OPCODE();
+						// ld d,e
+						case 0x53: LD_R_R(D, E); NEXT_OPCODE();
+						// ld d,ixh
+						case 0x54: LD_R_R(D, IXH); NEXT_OPCODE();
+						// ld d,ixl
+						case 0x55: LD_R_R(D, IXL); NEXT_OPCODE();
+						// ld d,(ix+e)
+						case 0x56: LD_R_DRR_E(D, IX); NEXT_OPCODE();
+						// ld d,a
+						case 0x57: LD_R_R(D, A); NEXT_OPCODE();
+						// ld e,b
+						case 0x58: LD_R_R(E, B); NEXT_OPCODE();
+						// ld e,c
+						case 0x59: LD_R_R(E, C); NEXT_OPCODE();
+						// ld e,d
+						case 0x5A: LD_R_R(E, D); NEXT_OPCODE();
+						// ld e,e
+						case 0x5B: LD_R_R(E, E); NEXT_OPCODE();
+						// ld e,ixh
+						case 0x5C: LD_R_R(E, IXH); NEXT_OPCODE();
+						// ld e,ixl
+						case 0x5D: LD_R_R(E, IXL); NEXT_OPCODE();
+						// ld e,(ix+e)
+						case 0x5E: LD_R_DRR_E(E, IX); NEXT_OPCODE();
+						// ld e,a
+						case 0x5F: LD_R_R(E, A); NEXT_OPCODE();
+						// ld ixh,b
+						case 0x60: LD_R_R(IXH, B); NEXT_OPCODE();
+						// ld ixh,c
+						case 0x61: LD_R_R(IXH, C); NEXT_OPCODE();
+						// ld ixh,d
+						case 0x62: LD_R_R(IXH, D); NEXT_OPCODE();
+						// ld ixh,e
+						case 0x63: LD_R_R(IXH, E); NEXT_OPCODE();
+						// ld ixh,ixh
+						case 0x64: LD_R_R(IXH, IXH); NEXT_OPCODE();
+						// ld ixh,ixl
+						case 0x65: LD_R_R(IXH, IXL); NEXT_OPCODE();
+						// ld h,(ix+e)
+						case 0x66: LD_R_DRR_E(H, IX); NEXT_OPCODE();
+						// ld ixh,a
+						case 0x67: LD_R_R(IXH, A); NEXT_OPCODE();
+						// ld ixl,b
+						case 0x68: LD_R_R(IXL, B); NEXT_OPCODE();
+						// ld ixl,c
+						case 0x69: LD_R_R(IXL, C); NEXT_OPCODE();
+						// ld ixl,d
+						case 0x6A: LD_R_R(IXL, D); NEXT_OPCODE();
+						// ld ixl,e
+						case 0x6B: LD_R_R(IXL, E); NEXT_OPCODE();
+						// ld ixl,ixh
+						case 0x6C: LD_R_R(IXL, IXH); NEXT_OPCODE();
+						// ld ixl,ixl
+						case 0x6D: LD_R_R(IXL, IXL); NEXT_OPCODE();
+						// ld l,(ix+e)
+						case 0x6E: LD_R_DRR_E(L, IX); NEXT_OPCODE();
+						// ld ixl,a
+						case 0x6F: LD_R_R(IXL, A); NEXT_OPCODE();
+						// ld (ix+e),b
+						case 0x70: LD_DRR_E_R(IX, B); NEXT_OPCODE();
+						// ld (ix+e),c
+						case 0x71: LD_DRR_E_R(IX, C); NEXT_OPCODE();
+						// ld (ix+e),d
+						case 0x72: LD_DRR_E_R(IX, D); NEXT_OPCODE();
+						// ld (ix+e),e
+						case 0x73: LD_DRR_E_R(IX, E); NEXT_OPCODE();
+						// ld (ix+e),h
+						case 0x74: LD_DRR_E_R(IX, H); NEXT_OPCODE();
+						// ld (ix+e),l
+						case 0x75: LD_DRR_E_R(IX, L); NEXT_OPCODE();
+						// halt
+						case 0x76: HALT(); NEXT_OPCODE();
+						// ld (ix+e),a
+						case 0x77: LD_DRR_E_R(IX, A); NEXT_OPCODE();
+						// ld a,b
+						case 0x78: LD_R_R(A, B); NEXT_OPCODE();
+						// ld a,c
+						case 0x79: LD_R_R(A, C); NEXT_OPCODE();
+						// ld a,d
+						case 0x7A: LD_R_R(A, D); NEXT_OPCODE();
+						// ld a,e
+						case 0x7B: LD_R_R(A, E); NEXT_OPCODE();
+						// ld a,ixh
+						case 0x7C: LD_R_R(A, IXH); NEXT_OPCODE();
+						// ld a,ixl
+						case 0x7D: LD_R_R(A, IXL); NEXT_OPCODE();
+						// ld a,(ix+e)
+						case 0x7E: LD_R_DRR_E(A, IX); NEXT_OPCODE();
+						// ld a,a
+						case 0x7F: LD_R_R(A, A); NEXT_OPCODE();
+						// add a,b
+						case 0x80: ADD_A_R(B); NEXT_OPCODE();
+						// add a,c
+						case 0x81: ADD_A_R(C); NEXT_OPCODE();
+						// add a,d
+						case 0x82: ADD_A_R(D); NEXT_OPCODE();
+						// add a,e
+						case 0x83: ADD_A_R(E); NEXT_OPCODE();
+						// add a,ixh
+						case 0x84: ADD_A_R(IXH); NEXT_OPCODE();
+						// add a,ixl
+						case 0x85: ADD_A_R(IXL); NEXT_OPCODE();
+						// add a,(ix+e)
+						case 0x86: ADD_A_DRR_E(IX); NEXT_OPCODE();
+						// add a,a
+						case 0x87: ADD_A_R(A); NEXT_OPCODE();
+						// adc a,b
+						case 0x88: ADC_A_R(B); NEXT_OPCODE();
+						// adc a,c
+						case 0x89: ADC_A_R(C); NEXT_OPCODE();
+						// adc a,d
+						case 0x8A: ADC_A_R(D); NEXT_OPCODE();
+						// adc a,e
+						case 0x8B: ADC_A_R(E); NEXT_OPCODE();
+						// adc a,ixh
+						case 0x8C: ADC_A_R(IXH); NEXT_OPCODE();
+						// adc a,ixl
+						case 0x8D: ADC_A_R(IXL); NEXT_OPCODE();
+						// adc a,(ix+e)
+						case 0x8E: ADC_A_DRR_E(IX); NEXT_OPCODE();
+						// adc a,a
+						case 0x8F: ADC_A_R(A); NEXT_OPCODE();
+						// sub a,b
+						case 0x90: SUB_A_R(B); NEXT_OPCODE();
+						// sub a,c
+						case 0x91: SUB_A_R(C); NEXT_OPCODE();
+						// sub a,d
+						case 0x92: SUB_A_R(D); NEXT_OPCODE();
+						// sub a,e
+						case 0x93: SUB_A_R(E); NEXT_OPCODE();
+						// sub a,ixh
+						case 0x94: SUB_A_R(IXH); NEXT_OPCODE();
+						// sub a,ixl
+						case 0x95: SUB_A_R(IXL); NEXT_OPCODE();
+						// sub a,(ix+e)
+						case 0x96: SUB_A_DRR_E(IX); NEXT_OPCODE();
+						// sub a,a
+						case 0x97: SUB_A_R(A); NEXT_OPCODE();
+						// sbc a,b
+						case 0x98: SBC_A_R(B); NEXT_OPCODE();
+						// sbc a,c
+						case 0x99: SBC_A_R(C); NEXT_OPCODE();
+						// sbc a,d
+						case 0x9A: SBC_A_R(D); NEXT_OPCODE();
+						// sbc a,e
+						case 0x9B: SBC_A_R(E); NEXT_OPCODE();
+						// sbc a,ixh
+						case 0x9C: SBC_A_R(IXH); NEXT_OPCODE();
+						// sbc a,ixl
+						case 0x9D: SBC_A_R(IXL); NEXT_OPCODE();
+						// sbc a,(ix+e)
+						case 0x9E: SBC_A_DRR_E(IX); NEXT_OPCODE();
+						// sbc a,a
+						case 0x9F: SBC_A_R(A); NEXT_OPCODE();
+						// and a,b
+						case 0xA0: AND_A_R(B); NEXT_OPCODE();
+						// and a,c
+						case 0xA1: AND_A_R(C); NEXT_OPCODE();
+						// and a,d
+						case 0xA2: AND_A_R(D); NEXT_OPCODE();
+						// and a,e
+						case 0xA3: AND_A_R(E); NEXT_OPCODE();
+						// and a,ixh
+						case 0xA4: AND_A_R(IXH); NEXT_OPCODE();
+						// and a,ixl
+						case 0xA5: AND_A_R(IXL); NEXT_OPCODE();
+						// and a,(ix+e)
+						case 0xA6: AND_A_DRR_E(IX); NEXT_OPCODE();
+						// and a,a
+						case 0xA7: AND_A_R(A); NEXT_OPCODE();
+						// xor a,b
+						case 0xA8: XOR_A_R(B); NEXT_OPCODE();
+						// xor a,c
+						case 0xA9: XOR_A_R(C); NEXT_OPCODE();
+						// xor a,d
+						case 0xAA: XOR_A_R(D); NEXT_OPCODE();
+						// xor a,e
+						case 0xAB: XOR_A_R(E); NEXT_OPCODE();
+						// xor a,ixh
+						case 0xAC: XOR_A_R(IXH); NEXT_OPCODE();
+						// xor a,ixl
+						case 0xAD: XOR_A_R(IXL); NEXT_OPCODE();
+						// xor a,(ix+e)
+						case 0xAE: XOR_A_DRR_E(IX); NEXT_OPCODE();
+						// xor a,a
+						case 0xAF: XOR_A_R(A); NEXT_OPCODE();
+						// or a,b
+						case 0xB0: OR_A_R(B); NEXT_OPCODE();
+						// or a,c
+						case 0xB1: OR_A_R(C); NEXT_OPCODE();
+						// or a,d
+						case 0xB2: OR_A_R(D); NEXT_OPCODE();
+						// or a,e
+						case 0xB3: OR_A_R(E); NEXT_OPCODE();
+						// or a,ixh
+						case 0xB4: OR_A_R(IXH); NEXT_OPCODE();
+						// or a,ixl
+						case 0xB5: OR_A_R(IXL); NEXT_OPCODE();
+						// or a,(ix+e)
+						case 0xB6: OR_A_DRR_E(IX); NEXT_OPCODE();
+						// or a,a
+						case 0xB7: OR_A_R(A); NEXT_OPCODE();
+						// cp a,b
+						case 0xB8: CP_A_R(B); NEXT_OPCODE();
+						// cp a,c
+						case 0xB9: CP_A_R(C); NEXT_OPCODE();
+						// cp a,d
+						case 0xBA: CP_A_R(D); NEXT_OPCODE();
+						// cp a,e
+						case 0xBB: CP_A_R(E); NEXT_OPCODE();
+						// cp a,ixh
+						case 0xBC: CP_A_R(IXH); NEXT_OPCODE();
+						// cp a,ixl
+						case 0xBD: CP_A_R(IXL); NEXT_OPCODE();
+						// cp a,(ix+e)
+						case 0xBE: CP_A_DRR_E(IX); NEXT_OPCODE();
+						// cp a,a
+						case 0xBF: CP_A_R(A); NEXT_OPCODE();
+						// ret nz
+						case 0xC0: RET_CC(!FLAG_ZF()); NEXT_OPCODE();
+						// pop bc
+						case 0xC1: POP(B, C); NEXT_OPCODE();
+						// jp nz,nn
+						case 0xC2: JP_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+						// jp nn
+						case 0xC3: JP_CC_NN(true); NEXT_OPCODE();
+						// call nz,nn
+						case 0xC4: CALL_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+						// push bc
+						case 0xC5: PUSH(B, C); NEXT_OPCODE();
+						// add a,n
+						case 0xC6: ADD_A_N(); NEXT_OPCODE();
+						// rst 0x00
+						case 0xC7: RST(0x00); NEXT_OPCODE();
+						// ret z
+						case 0xC8: RET_CC(FLAG_ZF()); NEXT_OPCODE();
+						// ret
+						case 0xC9: RET(); NEXT_OPCODE();
+						// jp z,nn
+						case 0xCA: JP_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+						// 0xDDCB prefix
+						case 0xCB:
+						{
+							u8 e;
+							READ_PC(e);
+							READ_PC(opcode);
+							cyclesLeft -= 2;
+							REGS(WZ) = REGS(IX) + SIGNED(e, s8);
+							switch (opcode) {
+								// rlc (ix+e),b
+								case 0x00: RLC_DRR_E_R(B); NEXT_OPCODE();
+								// rlc (ix+e),c
+								case 0x01: RLC_DRR_E_R(C); NEXT_OPCODE();
+								// rlc (ix+e),d
+								case 0x02: RLC_DRR_E_R(D); NEXT_OPCODE();
+								// rlc (ix+e),e
+								case 0x03: RLC_DRR_E_R(E); NEXT_OPCODE();
+								// rlc (ix+e),h
+								case 0x04: RLC_DRR_E_R(H); NEXT_OPCODE();
+								// rlc (ix+e),l
+								case 0x05: RLC_DRR_E_R(L); NEXT_OPCODE();
+								// rlc (ix+e)
+								case 0x06: RLC_DRR_E(); NEXT_OPCODE();
+								// rlc (ix+e),a
+								case 0x07: RLC_DRR_E_R(A); NEXT_OPCODE();
+								// rrc (ix+e),b
+								case 0x08: RRC_DRR_E_R(B); NEXT_OPCODE();
+								// rrc (ix+e),c
+								case 0x09: RRC_DRR_E_R(C); NEXT_OPCODE();
+								// rrc (ix+e),d
+								case 0x0A: RRC_DRR_E_R(D); NEXT_OPCODE();
+								// rrc (ix+e),e
+								case 0x0B: RRC_DRR_E_R(E); NEXT_OPCODE();
+								// rrc (ix+e),h
+								case 0x0C: RRC_DRR_E_R(H); NEXT_OPCODE();
+								// rrc (ix+e),l
+								case 0x0D: RRC_DRR_E_R(L); NEXT_OPCODE();
+								// rrc (ix+e)
+								case 0x0E: RRC_DRR_E(); NEXT_OPCODE();
+								// rrc (ix+e),a
+								case 0x0F: RRC_DRR_E_R(A); NEXT_OPCODE();
+								// rl (ix+e),b
+								case 0x10: RL_DRR_E_R(B); NEXT_OPCODE();
+								// rl (ix+e),c
+								case 0x11: RL_DRR_E_R(C); NEXT_OPCODE();
+								// rl (ix+e),d
+								case 0x12: RL_DRR_E_R(D); NEXT_OPCODE();
+								// rl (ix+e),e
+								case 0x13: RL_DRR_E_R(E); NEXT_OPCODE();
+								// rl (ix+e),h
+								case 0x14: RL_DRR_E_R(H); NEXT_OPCODE();
+								// rl (ix+e),l
+								case 0x15: RL_DRR_E_R(L); NEXT_OPCODE();
+								// rl (ix+e)
+								case 0x16: RL_DRR_E(); NEXT_OPCODE();
+								// rl (ix+e),a
+								case 0x17: RL_DRR_E_R(A); NEXT_OPCODE();
+								// rr (ix+e),b
+								case 0x18: RR_DRR_E_R(B); NEXT_OPCODE();
+								// rr (ix+e),c
+								case 0x19: RR_DRR_E_R(C); NEXT_OPCODE();
+								// rr (ix+e),d
+								case 0x1A: RR_DRR_E_R(D); NEXT_OPCODE();
+								// rr (ix+e),e
+								case 0x1B: RR_DRR_E_R(E); NEXT_OPCODE();
+								// rr (ix+e),h
+								case 0x1C: RR_DRR_E_R(H); NEXT_OPCODE();
+								// rr (ix+e),l
+								case 0x1D: RR_DRR_E_R(L); NEXT_OPCODE();
+								// rr (ix+e)
+								case 0x1E: RR_DRR_E(); NEXT_OPCODE();
+								// rr (ix+e),a
+								case 0x1F: RR_DRR_E_R(A); NEXT_OPCODE();
+								// sla (ix+e),b
+								case 0x20: SLA_DRR_E_R(B); NEXT_OPCODE();
+								// sla (ix+e),c
+								case 0x21: SLA_DRR_E_R(C); NEXT_OPCODE();
+								// sla (ix+e),d
+								case 0x22: SLA_DRR_E_R(D); NEXT_OPCODE();
+								// sla (ix+e),e
+								case 0x23: SLA_DRR_E_R(E); NEXT_OPCODE();
+								// sla (ix+e),h
+								case 0x24: SLA_DRR_E_R(H); NEXT_OPCODE();
+								// sla (ix+e),l
+								case 0x25: SLA_DRR_E_R(L); NEXT_OPCODE();
+								// sla (ix+e)
+								case 0x26: SLA_DRR_E(); NEXT_OPCODE();
+								// sla (ix+e),a
+								case 0x27: SLA_DRR_E_R(A); NEXT_OPCODE();
+								// sra (ix+e),b
+								case 0x28: SRA_DRR_E_R(B); NEXT_OPCODE();
+								// sra (ix+e),c
+								case 0x29: SRA_DRR_E_R(C); NEXT_OPCODE();
+								// sra (ix+e),d
+								case 0x2A: SRA_DRR_E_R(D); NEXT_OPCODE();
+								// sra (ix+e),e
+								case 0x2B: SRA_DRR_E_R(E); NEXT_OPCODE();
+								// sra (ix+e),h
+								case 0x2C: SRA_DRR_E_R(H); NEXT_OPCODE();
+								// sra (ix+e),l
+								case 0x2D: SRA_DRR_E_R(L); NEXT_OPCODE();
+								// sra (ix+e)
+								case 0x2E: SRA_DRR_E(); NEXT_OPCODE();
+								// sra (ix+e),a
+								case 0x2F: SRA_DRR_E_R(A); NEXT_OPCODE();
+								// sll (ix+e),b
+								case 0x30: SLL_DRR_E_R(B); NEXT_OPCODE();
+								// sll (ix+e),c
+								case 0x31: SLL_DRR_E_R(C); NEXT_OPCODE();
+								// sll (ix+e),d
+								case 0x32: SLL_DRR_E_R(D); NEXT_OPCODE();
+								// sll (ix+e),e
+								case 0x33: SLL_DRR_E_R(E); NEXT_OPCODE();
+								// sll (ix+e),h
+								case 0x34: SLL_DRR_E_R(H); NEXT_OPCODE();
+								// sll (ix+e),l
+								case 0x35: SLL_DRR_E_R(L); NEXT_OPCODE();
+								// sll (ix+e)
+								case 0x36: SLL_DRR_E(); NEXT_OPCODE();
+								// sll (ix+e),a
+								case 0x37: SLL_DRR_E_R(A); NEXT_OPCODE();
+								// srl (ix+e),b
+								case 0x38: SRL_DRR_E_R(B); NEXT_OPCODE();
+								// srl (ix+e),c
+								case 0x39: SRL_DRR_E_R(C); NEXT_OPCODE();
+								// srl (ix+e),d
+								case 0x3A: SRL_DRR_E_R(D); NEXT_OPCODE();
+								// srl (ix+e),e
+								case 0x3B: SRL_DRR_E_R(E); NEXT_OPCODE();
+								// srl (ix+e),h
+								case 0x3C: SRL_DRR_E_R(H); NEXT_OPCODE();
+								// srl (ix+e),l
+								case 0x3D: SRL_DRR_E_R(L); NEXT_OPCODE();
+								// srl (ix+e)
+								case 0x3E: SRL_DRR_E(); NEXT_OPCODE();
+								// srl (ix+e),a
+								case 0x3F: SRL_DRR_E_R(A); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x40: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x41: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x42: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x43: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x44: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x45: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x46: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(ix+e)
+								case 0x47: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x48: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x49: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4A: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4B: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4C: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4D: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4E: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(ix+e)
+								case 0x4F: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x50: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x51: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x52: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x53: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x54: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x55: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x56: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(ix+e)
+								case 0x57: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x58: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x59: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5A: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5B: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5C: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5D: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5E: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(ix+e)
+								case 0x5F: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x60: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x61: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x62: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x63: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x64: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x65: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x66: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(ix+e)
+								case 0x67: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x68: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x69: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6A: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6B: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6C: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6D: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6E: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(ix+e)
+								case 0x6F: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x70: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x71: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x72: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x73: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x74: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x75: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x76: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(ix+e)
+								case 0x77: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x78: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x79: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7A: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7B: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7C: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7D: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7E: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(ix+e)
+								case 0x7F: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// res 0,(ix+e),b
+								case 0x80: RES_N_DRR_E_R(0, B); NEXT_OPCODE();
+								// res 0,(ix+e),c
+								case 0x81: RES_N_DRR_E_R(0, C); NEXT_OPCODE();
+								// res 0,(ix+e),d
+								case 0x82: RES_N_DRR_E_R(0, D); NEXT_OPCODE();
+								// res 0,(ix+e),e
+								case 0x83: RES_N_DRR_E_R(0, E); NEXT_OPCODE();
+								// res 0,(ix+e),h
+								case 0x84: RES_N_DRR_E_R(0, H); NEXT_OPCODE();
+								// res 0,(ix+e),l
+								case 0x85: RES_N_DRR_E_R(0, L); NEXT_OPCODE();
+								// res 0,(ix+e)
+								case 0x86: RES_N_DRR_E(0); NEXT_OPCODE();
+								// res 0,(ix+e),a
+								case 0x87: RES_N_DRR_E_R(0, A); NEXT_OPCODE();
+								// res 1,(ix+e),b
+								case 0x88: RES_N_DRR_E_R(1, B); NEXT_OPCODE();
+								// res 1,(ix+e),c
+								case 0x89: RES_N_DRR_E_R(1, C); NEXT_OPCODE();
+								// res 1,(ix+e),d
+								case 0x8A: RES_N_DRR_E_R(1, D); NEXT_OPCODE();
+								// res 1,(ix+e),e
+								case 0x8B: RES_N_DRR_E_R(1, E); NEXT_OPCODE();
+								// res 1,(ix+e),h
+								case 0x8C: RES_N_DRR_E_R(1, H); NEXT_OPCODE();
+								// res 1,(ix+e),l
+								case 0x8D: RES_N_DRR_E_R(1, L); NEXT_OPCODE();
+								// res 1,(ix+e)
+								case 0x8E: RES_N_DRR_E(1); NEXT_OPCODE();
+								// res 1,(ix+e),a
+								case 0x8F: RES_N_DRR_E_R(1, A); NEXT_OPCODE();
+								// res 2,(ix+e),b
+								case 0x90: RES_N_DRR_E_R(2, B); NEXT_OPCODE();
+								// res 2,(ix+e),c
+								case 0x91: RES_N_DRR_E_R(2, C); NEXT_OPCODE();
+								// res 2,(ix+e),d
+								case 0x92: RES_N_DRR_E_R(2, D); NEXT_OPCODE();
+								// res 2,(ix+e),e
+								case 0x93: RES_N_DRR_E_R(2, E); NEXT_OPCODE();
+								// res 2,(ix+e),h
+								case 0x94: RES_N_DRR_E_R(2, H); NEXT_OPCODE();
+								// res 2,(ix+e),l
+								case 0x95: RES_N_DRR_E_R(2, L); NEXT_OPCODE();
+								// res 2,(ix+e)
+								case 0x96: RES_N_DRR_E(2); NEXT_OPCODE();
+								// res 2,(ix+e),a
+								case 0x97: RES_N_DRR_E_R(2, A); NEXT_OPCODE();
+								// res 3,(ix+e),b
+								case 0x98: RES_N_DRR_E_R(3, B); NEXT_OPCODE();
+								// res 3,(ix+e),c
+								case 0x99: RES_N_DRR_E_R(3, C); NEXT_OPCODE();
+								// res 3,(ix+e),d
+								case 0x9A: RES_N_DRR_E_R(3, D); NEXT_OPCODE();
+								// res 3,(ix+e),e
+								case 0x9B: RES_N_DRR_E_R(3, E); NEXT_OPCODE();
+								// res 3,(ix+e),h
+								case 0x9C: RES_N_DRR_E_R(3, H); NEXT_OPCODE();
+								// res 3,(ix+e),l
+								case 0x9D: RES_N_DRR_E_R(3, L); NEXT_OPCODE();
+								// res 3,(ix+e)
+								case 0x9E: RES_N_DRR_E(3); NEXT_OPCODE();
+								// res 3,(ix+e),a
+								case 0x9F: RES_N_DRR_E_R(3, A); NEXT_OPCODE();
+								// res 4,(ix+e),b
+								case 0xA0: RES_N_DRR_E_R(4, B); NEXT_OPCODE();
+								// res 4,(ix+e),c
+								case 0xA1: RES_N_DRR_E_R(4, C); NEXT_OPCODE();
+								// res 4,(ix+e),d
+								case 0xA2: RES_N_DRR_E_R(4, D); NEXT_OPCODE();
+								// res 4,(ix+e),e
+								case 0xA3: RES_N_DRR_E_R(4, E); NEXT_OPCODE();
+								// res 4,(ix+e),h
+								case 0xA4: RES_N_DRR_E_R(4, H); NEXT_OPCODE();
+								// res 4,(ix+e),l
+								case 0xA5: RES_N_DRR_E_R(4, L); NEXT_OPCODE();
+								// res 4,(ix+e)
+								case 0xA6: RES_N_DRR_E(4); NEXT_OPCODE();
+								// res 4,(ix+e),a
+								case 0xA7: RES_N_DRR_E_R(4, A); NEXT_OPCODE();
+								// res 5,(ix+e),b
+								case 0xA8: RES_N_DRR_E_R(5, B); NEXT_OPCODE();
+								// res 5,(ix+e),c
+								case 0xA9: RES_N_DRR_E_R(5, C); NEXT_OPCODE();
+								// res 5,(ix+e),d
+								case 0xAA: RES_N_DRR_E_R(5, D); NEXT_OPCODE();
+								// res 5,(ix+e),e
+								case 0xAB: RES_N_DRR_E_R(5, E); NEXT_OPCODE();
+								// res 5,(ix+e),h
+								case 0xAC: RES_N_DRR_E_R(5, H); NEXT_OPCODE();
+								// res 5,(ix+e),l
+								case 0xAD: RES_N_DRR_E_R(5, L); NEXT_OPCODE();
+								// res 5,(ix+e)
+								case 0xAE: RES_N_DRR_E(5); NEXT_OPCODE();
+								// res 5,(ix+e),a
+								case 0xAF: RES_N_DRR_E_R(5, A); NEXT_OPCODE();
+								// res 6,(ix+e),b
+								case 0xB0: RES_N_DRR_E_R(6, B); NEXT_OPCODE();
+								// res 6,(ix+e),c
+								case 0xB1: RES_N_DRR_E_R(6, C); NEXT_OPCODE();
+								// res 6,(ix+e),d
+								case 0xB2: RES_N_DRR_E_R(6, D); NEXT_OPCODE();
+								// res 6,(ix+e),e
+								case 0xB3: RES_N_DRR_E_R(6, E); NEXT_OPCODE();
+								// res 6,(ix+e),h
+								case 0xB4: RES_N_DRR_E_R(6, H); NEXT_OPCODE();
+								// res 6,(ix+e),l
+								case 0xB5: RES_N_DRR_E_R(6, L); NEXT_OPCODE();
+								// res 6,(ix+e)
+								case 0xB6: RES_N_DRR_E(6); NEXT_OPCODE();
+								// res 6,(ix+e),a
+								case 0xB7: RES_N_DRR_E_R(6, A); NEXT_OPCODE();
+								// res 7,(ix+e),b
+								case 0xB8: RES_N_DRR_E_R(7, B); NEXT_OPCODE();
+								// res 7,(ix+e),c
+								case 0xB9: RES_N_DRR_E_R(7, C); NEXT_OPCODE();
+								// res 7,(ix+e),d
+								case 0xBA: RES_N_DRR_E_R(7, D); NEXT_OPCODE();
+								// res 7,(ix+e),e
+								case 0xBB: RES_N_DRR_E_R(7, E); NEXT_OPCODE();
+								// res 7,(ix+e),h
+								case 0xBC: RES_N_DRR_E_R(7, H); NEXT_OPCODE();
+								// res 7,(ix+e),l
+								case 0xBD: RES_N_DRR_E_R(7, L); NEXT_OPCODE();
+								// res 7,(ix+e)
+								case 0xBE: RES_N_DRR_E(7); NEXT_OPCODE();
+								// res 7,(ix+e),a
+								case 0xBF: RES_N_DRR_E_R(7, A); NEXT_OPCODE();
+								// set 0,(ix+e),b
+								case 0xC0: SET_N_DRR_E_R(0, B); NEXT_OPCODE();
+								// set 0,(ix+e),c
+								case 0xC1: SET_N_DRR_E_R(0, C); NEXT_OPCODE();
+								// set 0,(ix+e),d
+								case 0xC2: SET_N_DRR_E_R(0, D); NEXT_OPCODE();
+								// set 0,(ix+e),e
+								case 0xC3: SET_N_DRR_E_R(0, E); NEXT_OPCODE();
+								// set 0,(ix+e),h
+								case 0xC4: SET_N_DRR_E_R(0, H); NEXT_OPCODE();
+								// set 0,(ix+e),l
+								case 0xC5: SET_N_DRR_E_R(0, L); NEXT_OPCODE();
+								// set 0,(ix+e)
+								case 0xC6: SET_N_DRR_E(0); NEXT_OPCODE();
+								// set 0,(ix+e),a
+								case 0xC7: SET_N_DRR_E_R(0, A); NEXT_OPCODE();
+								// set 1,(ix+e),b
+								case 0xC8: SET_N_DRR_E_R(1, B); NEXT_OPCODE();
+								// set 1,(ix+e),c
+								case 0xC9: SET_N_DRR_E_R(1, C); NEXT_OPCODE();
+								// set 1,(ix+e),d
+								case 0xCA: SET_N_DRR_E_R(1, D); NEXT_OPCODE();
+								// set 1,(ix+e),e
+								case 0xCB: SET_N_DRR_E_R(1, E); NEXT_OPCODE();
+								// set 1,(ix+e),h
+								case 0xCC: SET_N_DRR_E_R(1, H); NEXT_OPCODE();
+								// set 1,(ix+e),l
+								case 0xCD: SET_N_DRR_E_R(1, L); NEXT_OPCODE();
+								// set 1,(ix+e)
+								case 0xCE: SET_N_DRR_E(1); NEXT_OPCODE();
+								// set 1,(ix+e),a
+								case 0xCF: SET_N_DRR_E_R(1, A); NEXT_OPCODE();
+								// set 2,(ix+e),b
+								case 0xD0: SET_N_DRR_E_R(2, B); NEXT_OPCODE();
+								// set 2,(ix+e),c
+								case 0xD1: SET_N_DRR_E_R(2, C); NEXT_OPCODE();
+								// set 2,(ix+e),d
+								case 0xD2: SET_N_DRR_E_R(2, D); NEXT_OPCODE();
+								// set 2,(ix+e),e
+								case 0xD3: SET_N_DRR_E_R(2, E); NEXT_OPCODE();
+								// set 2,(ix+e),h
+								case 0xD4: SET_N_DRR_E_R(2, H); NEXT_OPCODE();
+								// set 2,(ix+e),l
+								case 0xD5: SET_N_DRR_E_R(2, L); NEXT_OPCODE();
+								// set 2,(ix+e)
+								case 0xD6: SET_N_DRR_E(2); NEXT_OPCODE();
+								// set 2,(ix+e),a
+								case 0xD7: SET_N_DRR_E_R(2, A); NEXT_OPCODE();
+								// set 3,(ix+e),b
+								case 0xD8: SET_N_DRR_E_R(3, B); NEXT_OPCODE();
+								// set 3,(ix+e),c
+								case 0xD9: SET_N_DRR_E_R(3, C); NEXT_OPCODE();
+								// set 3,(ix+e),d
+								case 0xDA: SET_N_DRR_E_R(3, D); NEXT_OPCODE();
+								// set 3,(ix+e),e
+								case 0xDB: SET_N_DRR_E_R(3, E); NEXT_OPCODE();
+								// set 3,(ix+e),h
+								case 0xDC: SET_N_DRR_E_R(3, H); NEXT_OPCODE();
+								// set 3,(ix+e),l
+								case 0xDD: SET_N_DRR_E_R(3, L); NEXT_OPCODE();
+								// set 3,(ix+e)
+								case 0xDE: SET_N_DRR_E(3); NEXT_OPCODE();
+								// set 3,(ix+e),a
+								case 0xDF: SET_N_DRR_E_R(3, A); NEXT_OPCODE();
+								// set 4,(ix+e),b
+								case 0xE0: SET_N_DRR_E_R(4, B); NEXT_OPCODE();
+								// set 4,(ix+e),c
+								case 0xE1: SET_N_DRR_E_R(4, C); NEXT_OPCODE();
+								// set 4,(ix+e),d
+								case 0xE2: SET_N_DRR_E_R(4, D); NEXT_OPCODE();
+								// set 4,(ix+e),e
+								case 0xE3: SET_N_DRR_E_R(4, E); NEXT_OPCODE();
+								// set 4,(ix+e),h
+								case 0xE4: SET_N_DRR_E_R(4, H); NEXT_OPCODE();
+								// set 4,(ix+e),l
+								case 0xE5: SET_N_DRR_E_R(4, L); NEXT_OPCODE();
+								// set 4,(ix+e)
+								case 0xE6: SET_N_DRR_E(4); NEXT_OPCODE();
+								// set 4,(ix+e),a
+								case 0xE7: SET_N_DRR_E_R(4, A); NEXT_OPCODE();
+								// set 5,(ix+e),b
+								case 0xE8: SET_N_DRR_E_R(5, B); NEXT_OPCODE();
+								// set 5,(ix+e),c
+								case 0xE9: SET_N_DRR_E_R(5, C); NEXT_OPCODE();
+								// set 5,(ix+e),d
+								case 0xEA: SET_N_DRR_E_R(5, D); NEXT_OPCODE();
+								// set 5,(ix+e),e
+								case 0xEB: SET_N_DRR_E_R(5, E); NEXT_OPCODE();
+								// set 5,(ix+e),h
+								case 0xEC: SET_N_DRR_E_R(5, H); NEXT_OPCODE();
+								// set 5,(ix+e),l
+								case 0xED: SET_N_DRR_E_R(5, L); NEXT_OPCODE();
+								// set 5,(ix+e)
+								case 0xEE: SET_N_DRR_E(5); NEXT_OPCODE();
+								// set 5,(ix+e),a
+								case 0xEF: SET_N_DRR_E_R(5, A); NEXT_OPCODE();
+								// set 6,(ix+e),b
+								case 0xF0: SET_N_DRR_E_R(6, B); NEXT_OPCODE();
+								// set 6,(ix+e),c
+								case 0xF1: SET_N_DRR_E_R(6, C); NEXT_OPCODE();
+								// set 6,(ix+e),d
+								case 0xF2: SET_N_DRR_E_R(6, D); NEXT_OPCODE();
+								// set 6,(ix+e),e
+								case 0xF3: SET_N_DRR_E_R(6, E); NEXT_OPCODE();
+								// set 6,(ix+e),h
+								case 0xF4: SET_N_DRR_E_R(6, H); NEXT_OPCODE();
+								// set 6,(ix+e),l
+								case 0xF5: SET_N_DRR_E_R(6, L); NEXT_OPCODE();
+								// set 6,(ix+e)
+								case 0xF6: SET_N_DRR_E(6); NEXT_OPCODE();
+								// set 6,(ix+e),a
+								case 0xF7: SET_N_DRR_E_R(6, A); NEXT_OPCODE();
+								// set 7,(ix+e),b
+								case 0xF8: SET_N_DRR_E_R(7, B); NEXT_OPCODE();
+								// set 7,(ix+e),c
+								case 0xF9: SET_N_DRR_E_R(7, C); NEXT_OPCODE();
+								// set 7,(ix+e),d
+								case 0xFA: SET_N_DRR_E_R(7, D); NEXT_OPCODE();
+								// set 7,(ix+e),e
+								case 0xFB: SET_N_DRR_E_R(7, E); NEXT_OPCODE();
+								// set 7,(ix+e),h
+								case 0xFC: SET_N_DRR_E_R(7, H); NEXT_OPCODE();
+								// set 7,(ix+e),l
+								case 0xFD: SET_N_DRR_E_R(7, L); NEXT_OPCODE();
+								// set 7,(ix+e)
+								case 0xFE: SET_N_DRR_E(7); NEXT_OPCODE();
+								// set 7,(ix+e),a
+								case 0xFF: SET_N_DRR_E_R(7, A); NEXT_OPCODE();
+							}
+
+							break;
+						}
+						// call z,nn
+						case 0xCC: CALL_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+						// call nn
+						case 0xCD: CALL_CC_NN(true); NEXT_OPCODE();
+						// adc a,n
+						case 0xCE: ADC_A_N(); NEXT_OPCODE();
+						// rst 0x08
+						case 0xCF: RST(0x08); NEXT_OPCODE();
+						// ret nc
+						case 0xD0: RET_CC(!FLAG_CF()); NEXT_OPCODE();
+						// pop de
+						case 0xD1: POP(D, E); NEXT_OPCODE();
+						// jp nc,nn
+						case 0xD2: JP_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+						// out (n),a
+						case 0xD3: OUT_DN_A(); NEXT_OPCODE();
+						// call nc,nn
+						case 0xD4: CALL_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+						// push de
+						case 0xD5: PUSH(D, E); NEXT_OPCODE();
+						// sub a,n
+						case 0xD6: SUB_A_N(); NEXT_OPCODE();
+						// rst 0x10
+						case 0xD7: RST(0x10); NEXT_OPCODE();
+						// ret c
+						case 0xD8: RET_CC(FLAG_CF()); NEXT_OPCODE();
+						// exx
+						case 0xD9: EXX(); NEXT_OPCODE();
+						// jp c,nn
+						case 0xDA: JP_CC_NN(FLAG_CF()); NEXT_OPCODE();
+						// in a,(n)
+						case 0xDB: IN_A_DN(); NEXT_OPCODE();
+						// call c,nn
+						case 0xDC: CALL_CC_NN(FLAG_CF()); NEXT_OPCODE();
+						// 0xDD prefix
+						case 0xDD: REPEAT_PREFIX(); NEXT_OPCODE();
+						// sbc a,n
+						case 0xDE: SBC_A_N(); NEXT_OPCODE();
+						// rst 0x18
+						case 0xDF: RST(0x18); NEXT_OPCODE();
+						// ret po
+						case 0xE0: RET_CC(!FLAG_PF()); NEXT_OPCODE();
+						// pop ix
+						case 0xE1: POP(IXH, IXL); NEXT_OPCODE();
+						// jp po,nn
+						case 0xE2: JP_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+						// ex (sp),ix
+						case 0xE3: EX_DSP_RR(IXH, IXL); NEXT_OPCODE();
+						// call po,nn
+						case 0xE4: CALL_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+						// push ix
+						case 0xE5: PUSH(IXH, IXL); NEXT_OPCODE();
+						// and a,n
+						case 0xE6: AND_A_N(); NEXT_OPCODE();
+						// rst 0x20
+						case 0xE7: RST(0x20); NEXT_OPCODE();
+						// ret pe
+						case 0xE8: RET_CC(FLAG_PF()); NEXT_OPCODE();
+						// jp ix
+						case 0xE9: JP_RR(IX); NEXT_OPCODE();
+						// jp pe,nn
+						case 0xEA: JP_CC_NN(FLAG_PF()); NEXT_OPCODE();
+						// ex de,hl
+						case 0xEB: EX_DE_HL(); NEXT_OPCODE();
+						// call pe,nn
+						case 0xEC: CALL_CC_NN(FLAG_PF()); NEXT_OPCODE();
+						// 0xED prefix
+						case 0xED: REPEAT_PREFIX(); NEXT_OPCODE();
+						// xor a,n
+						case 0xEE: XOR_A_N(); NEXT_OPCODE();
+						// rst 0x28
+						case 0xEF: RST(0x28); NEXT_OPCODE();
+						// ret p
+						case 0xF0: RET_CC(!FLAG_SF()); NEXT_OPCODE();
+						// pop af
+						case 0xF1: POP_AF(); NEXT_OPCODE();
+						// jp p,nn
+						case 0xF2: JP_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+						// di
+						case 0xF3: DI(); NEXT_OPCODE();
+						// call p,nn
+						case 0xF4: CALL_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+						// push af
+						case 0xF5: PUSH_AF(); NEXT_OPCODE();
+						// or a,n
+						case 0xF6: OR_A_N(); NEXT_OPCODE();
+						// rst 0x30
+						case 0xF7: RST(0x30); NEXT_OPCODE();
+						// ret m
+						case 0xF8: RET_CC(FLAG_SF()); NEXT_OPCODE();
+						// ld sp,ix
+						case 0xF9: LD_SP_RR(IX); NEXT_OPCODE();
+						// jp m,nn
+						case 0xFA: JP_CC_NN(FLAG_SF()); NEXT_OPCODE();
+						// ei
+						case 0xFB: EI(); NEXT_OPCODE();
+						// call m,nn
+						case 0xFC: CALL_CC_NN(FLAG_SF()); NEXT_OPCODE();
+						// 0xFD prefix
+						case 0xFD: REPEAT_PREFIX(); NEXT_OPCODE();
+						// cp a,n
+						case 0xFE: CP_A_N(); NEXT_OPCODE();
+						// rst 0x38
+						case 0xFF: RST(0x38); NEXT_OPCODE();
+					}
+
+					break;
+				}
+				// sbc a,n
+				OPCODE(0xDE): SBC_A_N(); NEXT_OPCODE();
+				// rst 0x18
+				OPCODE(0xDF): RST(0x18); NEXT_OPCODE();
+				// ret po
+				OPCODE(0xE0): RET_CC(!FLAG_PF()); NEXT_OPCODE();
+				// pop hl
+				OPCODE(0xE1): POP(H, L); NEXT_OPCODE();
+				// jp po,nn
+				OPCODE(0xE2): JP_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+				// ex (sp),hl
+				OPCODE(0xE3): EX_DSP_RR(H, L); NEXT_OPCODE();
+				// call po,nn
+				OPCODE(0xE4): CALL_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+				// push hl
+				OPCODE(0xE5): PUSH(H, L); NEXT_OPCODE();
+				// and a,n
+				OPCODE(0xE6): AND_A_N(); NEXT_OPCODE();
+				// rst 0x20
+				OPCODE(0xE7): RST(0x20); NEXT_OPCODE();
+				// ret pe
+				OPCODE(0xE8): RET_CC(FLAG_PF()); NEXT_OPCODE();
+				// jp hl
+				OPCODE(0xE9): JP_RR(HL); NEXT_OPCODE();
+				// jp pe,nn
+				OPCODE(0xEA): JP_CC_NN(FLAG_PF()); NEXT_OPCODE();
+				// ex de,hl
+				OPCODE(0xEB): EX_DE_HL(); NEXT_OPCODE();
+				// call pe,nn
+				OPCODE(0xEC): CALL_CC_NN(FLAG_PF()); NEXT_OPCODE();
+				// 0xED prefix
+				OPCODE(0xED):
+				{
+					FETCH(opcode, REGS(PC)++);
+				ed_dispatch:
+					switch (opcode) {
+						// nop
+						case 0x00: NEXT_OPCODE();
+						// nop
+						case 0x01: NEXT_OPCODE();
+						// nop
+						case 0x02: NEXT_OPCODE();
+						// nop
+						case 0x03: NEXT_OPCODE();
+						// nop
+						case 0x04: NEXT_OPCODE();
+						// nop
+						case 0x05: NEXT_OPCODE();
+						// nop
+						case 0x06: NEXT_OPCODE();
+						// nop
+						case 0x07: NEXT_OPCODE();
+						// nop
+						case 0x08: NEXT_OPCODE();
+						// nop
+						case 0x09: NEXT_OPCODE();
+						// nop
+						case 0x0A: NEXT_OPCODE();
+						// nop
+						case 0x0B: NEXT_OPCODE();
+						// nop
+						case 0x0C: NEXT_OPCODE();
+						// nop
+						case 0x0D: NEXT_OPCODE();
+						// nop
+						case 0x0E: NEXT_OPCODE();
+						// nop
+						case 0x0F: NEXT_OPCODE();
+						// nop
+						case 0x10: NEXT_OPCODE();
+						// nop
+						case 0x11: NEXT_OPCODE();
+						// nop
+						case 0x12: NEXT_OPCODE();
+						// nop
+						case 0x13: NEXT_OPCODE();
+						// nop
+						case 0x14: NEXT_OPCODE();
+						// nop
+						case 0x15: NEXT_OPCODE();
+						// nop
+						case 0x16: NEXT_OPCODE();
+						// nop
+						case 0x17: NEXT_OPCODE();
+						// nop
+						case 0x18: NEXT_OPCODE();
+						// nop
+						case 0x19: NEXT_OPCODE();
+						// nop
+						case 0x1A: NEXT_OPCODE();
+						// nop
+						case 0x1B: NEXT_OPCODE();
+						// nop
+						case 0x1C: NEXT_OPCODE();
+						// nop
+						case 0x1D: NEXT_OPCODE();
+						// nop
+						case 0x1E: NEXT_OPCODE();
+						// nop
+						case 0x1F: NEXT_OPCODE();
+						// nop
+						case 0x20: NEXT_OPCODE();
+						// nop
+						case 0x21: NEXT_OPCODE();
+						// nop
+						case 0x22: NEXT_OPCODE();
+						// nop
+						case 0x23: NEXT_OPCODE();
+						// nop
+						case 0x24: NEXT_OPCODE();
+						// nop
+						case 0x25: NEXT_OPCODE();
+						// nop
+						case 0x26: NEXT_OPCODE();
+						// nop
+						case 0x27: NEXT_OPCODE();
+						// nop
+						case 0x28: NEXT_OPCODE();
+						// nop
+						case 0x29: NEXT_OPCODE();
+						// nop
+						case 0x2A: NEXT_OPCODE();
+						// nop
+						case 0x2B: NEXT_OPCODE();
+						// nop
+						case 0x2C: NEXT_OPCODE();
+						// nop
+						case 0x2D: NEXT_OPCODE();
+						// nop
+						case 0x2E: NEXT_OPCODE();
+						// nop
+						case 0x2F: NEXT_OPCODE();
+						// nop
+						case 0x30: NEXT_OPCODE();
+						// nop
+						case 0x31: NEXT_OPCODE();
+						// nop
+						case 0x32: NEXT_OPCODE();
+						// nop
+						case 0x33: NEXT_OPCODE();
+						// nop
+						case 0x34: NEXT_OPCODE();
+						// nop
+						case 0x35: NEXT_OPCODE();
+						// nop
+						case 0x36: NEXT_OPCODE();
+						// nop
+						case 0x37: NEXT_OPCODE();
+						// nop
+						case 0x38: NEXT_OPCODE();
+						// nop
+						case 0x39: NEXT_OPCODE();
+						// nop
+						case 0x3A: NEXT_OPCODE();
+						// nop
+						case 0x3B: NEXT_OPCODE();
+						// nop
+						case 0x3C: NEXT_OPCODE();
+						// nop
+						case 0x3D: NEXT_OPCODE();
+						// nop
+						case 0x3E: NEXT_OPCODE();
+						// nop
+						case 0x3F: NEXT_OPCODE();
+						// in b,(c)
+						case 0x40: IN_R_DC(B); NEXT_OPCODE();
+						// out (c),b
+						case 0x41: OUT_DC_R(B); NEXT_OPCODE();
+						// sbc hl,bc
+						case 0x42: SBC_HL_RR(BC); NEXT_OPCODE();
+						// ld (nn),bc
+						case 0x43: LD_DNN_RR(B, C); NEXT_OPCODE();
+						// neg
+						case 0x44: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x45: RET(); NEXT_OPCODE();
+						// im 0
+						case 0x46: IM_N(0); NEXT_OPCODE();
+						// ld i,a
+						case 0x47: LD_IR_A(I); NEXT_OPCODE();
+						// in c,(c)
+						case 0x48: IN_R_DC(C); NEXT_OPCODE();
+						// out (c),c
+						case 0x49: OUT_DC_R(C); NEXT_OPCODE();
+						// adc hl,bc
+						case 0x4A: ADC_HL_RR(BC); NEXT_OPCODE();
+						// ld bc,(nn)
+						case 0x4B: LD_RR_DNN(B, C); NEXT_OPCODE();
+						// neg
+						case 0x4C: NEG(); NEXT_OPCODE();
+						// reti
+						case 0x4D: RET(); NEXT_OPCODE();
+						// im 0
+						case 0x4E: IM_N(0); NEXT_OPCODE();
+						// ld r,a
+						case 0x4F: LD_IR_A(R); NEXT_OPCODE();
+						// in d,(c)
+						case 0x50: IN_R_DC(D); NEXT_OPCODE();
+						// out (c),d
+						case 0x51: OUT_DC_R(D); NEXT_OPCODE();
+						// sbc hl,de
+						case 0x52: SBC_HL_RR(DE); NEXT_OPCODE();
+						// ld (nn),de
+						case 0x53: LD_DNN_RR(D, E); NEXT_OPCODE();
+						// neg
+						case 0x54: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x55: RET(); NEXT_OPCODE();
+						// im 1
+						case 0x56: IM_N(1); NEXT_OPCODE();
+						// ld a,i
+						case 0x57: LD_A_IR(I); NEXT_OPCODE();
+						// in e,(c)
+						case 0x58: IN_R_DC(E); NEXT_OPCODE();
+						// out (c),e
+						case 0x59: OUT_DC_R(E); NEXT_OPCODE();
+						// adc hl,de
+						case 0x5A: ADC_HL_RR(DE); NEXT_OPCODE();
+						// ld de,(nn)
+						case 0x5B: LD_RR_DNN(D, E); NEXT_OPCODE();
+						// neg
+						case 0x5C: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x5D: RET(); NEXT_OPCODE();
+						// im 2
+						case 0x5E: IM_N(2); NEXT_OPCODE();
+						// ld a,r
+						case 0x5F: LD_A_IR(R); NEXT_OPCODE();
+						// in h,(c)
+						case 0x60: IN_R_DC(H); NEXT_OPCODE();
+						// out (c),h
+						case 0x61: OUT_DC_R(H); NEXT_OPCODE();
+						// sbc hl,hl
+						case 0x62: SBC_HL_RR(HL); NEXT_OPCODE();
+						// ld (nn),hl
+						case 0x63: LD_DNN_RR(H, L); NEXT_OPCODE();
+						// neg
+						case 0x64: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x65: RET(); NEXT_OPCODE();
+						// im 0
+						case 0x66: IM_N(0); NEXT_OPCODE();
+						// rrd
+						case 0x67: RRD(); NEXT_OPCODE();
+						// in l,(c)
+						case 0x68: IN_R_DC(L); NEXT_OPCODE();
+						// out (c),l
+						case 0x69: OUT_DC_R(L); NEXT_OPCODE();
+						// adc hl,hl
+						case 0x6A: ADC_HL_RR(HL); NEXT_OPCODE();
+						// ld hl,(nn)
+						case 0x6B: LD_RR_DNN(H, L); NEXT_OPCODE();
+						// neg
+						case 0x6C: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x6D: RET(); NEXT_OPCODE();
+						// im 0
+						case 0x6E: IM_N(0); NEXT_OPCODE();
+						// rld
+						case 0x6F: RLD(); NEXT_OPCODE();
+						// in (c)
+						case 0x70: IN_DC(); NEXT_OPCODE();
+						// out (c),0
+						case 0x71: OUT_DC_0(); NEXT_OPCODE();
+						// sbc hl,sp
+						case 0x72: SBC_HL_RR(SP); NEXT_OPCODE();
+						// ld (nn),sp
+						case 0x73: LD_DNN_RR(SPH, SPL); NEXT_OPCODE();
+						// neg
+						case 0x74: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x75: RET(); NEXT_OPCODE();
+						// im 1
+						case 0x76: IM_N(1); NEXT_OPCODE();
+						// nop
+						case 0x77: NEXT_OPCODE();
+						// in a,(c)
+						case 0x78: IN_R_DC(A); NEXT_OPCODE();
+						// out (c),a
+						case 0x79: OUT_DC_R(A); NEXT_OPCODE();
+						// adc hl,sp
+						case 0x7A: ADC_HL_RR(SP); NEXT_OPCODE();
+						// ld sp,(nn)
+						case 0x7B: LD_RR_DNN(SPH, SPL); NEXT_OPCODE();
+						// neg
+						case 0x7C: NEG(); NEXT_OPCODE();
+						// retn
+						case 0x7D: RET(); NEXT_OPCODE();
+						// im 2
+						case 0x7E: IM_N(2); NEXT_OPCODE();
+						// nop
+						case 0x7F: NEXT_OPCODE();
+						// nop
+						case 0x80: NEXT_OPCODE();
+						// nop
+						case 0x81: NEXT_OPCODE();
+						// nop
+						case 0x82: NEXT_OPCODE();
+						// nop
+						case 0x83: NEXT_OPCODE();
+						// nop
+						case 0x84: NEXT_OPCODE();
+						// nop
+						case 0x85: NEXT_OPCODE();
+						// nop
+						case 0x86: NEXT_OPCODE();
+						// nop
+						case 0x87: NEXT_OPCODE();
+						// nop
+						case 0x88: NEXT_OPCODE();
+						// nop
+						case 0x89: NEXT_OPCODE();
+						// nop
+						case 0x8A: NEXT_OPCODE();
+						// nop
+						case 0x8B: NEXT_OPCODE();
+						// nop
+						case 0x8C: NEXT_OPCODE();
+						// nop
+						case 0x8D: NEXT_OPCODE();
+						// nop
+						case 0x8E: NEXT_OPCODE();
+						// nop
+						case 0x8F: NEXT_OPCODE();
+						// nop
+						case 0x90: NEXT_OPCODE();
+						// nop
+						case 0x91: NEXT_OPCODE();
+						// nop
+						case 0x92: NEXT_OPCODE();
+						// nop
+						case 0x93: NEXT_OPCODE();
+						// nop
+						case 0x94: NEXT_OPCODE();
+						// nop
+						case 0x95: NEXT_OPCODE();
+						// nop
+						case 0x96: NEXT_OPCODE();
+						// nop
+						case 0x97: NEXT_OPCODE();
+						// nop
+						case 0x98: NEXT_OPCODE();
+						// nop
+						case 0x99: NEXT_OPCODE();
+						// nop
+						case 0x9A: NEXT_OPCODE();
+						// nop
+						case 0x9B: NEXT_OPCODE();
+						// nop
+						case 0x9C: NEXT_OPCODE();
+						// nop
+						case 0x9D: NEXT_OPCODE();
+						// nop
+						case 0x9E: NEXT_OPCODE();
+						// nop
+						case 0x9F: NEXT_OPCODE();
+						// ldi
+						case 0xA0: LDI(); NEXT_OPCODE();
+						// cpi
+						case 0xA1: CPI(); NEXT_OPCODE();
+						// ini
+						case 0xA2: INI(); NEXT_OPCODE();
+						// outi
+						case 0xA3: OUTI(); NEXT_OPCODE();
+						// nop
+						case 0xA4: NEXT_OPCODE();
+						// nop
+						case 0xA5: NEXT_OPCODE();
+						// nop
+						case 0xA6: NEXT_OPCODE();
+						// nop
+						case 0xA7: NEXT_OPCODE();
+						// ldd
+						case 0xA8: LDD(); NEXT_OPCODE();
+						// cpd
+						case 0xA9: CPD(); NEXT_OPCODE();
+						// ind
+						case 0xAA: IND(); NEXT_OPCODE();
+						// outd
+						case 0xAB: OUTD(); NEXT_OPCODE();
+						// nop
+						case 0xAC: NEXT_OPCODE();
+						// nop
+						case 0xAD: NEXT_OPCODE();
+						// nop
+						case 0xAE: NEXT_OPCODE();
+						// nop
+						case 0xAF: NEXT_OPCODE();
+						// ldir
+						case 0xB0: LDIR(); NEXT_OPCODE();
+						// cpir
+						case 0xB1: CPIR(); NEXT_OPCODE();
+						// inir
+						case 0xB2: INIR(); NEXT_OPCODE();
+						// otir
+						case 0xB3: OTIR(); NEXT_OPCODE();
+						// nop
+						case 0xB4: NEXT_OPCODE();
+						// nop
+						case 0xB5: NEXT_OPCODE();
+						// nop
+						case 0xB6: NEXT_OPCODE();
+						// nop
+						case 0xB7: NEXT_OPCODE();
+						// lddr
+						case 0xB8: LDDR(); NEXT_OPCODE();
+						// cpdr
+						case 0xB9: CPDR(); NEXT_OPCODE();
+						// indr
+						case 0xBA: INDR(); NEXT_OPCODE();
+						// otdr
+						case 0xBB: OTDR(); NEXT_OPCODE();
+						// nop
+						case 0xBC: NEXT_OPCODE();
+						// nop
+						case 0xBD: NEXT_OPCODE();
+						// nop
+						case 0xBE: NEXT_OPCODE();
+						// nop
+						case 0xBF: NEXT_OPCODE();
+						// nop
+						case 0xC0: NEXT_OPCODE();
+						// nop
+						case 0xC1: NEXT_OPCODE();
+						// nop
+						case 0xC2: NEXT_OPCODE();
+						// nop
+						case 0xC3: NEXT_OPCODE();
+						// nop
+						case 0xC4: NEXT_OPCODE();
+						// nop
+						case 0xC5: NEXT_OPCODE();
+						// nop
+						case 0xC6: NEXT_OPCODE();
+						// nop
+						case 0xC7: NEXT_OPCODE();
+						// nop
+						case 0xC8: NEXT_OPCODE();
+						// nop
+						case 0xC9: NEXT_OPCODE();
+						// nop
+						case 0xCA: NEXT_OPCODE();
+						// nop
+						case 0xCB: NEXT_OPCODE();
+						// nop
+						case 0xCC: NEXT_OPCODE();
+						// nop
+						case 0xCD: NEXT_OPCODE();
+						// nop
+						case 0xCE: NEXT_OPCODE();
+						// nop
+						case 0xCF: NEXT_OPCODE();
+						// nop
+						case 0xD0: NEXT_OPCODE();
+						// nop
+						case 0xD1: NEXT_OPCODE();
+						// nop
+						case 0xD2: NEXT_OPCODE();
+						// nop
+						case 0xD3: NEXT_OPCODE();
+						// nop
+						case 0xD4: NEXT_OPCODE();
+						// nop
+						case 0xD5: NEXT_OPCODE();
+						// nop
+						case 0xD6: NEXT_OPCODE();
+						// nop
+						case 0xD7: NEXT_OPCODE();
+						// nop
+						case 0xD8: NEXT_OPCODE();
+						// nop
+						case 0xD9: NEXT_OPCODE();
+						// nop
+						case 0xDA: NEXT_OPCODE();
+						// nop
+						case 0xDB: NEXT_OPCODE();
+						// nop
+						case 0xDC: NEXT_OPCODE();
+						// nop
+						case 0xDD: NEXT_OPCODE();
+						// nop
+						case 0xDE: NEXT_OPCODE();
+						// nop
+						case 0xDF: NEXT_OPCODE();
+						// nop
+						case 0xE0: NEXT_OPCODE();
+						// nop
+						case 0xE1: NEXT_OPCODE();
+						// nop
+						case 0xE2: NEXT_OPCODE();
+						// nop
+						case 0xE3: NEXT_OPCODE();
+						// nop
+						case 0xE4: NEXT_OPCODE();
+						// nop
+						case 0xE5: NEXT_OPCODE();
+						// nop
+						case 0xE6: NEXT_OPCODE();
+						// nop
+						case 0xE7: NEXT_OPCODE();
+						// nop
+						case 0xE8: NEXT_OPCODE();
+						// nop
+						case 0xE9: NEXT_OPCODE();
+						// nop
+						case 0xEA: NEXT_OPCODE();
+						// nop
+						case 0xEB: NEXT_OPCODE();
+						// nop
+						case 0xEC: NEXT_OPCODE();
+						// nop
+						case 0xED: NEXT_OPCODE();
+						// nop
+						case 0xEE: NEXT_OPCODE();
+						// nop
+						case 0xEF: NEXT_OPCODE();
+						// nop
+						case 0xF0: NEXT_OPCODE();
+						// nop
+						case 0xF1: NEXT_OPCODE();
+						// nop
+						case 0xF2: NEXT_OPCODE();
+						// nop
+						case 0xF3: NEXT_OPCODE();
+						// nop
+						case 0xF4: NEXT_OPCODE();
+						// nop
+						case 0xF5: NEXT_OPCODE();
+						// nop
+						case 0xF6: NEXT_OPCODE();
+						// nop
+						case 0xF7: NEXT_OPCODE();
+						// nop
+						case 0xF8: NEXT_OPCODE();
+						// nop
+						case 0xF9: NEXT_OPCODE();
+						// nop
+						case 0xFA: NEXT_OPCODE();
+						// nop
+						case 0xFB: NEXT_OPCODE();
+						// nop
+						case 0xFC: NEXT_OPCODE();
+						// nop
+						case 0xFD: NEXT_OPCODE();
+						// nop
+						case 0xFE: NEXT_OPCODE();
+						// nop
+						case 0xFF: NEXT_OPCODE();
+					}
+
+					break;
+				}
+				// xor a,n
+				OPCODE(0xEE): XOR_A_N(); NEXT_OPCODE();
+				// rst 0x28
+				OPCODE(0xEF): RST(0x28); NEXT_OPCODE();
+				// ret p
+				OPCODE(0xF0): RET_CC(!FLAG_SF()); NEXT_OPCODE();
+				// pop af
+				OPCODE(0xF1): POP_AF(); NEXT_OPCODE();
+				// jp p,nn
+				OPCODE(0xF2): JP_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+				// di
+				OPCODE(0xF3): DI(); NEXT_OPCODE();
+				// call p,nn
+				OPCODE(0xF4): CALL_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+				// push af
+				OPCODE(0xF5): PUSH_AF(); NEXT_OPCODE();
+				// or a,n
+				OPCODE(0xF6): OR_A_N(); NEXT_OPCODE();
+				// rst 0x30
+				OPCODE(0xF7): RST(0x30); NEXT_OPCODE();
+				// ret m
+				OPCODE(0xF8): RET_CC(FLAG_SF()); NEXT_OPCODE();
+				// ld sp,hl
+				OPCODE(0xF9): LD_SP_RR(HL); NEXT_OPCODE();
+				// jp m,nn
+				OPCODE(0xFA): JP_CC_NN(FLAG_SF()); NEXT_OPCODE();
+				// ei
+				OPCODE(0xFB): EI(); NEXT_OPCODE();
+				// call m,nn
+				OPCODE(0xFC): CALL_CC_NN(FLAG_SF()); NEXT_OPCODE();
+				// 0xFD prefix
+				OPCODE(0xFD):
+				{
+					FETCH(opcode, REGS(PC)++);
+				fd_dispatch:
+					switch (opcode) {
+						// nop
+						case 0x00: NEXT_OPCODE();
+						// ld bc,nn
+						case 0x01: LD_RR_NN(B, C); NEXT_OPCODE();
+						// ld (bc),a
+						case 0x02: LD_DRR_A(BC); NEXT_OPCODE();
+						// inc bc
+						case 0x03: INC_RR(BC); NEXT_OPCODE();
+						// inc b
+						case 0x04: INC_R(B); NEXT_OPCODE();
+						// dec b
+						case 0x05: DEC_R(B); NEXT_OPCODE();
+						// ld b,n
+						case 0x06: LD_R_N(B); NEXT_OPCODE();
+						// rlca
+						case 0x07: RLCA(); NEXT_OPCODE();
+						// ex af,af'
+						case 0x08: EX_AF_AF(); NEXT_OPCODE();
+						// add iy,bc
+						case 0x09: ADD_RR_RR(IY, BC); NEXT_OPCODE();
+						// ld a,(bc)
+						case 0x0A: LD_A_DRR(BC); NEXT_OPCODE();
+						// dec bc
+						case 0x0B: DEC_RR(BC); NEXT_OPCODE();
+						// inc c
+						case 0x0C: INC_R(C); NEXT_OPCODE();
+						// dec c
+						case 0x0D: DEC_R(C); NEXT_OPCODE();
+						// ld c,n
+						case 0x0E: LD_R_N(C); NEXT_OPCODE();
+						// rrca
+						case 0x0F: RRCA(); NEXT_OPCODE();
+						// djnz e
+						case 0x10: DJNZ_E(); NEXT_OPCODE();
+						// ld de,nn
+						case 0x11: LD_RR_NN(D, E); NEXT_OPCODE();
+						// ld (de),a
+						case 0x12: LD_DRR_A(DE); NEXT_OPCODE();
+						// inc de
+						case 0x13: INC_RR(DE); NEXT_OPCODE();
+						// inc d
+						case 0x14: INC_R(D); NEXT_OPCODE();
+						// dec d
+						case 0x15: DEC_R(D); NEXT_OPCODE();
+						// ld d,n
+						case 0x16: LD_R_N(D); NEXT_OPCODE();
+						// rla
+						case 0x17: RLA(); NEXT_OPCODE();
+						// jr e
+						case 0x18: JR_CC_E(true); NEXT_OPCODE();
+						// add iy,de
+						case 0x19: ADD_RR_RR(IY, DE); NEXT_OPCODE();
+						// ld a,(de)
+						case 0x1A: LD_A_DRR(DE); NEXT_OPCODE();
+						// dec de
+						case 0x1B: DEC_RR(DE); NEXT_OPCODE();
+						// inc e
+						case 0x1C: INC_R(E); NEXT_OPCODE();
+						// dec e
+						case 0x1D: DEC_R(E); NEXT_OPCODE();
+						// ld e,n
+						case 0x1E: LD_R_N(E); NEXT_OPCODE();
+						// rra
+						case 0x1F: RRA(); NEXT_OPCODE();
+						// jr nz,e
+						case 0x20: JR_CC_E(!FLAG_ZF()); NEXT_OPCODE();
+						// ld iy,nn
+						case 0x21: LD_RR_NN(IYH, IYL); NEXT_OPCODE();
+						// ld (nn),iy
+						case 0x22: LD_DNN_RR(IYH, IYL); NEXT_OPCODE();
+						// inc iy
+						case 0x23: INC_RR(IY); NEXT_OPCODE();
+						// inc iyh
+						case 0x24: INC_R(IYH); NEXT_OPCODE();
+						// dec iyh
+						case 0x25: DEC_R(IYH); NEXT_OPCODE();
+						// ld iyh,n
+						case 0x26: LD_R_N(IYH); NEXT_OPCODE();
+						// daa
+						case 0x27: DAA(); NEXT_OPCODE();
+						// jr z,e
+						case 0x28: JR_CC_E(FLAG_ZF()); NEXT_OPCODE();
+						// add iy,iy
+						case 0x29: ADD_RR_RR(IY, IY); NEXT_OPCODE();
+						// ld iy,(nn)
+						case 0x2A: LD_RR_DNN(IYH, IYL); NEXT_OPCODE();
+						// dec iy
+						case 0x2B: DEC_RR(IY); NEXT_OPCODE();
+						// inc iyl
+						case 0x2C: INC_R(IYL); NEXT_OPCODE();
+						// dec iyl
+						case 0x2D: DEC_R(IYL); NEXT_OPCODE();
+						// ld iyl,n
+						case 0x2E: LD_R_N(IYL); NEXT_OPCODE();
+						// cpl
+						case 0x2F: CPL(); NEXT_OPCODE();
+						// jr nc,e
+						case 0x30: JR_CC_E(!FLAG_CF()); NEXT_OPCODE();
+						// ld sp,nn
+						case 0x31: LD_RR_NN(SPH, SPL); NEXT_OPCODE();
+						// ld (nn),a
+						case 0x32: LD_DNN_A(); NEXT_OPCODE();
+						// inc sp
+						case 0x33: INC_RR(SP); NEXT_OPCODE();
+						// inc (iy+e)
+						case 0x34: INC_DRR_E(IY); NEXT_OPCODE();
+						// dec (iy+e)
+						case 0x35: DEC_DRR_E(IY); NEXT_OPCODE();
+						// ld (iy+e),n
+						case 0x36: LD_DRR_E_N(IY); NEXT_OPCODE();
+						// scf
+						case 0x37: SCF(); NEXT_OPCODE();
+						// jr c,e
+						case 0x38: JR_CC_E(FLAG_CF()); NEXT_OPCODE();
+						// add iy,sp
+						case 0x39: ADD_RR_RR(IY, SP); NEXT_OPCODE();
+						// ld a,(nn)
+						case 0x3A: LD_A_DNN(); NEXT_OPCODE();
+						// dec sp
+						case 0x3B: DEC_RR(SP); NEXT_OPCODE();
+						// inc a
+						case 0x3C: INC_R(A); NEXT_OPCODE();
+						// dec a
+						case 0x3D: DEC_R(A); NEXT_OPCODE();
+						// ld a,n
+						case 0x3E: LD_R_N(A); NEXT_OPCODE();
+						// ccf
+						case 0x3F: CCF(); NEXT_OPCODE();
+						// ld b,b
+						case 0x40: LD_R_R(B, B); NEXT_OPCODE();
+						// ld b,c
+						case 0x41: LD_R_R(B, C); NEXT_OPCODE();
+						// ld b,d
+						case 0x42: LD_R_R(B, D); NEXT_OPCODE();
+						// ld b,e
+						case 0x43: LD_R_R(B, E); NEXT_OPCODE();
+						// ld b,iyh
+						case 0x44: LD_R_R(B, IYH); NEXT_OPCODE();
+						// ld b,iyl
+						case 0x45: LD_R_R(B, IYL); NEXT_OPCODE();
+						// ld b,(iy+e)
+						case 0x46: LD_R_DRR_E(B, IY); NEXT_OPCODE();
+						// ld b,a
+						case 0x47: LD_R_R(B, A); NEXT_OPCODE();
+						// ld c,b
+						case 0x48: LD_R_R(C, B); NEXT_OPCODE();
+						// ld c,c
+						case 0x49: LD_R_R(C, C); NEXT_OPCODE();
+						// ld c,d
+						case 0x4A: LD_R_R(C, D); NEXT_OPCODE();
+						// ld c,e
+						case 0x4B: LD_R_R(C, E); NEXT_OPCODE();
+						// ld c,iyh
+						case 0x4C: LD_R_R(C, IYH); NEXT_OPCODE();
+						// ld c,iyl
+						case 0x4D: LD_R_R(C, IYL); NEXT_OPCODE();
+						// ld c,(iy+e)
+						case 0x4E: LD_R_DRR_E(C, IY); NEXT_OPCODE();
+						// ld c,a
+						case 0x4F: LD_R_R(C, A); NEXT_OPCODE();
+						// ld d,b
+						case 0x50: LD_R_R(D, B); NEXT_OPCODE();
+						// ld d,c
+						case 0x51: LD_R_R(D, C); NEXT_OPCODE();
+						// ld d,d
+						case 0x52: LD_R_R(D, D); NEXT_OPCODE();
+						// ld d,e
+						case 0x53: LD_R_R(D, E); NEXT_OPCODE();
+						// ld d,iyh
+						case 0x54: LD_R_R(D, IYH); NEXT_OPCODE();
+						// ld d,iyl
+						case 0x55: LD_R_R(D, IYL); NEXT_OPCODE();
+						// ld d,(iy+e)
+						case 0x56: LD_R_DRR_E(D, IY); NEXT_OPCODE();
+						// ld d,a
+						case 0x57: LD_R_R(D, A); NEXT_OPCODE();
+						// ld e,b
+						case 0x58: LD_R_R(E, B); NEXT_OPCODE();
+						// ld e,c
+						case 0x59: LD_R_R(E, C); NEXT_OPCODE();
+						// ld e,d
+						case 0x5A: LD_R_R(E, D); NEXT_OPCODE();
+						// ld e,e
+						case 0x5B: LD_R_R(E, E); NEXT_OPCODE();
+						// ld e,iyh
+						case 0x5C: LD_R_R(E, IYH); NEXT_OPCODE();
+						// ld e,iyl
+						case 0x5D: LD_R_R(E, IYL); NEXT_OPCODE();
+						// ld e,(iy+e)
+						case 0x5E: LD_R_DRR_E(E, IY); NEXT_OPCODE();
+						// ld e,a
+						case 0x5F: LD_R_R(E, A); NEXT_OPCODE();
+						// ld iyh,b
+						case 0x60: LD_R_R(IYH, B); NEXT_OPCODE();
+						// ld iyh,c
+						case 0x61: LD_R_R(IYH, C); NEXT_OPCODE();
+						// ld iyh,d
+						case 0x62: LD_R_R(IYH, D); NEXT_OPCODE();
+						// ld iyh,e
+						case 0x63: LD_R_R(IYH, E); NEXT_OPCODE();
+						// ld iyh,iyh
+						case 0x64: LD_R_R(IYH, IYH); NEXT_OPCODE();
+						// ld iyh,iyl
+						case 0x65: LD_R_R(IYH, IYL); NEXT_OPCODE();
+						// ld h,(iy+e)
+						case 0x66: LD_R_DRR_E(H, IY); NEXT_OPCODE();
+						// ld iyh,a
+						case 0x67: LD_R_R(IYH, A); NEXT_OPCODE();
+						// ld iyl,b
+						case 0x68: LD_R_R(IYL, B); NEXT_OPCODE();
+						// ld iyl,c
+						case 0x69: LD_R_R(IYL, C); NEXT_OPCODE();
+						// ld iyl,d
+						case 0x6A: LD_R_R(IYL, D); NEXT_OPCODE();
+						// ld iyl,e
+						case 0x6B: LD_R_R(IYL, E); NEXT_OPCODE();
+						// ld iyl,iyh
+						case 0x6C: LD_R_R(IYL, IYH); NEXT_OPCODE();
+						// ld iyl,iyl
+						case 0x6D: LD_R_R(IYL, IYL); NEXT_OPCODE();
+						// ld l,(iy+e)
+						case 0x6E: LD_R_DRR_E(L, IY); NEXT_OPCODE();
+						// ld iyl,a
+						case 0x6F: LD_R_R(IYL, A); NEXT_OPCODE();
+						// ld (iy+e),b
+						case 0x70: LD_DRR_E_R(IY, B); NEXT_OPCODE();
+						// ld (iy+e),c
+						case 0x71: LD_DRR_E_R(IY, C); NEXT_OPCODE();
+						// ld (iy+e),d
+						case 0x72: LD_DRR_E_R(IY, D); NEXT_OPCODE();
+						// ld (iy+e),e
+						case 0x73: LD_DRR_E_R(IY, E); NEXT_OPCODE();
+						// ld (iy+e),h
+						case 0x74: LD_DRR_E_R(IY, H); NEXT_OPCODE();
+						// ld (iy+e),l
+						case 0x75: LD_DRR_E_R(IY, L); NEXT_OPCODE();
+						// halt
+						case 0x76: HALT(); NEXT_OPCODE();
+						// ld (iy+e),a
+						case 0x77: LD_DRR_E_R(IY, A); NEXT_OPCODE();
+						// ld a,b
+						case 0x78: LD_R_R(A, B); NEXT_OPCODE();
+						// ld a,c
+						case 0x79: LD_R_R(A, C); NEXT_OPCODE();
+						// ld a,d
+						case 0x7A: LD_R_R(A, D); NEXT_OPCODE();
+						// ld a,e
+						case 0x7B: LD_R_R(A, E); NEXT_OPCODE();
+						// ld a,iyh
+						case 0x7C: LD_R_R(A, IYH); NEXT_OPCODE();
+						// ld a,iyl
+						case 0x7D: LD_R_R(A, IYL); NEXT_OPCODE();
+						// ld a,(iy+e)
+						case 0x7E: LD_R_DRR_E(A, IY); NEXT_OPCODE();
+						// ld a,a
+						case 0x7F: LD_R_R(A, A); NEXT_OPCODE();
+						// add a,b
+						case 0x80: ADD_A_R(B); NEXT_OPCODE();
+						// add a,c
+						case 0x81: ADD_A_R(C); NEXT_OPCODE();
+						// add a,d
+						case 0x82: ADD_A_R(D); NEXT_OPCODE();
+						// add a,e
+						case 0x83: ADD_A_R(E); NEXT_OPCODE();
+						// add a,iyh
+						case 0x84: ADD_A_R(IYH); NEXT_OPCODE();
+						// add a,iyl
+						case 0x85: ADD_A_R(IYL); NEXT_OPCODE();
+						// add a,(iy+e)
+						case 0x86: ADD_A_DRR_E(IY); NEXT_OPCODE();
+						// add a,a
+						case 0x87: ADD_A_R(A); NEXT_OPCODE();
+						// adc a,b
+						case 0x88: ADC_A_R(B); NEXT_OPCODE();
+						// adc a,c
+						case 0x89: ADC_A_R(C); NEXT_OPCODE();
+						// adc a,d
+						case 0x8A: ADC_A_R(D); NEXT_OPCODE();
+						// adc a,e
+						case 0x8B: ADC_A_R(E); NEXT_OPCODE();
+						// adc a,iyh
+						case 0x8C: ADC_A_R(IYH); NEXT_OPCODE();
+						// adc a,iyl
+						case 0x8D: ADC_A_R(IYL); NEXT_OPCODE();
+						// adc a,(iy+e)
+						case 0x8E: ADC_A_DRR_E(IY); NEXT_OPCODE();
+						// adc a,a
+						case 0x8F: ADC_A_R(A); NEXT_OPCODE();
+						// sub a,b
+						case 0x90: SUB_A_R(B); NEXT_OPCODE();
+						// sub a,c
+						case 0x91: SUB_A_R(C); NEXT_OPCODE();
+						// sub a,d
+						case 0x92: SUB_A_R(D); NEXT_OPCODE();
+						// sub a,e
+						case 0x93: SUB_A_R(E); NEXT_OPCODE();
+						// sub a,iyh
+						case 0x94: SUB_A_R(IYH); NEXT_OPCODE();
+						// sub a,iyl
+						case 0x95: SUB_A_R(IYL); NEXT_OPCODE();
+						// sub a,(iy+e)
+						case 0x96: SUB_A_DRR_E(IY); NEXT_OPCODE();
+						// sub a,a
+						case 0x97: SUB_A_R(A); NEXT_OPCODE();
+						// sbc a,b
+						case 0x98: SBC_A_R(B); NEXT_OPCODE();
+						// sbc a,c
+						case 0x99: SBC_A_R(C); NEXT_OPCODE();
+						// sbc a,d
+						case 0x9A: SBC_A_R(D); NEXT_OPCODE();
+						// sbc a,e
+						case 0x9B: SBC_A_R(E); NEXT_OPCODE();
+						// sbc a,iyh
+						case 0x9C: SBC_A_R(IYH); NEXT_OPCODE();
+						// sbc a,iyl
+						case 0x9D: SBC_A_R(IYL); NEXT_OPCODE();
+						// sbc a,(iy+e)
+						case 0x9E: SBC_A_DRR_E(IY); NEXT_OPCODE();
+						// sbc a,a
+						case 0x9F: SBC_A_R(A); NEXT_OPCODE();
+						// and a,b
+						case 0xA0: AND_A_R(B); NEXT_OPCODE();
+						// and a,c
+						case 0xA1: AND_A_R(C); NEXT_OPCODE();
+						// and a,d
+						case 0xA2: AND_A_R(D); NEXT_OPCODE();
+						// and a,e
+						case 0xA3: AND_A_R(E); NEXT_OPCODE();
+						// and a,iyh
+						case 0xA4: AND_A_R(IYH); NEXT_OPCODE();
+						// and a,iyl
+						case 0xA5: AND_A_R(IYL); NEXT_OPCODE();
+						// and a,(iy+e)
+						case 0xA6: AND_A_DRR_E(IY); NEXT_OPCODE();
+						// and a,a
+						case 0xA7: AND_A_R(A); NEXT_OPCODE();
+						// xor a,b
+						case 0xA8: XOR_A_R(B); NEXT_OPCODE();
+						// xor a,c
+						case 0xA9: XOR_A_R(C); NEXT_OPCODE();
+						// xor a,d
+						case 0xAA: XOR_A_R(D); NEXT_OPCODE();
+						// xor a,e
+						case 0xAB: XOR_A_R(E); NEXT_OPCODE();
+						// xor a,iyh
+						case 0xAC: XOR_A_R(IYH); NEXT_OPCODE();
+						// xor a,iyl
+						case 0xAD: XOR_A_R(IYL); NEXT_OPCODE();
+						// xor a,(iy+e)
+						case 0xAE: XOR_A_DRR_E(IY); NEXT_OPCODE();
+						// xor a,a
+						case 0xAF: XOR_A_R(A); NEXT_OPCODE();
+						// or a,b
+						case 0xB0: OR_A_R(B); NEXT_OPCODE();
+						// or a,c
+						case 0xB1: OR_A_R(C); NEXT_OPCODE();
+						// or a,d
+						case 0xB2: OR_A_R(D); NEXT_OPCODE();
+						// or a,e
+						case 0xB3: OR_A_R(E); NEXT_OPCODE();
+						// or a,iyh
+						case 0xB4: OR_A_R(IYH); NEXT_OPCODE();
+						// or a,iyl
+						case 0xB5: OR_A_R(IYL); NEXT_OPCODE();
+						// or a,(iy+e)
+						case 0xB6: OR_A_DRR_E(IY); NEXT_OPCODE();
+						// or a,a
+						case 0xB7: OR_A_R(A); NEXT_OPCODE();
+						// cp a,b
+						case 0xB8: CP_A_R(B); NEXT_OPCODE();
+						// cp a,c
+						case 0xB9: CP_A_R(C); NEXT_OPCODE();
+						// cp a,d
+						case 0xBA: CP_A_R(D); NEXT_OPCODE();
+						// cp a,e
+						case 0xBB: CP_A_R(E); NEXT_OPCODE();
+						// cp a,iyh
+						case 0xBC: CP_A_R(IYH); NEXT_OPCODE();
+						// cp a,iyl
+						case 0xBD: CP_A_R(IYL); NEXT_OPCODE();
+						// cp a,(iy+e)
+						case 0xBE: CP_A_DRR_E(IY); NEXT_OPCODE();
+						// cp a,a
+						case 0xBF: CP_A_R(A); NEXT_OPCODE();
+						// ret nz
+						case 0xC0: RET_CC(!FLAG_ZF()); NEXT_OPCODE();
+						// pop bc
+						case 0xC1: POP(B, C); NEXT_OPCODE();
+						// jp nz,nn
+						case 0xC2: JP_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+						// jp nn
+						case 0xC3: JP_CC_NN(true); NEXT_OPCODE();
+						// call nz,nn
+						case 0xC4: CALL_CC_NN(!FLAG_ZF()); NEXT_OPCODE();
+						// push bc
+						case 0xC5: PUSH(B, C); NEXT_OPCODE();
+						// add a,n
+						case 0xC6: ADD_A_N(); NEXT_OPCODE();
+						// rst 0x00
+						case 0xC7: RST(0x00); NEXT_OPCODE();
+						// ret z
+						case 0xC8: RET_CC(FLAG_ZF()); NEXT_OPCODE();
+						// ret
+						case 0xC9: RET(); NEXT_OPCODE();
+						// jp z,nn
+						case 0xCA: JP_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+						// 0xFDCB prefix
+						case 0xCB:
+						{
+							u8 e;
+							READ_PC(e);
+							READ_PC(opcode);
+							cyclesLeft -= 2;
+							REGS(WZ) = REGS(IY) + SIGNED(e, s8);
+							switch (opcode) {
+								// rlc (iy+e),b
+								case 0x00: RLC_DRR_E_R(B); NEXT_OPCODE();
+								// rlc (iy+e),c
+								case 0x01: RLC_DRR_E_R(C); NEXT_OPCODE();
+								// rlc (iy+e),d
+								case 0x02: RLC_DRR_E_R(D); NEXT_OPCODE();
+								// rlc (iy+e),e
+								case 0x03: RLC_DRR_E_R(E); NEXT_OPCODE();
+								// rlc (iy+e),h
+								case 0x04: RLC_DRR_E_R(H); NEXT_OPCODE();
+								// rlc (iy+e),l
+								case 0x05: RLC_DRR_E_R(L); NEXT_OPCODE();
+								// rlc (iy+e)
+								case 0x06: RLC_DRR_E(); NEXT_OPCODE();
+								// rlc (iy+e),a
+								case 0x07: RLC_DRR_E_R(A); NEXT_OPCODE();
+								// rrc (iy+e),b
+								case 0x08: RRC_DRR_E_R(B); NEXT_OPCODE();
+								// rrc (iy+e),c
+								case 0x09: RRC_DRR_E_R(C); NEXT_OPCODE();
+								// rrc (iy+e),d
+								case 0x0A: RRC_DRR_E_R(D); NEXT_OPCODE();
+								// rrc (iy+e),e
+								case 0x0B: RRC_DRR_E_R(E); NEXT_OPCODE();
+								// rrc (iy+e),h
+								case 0x0C: RRC_DRR_E_R(H); NEXT_OPCODE();
+								// rrc (iy+e),l
+								case 0x0D: RRC_DRR_E_R(L); NEXT_OPCODE();
+								// rrc (iy+e)
+								case 0x0E: RRC_DRR_E(); NEXT_OPCODE();
+								// rrc (iy+e),a
+								case 0x0F: RRC_DRR_E_R(A); NEXT_OPCODE();
+								// rl (iy+e),b
+								case 0x10: RL_DRR_E_R(B); NEXT_OPCODE();
+								// rl (iy+e),c
+								case 0x11: RL_DRR_E_R(C); NEXT_OPCODE();
+								// rl (iy+e),d
+								case 0x12: RL_DRR_E_R(D); NEXT_OPCODE();
+								// rl (iy+e),e
+								case 0x13: RL_DRR_E_R(E); NEXT_OPCODE();
+								// rl (iy+e),h
+								case 0x14: RL_DRR_E_R(H); NEXT_OPCODE();
+								// rl (iy+e),l
+								case 0x15: RL_DRR_E_R(L); NEXT_OPCODE();
+								// rl (iy+e)
+								case 0x16: RL_DRR_E(); NEXT_OPCODE();
+								// rl (iy+e),a
+								case 0x17: RL_DRR_E_R(A); NEXT_OPCODE();
+								// rr (iy+e),b
+								case 0x18: RR_DRR_E_R(B); NEXT_OPCODE();
+								// rr (iy+e),c
+								case 0x19: RR_DRR_E_R(C); NEXT_OPCODE();
+								// rr (iy+e),d
+								case 0x1A: RR_DRR_E_R(D); NEXT_OPCODE();
+								// rr (iy+e),e
+								case 0x1B: RR_DRR_E_R(E); NEXT_OPCODE();
+								// rr (iy+e),h
+								case 0x1C: RR_DRR_E_R(H); NEXT_OPCODE();
+								// rr (iy+e),l
+								case 0x1D: RR_DRR_E_R(L); NEXT_OPCODE();
+								// rr (iy+e)
+								case 0x1E: RR_DRR_E(); NEXT_OPCODE();
+								// rr (iy+e),a
+								case 0x1F: RR_DRR_E_R(A); NEXT_OPCODE();
+								// sla (iy+e),b
+								case 0x20: SLA_DRR_E_R(B); NEXT_OPCODE();
+								// sla (iy+e),c
+								case 0x21: SLA_DRR_E_R(C); NEXT_OPCODE();
+								// sla (iy+e),d
+								case 0x22: SLA_DRR_E_R(D); NEXT_OPCODE();
+								// sla (iy+e),e
+								case 0x23: SLA_DRR_E_R(E); NEXT_OPCODE();
+								// sla (iy+e),h
+								case 0x24: SLA_DRR_E_R(H); NEXT_OPCODE();
+								// sla (iy+e),l
+								case 0x25: SLA_DRR_E_R(L); NEXT_OPCODE();
+								// sla (iy+e)
+								case 0x26: SLA_DRR_E(); NEXT_OPCODE();
+								// sla (iy+e),a
+								case 0x27: SLA_DRR_E_R(A); NEXT_OPCODE();
+								// sra (iy+e),b
+								case 0x28: SRA_DRR_E_R(B); NEXT_OPCODE();
+								// sra (iy+e),c
+								case 0x29: SRA_DRR_E_R(C); NEXT_OPCODE();
+								// sra (iy+e),d
+								case 0x2A: SRA_DRR_E_R(D); NEXT_OPCODE();
+								// sra (iy+e),e
+								case 0x2B: SRA_DRR_E_R(E); NEXT_OPCODE();
+								// sra (iy+e),h
+								case 0x2C: SRA_DRR_E_R(H); NEXT_OPCODE();
+								// sra (iy+e),l
+								case 0x2D: SRA_DRR_E_R(L); NEXT_OPCODE();
+								// sra (iy+e)
+								case 0x2E: SRA_DRR_E(); NEXT_OPCODE();
+								// sra (iy+e),a
+								case 0x2F: SRA_DRR_E_R(A); NEXT_OPCODE();
+								// sll (iy+e),b
+								case 0x30: SLL_DRR_E_R(B); NEXT_OPCODE();
+								// sll (iy+e),c
+								case 0x31: SLL_DRR_E_R(C); NEXT_OPCODE();
+								// sll (iy+e),d
+								case 0x32: SLL_DRR_E_R(D); NEXT_OPCODE();
+								// sll (iy+e),e
+								case 0x33: SLL_DRR_E_R(E); NEXT_OPCODE();
+								// sll (iy+e),h
+								case 0x34: SLL_DRR_E_R(H); NEXT_OPCODE();
+								// sll (iy+e),l
+								case 0x35: SLL_DRR_E_R(L); NEXT_OPCODE();
+								// sll (iy+e)
+								case 0x36: SLL_DRR_E(); NEXT_OPCODE();
+								// sll (iy+e),a
+								case 0x37: SLL_DRR_E_R(A); NEXT_OPCODE();
+								// srl (iy+e),b
+								case 0x38: SRL_DRR_E_R(B); NEXT_OPCODE();
+								// srl (iy+e),c
+								case 0x39: SRL_DRR_E_R(C); NEXT_OPCODE();
+								// srl (iy+e),d
+								case 0x3A: SRL_DRR_E_R(D); NEXT_OPCODE();
+								// srl (iy+e),e
+								case 0x3B: SRL_DRR_E_R(E); NEXT_OPCODE();
+								// srl (iy+e),h
+								case 0x3C: SRL_DRR_E_R(H); NEXT_OPCODE();
+								// srl (iy+e),l
+								case 0x3D: SRL_DRR_E_R(L); NEXT_OPCODE();
+								// srl (iy+e)
+								case 0x3E: SRL_DRR_E(); NEXT_OPCODE();
+								// srl (iy+e),a
+								case 0x3F: SRL_DRR_E_R(A); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x40: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x41: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x42: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x43: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x44: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x45: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x46: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 0,(iy+e)
+								case 0x47: BIT_N_DRR_E(0); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x48: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x49: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4A: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4B: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4C: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4D: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4E: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 1,(iy+e)
+								case 0x4F: BIT_N_DRR_E(1); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x50: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x51: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x52: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x53: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x54: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x55: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x56: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 2,(iy+e)
+								case 0x57: BIT_N_DRR_E(2); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x58: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x59: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5A: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5B: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5C: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5D: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5E: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 3,(iy+e)
+								case 0x5F: BIT_N_DRR_E(3); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x60: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x61: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x62: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x63: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x64: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x65: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x66: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 4,(iy+e)
+								case 0x67: BIT_N_DRR_E(4); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x68: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x69: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6A: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6B: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6C: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6D: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6E: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 5,(iy+e)
+								case 0x6F: BIT_N_DRR_E(5); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x70: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x71: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x72: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x73: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x74: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x75: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x76: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 6,(iy+e)
+								case 0x77: BIT_N_DRR_E(6); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x78: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x79: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7A: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7B: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7C: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7D: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7E: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// bit 7,(iy+e)
+								case 0x7F: BIT_N_DRR_E(7); NEXT_OPCODE();
+								// res 0,(iy+e),b
+								case 0x80: RES_N_DRR_E_R(0, B); NEXT_OPCODE();
+								// res 0,(iy+e),c
+								case 0x81: RES_N_DRR_E_R(0, C); NEXT_OPCODE();
+								// res 0,(iy+e),d
+								case 0x82: RES_N_DRR_E_R(0, D); NEXT_OPCODE();
+								// res 0,(iy+e),e
+								case 0x83: RES_N_DRR_E_R(0, E); NEXT_OPCODE();
+								// res 0,(iy+e),h
+								case 0x84: RES_N_DRR_E_R(0, H); NEXT_OPCODE();
+								// res 0,(iy+e),l
+								case 0x85: RES_N_DRR_E_R(0, L); NEXT_OPCODE();
+								// res 0,(iy+e)
+								case 0x86: RES_N_DRR_E(0); NEXT_OPCODE();
+								// res 0,(iy+e),a
+								case 0x87: RES_N_DRR_E_R(0, A); NEXT_OPCODE();
+								// res 1,(iy+e),b
+								case 0x88: RES_N_DRR_E_R(1, B); NEXT_OPCODE();
+								// res 1,(iy+e),c
+								case 0x89: RES_N_DRR_E_R(1, C); NEXT_OPCODE();
+								// res 1,(iy+e),d
+								case 0x8A: RES_N_DRR_E_R(1, D); NEXT_OPCODE();
+								// res 1,(iy+e),e
+								case 0x8B: RES_N_DRR_E_R(1, E); NEXT_OPCODE();
+								// res 1,(iy+e),h
+								case 0x8C: RES_N_DRR_E_R(1, H); NEXT_OPCODE();
+								// res 1,(iy+e),l
+								case 0x8D: RES_N_DRR_E_R(1, L); NEXT_OPCODE();
+								// res 1,(iy+e)
+								case 0x8E: RES_N_DRR_E(1); NEXT_OPCODE();
+								// res 1,(iy+e),a
+								case 0x8F: RES_N_DRR_E_R(1, A); NEXT_OPCODE();
+								// res 2,(iy+e),b
+								case 0x90: RES_N_DRR_E_R(2, B); NEXT_OPCODE();
+								// res 2,(iy+e),c
+								case 0x91: RES_N_DRR_E_R(2, C); NEXT_OPCODE();
+								// res 2,(iy+e),d
+								case 0x92: RES_N_DRR_E_R(2, D); NEXT_OPCODE();
+								// res 2,(iy+e),e
+								case 0x93: RES_N_DRR_E_R(2, E); NEXT_OPCODE();
+								// res 2,(iy+e),h
+								case 0x94: RES_N_DRR_E_R(2, H); NEXT_OPCODE();
+								// res 2,(iy+e),l
+								case 0x95: RES_N_DRR_E_R(2, L); NEXT_OPCODE();
+								// res 2,(iy+e)
+								case 0x96: RES_N_DRR_E(2); NEXT_OPCODE();
+								// res 2,(iy+e),a
+								case 0x97: RES_N_DRR_E_R(2, A); NEXT_OPCODE();
+								// res 3,(iy+e),b
+								case 0x98: RES_N_DRR_E_R(3, B); NEXT_OPCODE();
+								// res 3,(iy+e),c
+								case 0x99: RES_N_DRR_E_R(3, C); NEXT_OPCODE();
+								// res 3,(iy+e),d
+								case 0x9A: RES_N_DRR_E_R(3, D); NEXT_OPCODE();
+								// res 3,(iy+e),e
+								case 0x9B: RES_N_DRR_E_R(3, E); NEXT_OPCODE();
+								// res 3,(iy+e),h
+								case 0x9C: RES_N_DRR_E_R(3, H); NEXT_OPCODE();
+								// res 3,(iy+e),l
+								case 0x9D: RES_N_DRR_E_R(3, L); NEXT_OPCODE();
+								// res 3,(iy+e)
+								case 0x9E: RES_N_DRR_E(3); NEXT_OPCODE();
+								// res 3,(iy+e),a
+								case 0x9F: RES_N_DRR_E_R(3, A); NEXT_OPCODE();
+								// res 4,(iy+e),b
+								case 0xA0: RES_N_DRR_E_R(4, B); NEXT_OPCODE();
+								// res 4,(iy+e),c
+								case 0xA1: RES_N_DRR_E_R(4, C); NEXT_OPCODE();
+								// res 4,(iy+e),d
+								case 0xA2: RES_N_DRR_E_R(4, D); NEXT_OPCODE();
+								// res 4,(iy+e),e
+								case 0xA3: RES_N_DRR_E_R(4, E); NEXT_OPCODE();
+								// res 4,(iy+e),h
+								case 0xA4: RES_N_DRR_E_R(4, H); NEXT_OPCODE();
+								// res 4,(iy+e),l
+								case 0xA5: RES_N_DRR_E_R(4, L); NEXT_OPCODE();
+								// res 4,(iy+e)
+								case 0xA6: RES_N_DRR_E(4); NEXT_OPCODE();
+								// res 4,(iy+e),a
+								case 0xA7: RES_N_DRR_E_R(4, A); NEXT_OPCODE();
+								// res 5,(iy+e),b
+								case 0xA8: RES_N_DRR_E_R(5, B); NEXT_OPCODE();
+								// res 5,(iy+e),c
+								case 0xA9: RES_N_DRR_E_R(5, C); NEXT_OPCODE();
+								// res 5,(iy+e),d
+								case 0xAA: RES_N_DRR_E_R(5, D); NEXT_OPCODE();
+								// res 5,(iy+e),e
+								case 0xAB: RES_N_DRR_E_R(5, E); NEXT_OPCODE();
+								// res 5,(iy+e),h
+								case 0xAC: RES_N_DRR_E_R(5, H); NEXT_OPCODE();
+								// res 5,(iy+e),l
+								case 0xAD: RES_N_DRR_E_R(5, L); NEXT_OPCODE();
+								// res 5,(iy+e)
+								case 0xAE: RES_N_DRR_E(5); NEXT_OPCODE();
+								// res 5,(iy+e),a
+								case 0xAF: RES_N_DRR_E_R(5, A); NEXT_OPCODE();
+								// res 6,(iy+e),b
+								case 0xB0: RES_N_DRR_E_R(6, B); NEXT_OPCODE();
+								// res 6,(iy+e),c
+								case 0xB1: RES_N_DRR_E_R(6, C); NEXT_OPCODE();
+								// res 6,(iy+e),d
+								case 0xB2: RES_N_DRR_E_R(6, D); NEXT_OPCODE();
+								// res 6,(iy+e),e
+								case 0xB3: RES_N_DRR_E_R(6, E); NEXT_OPCODE();
+								// res 6,(iy+e),h
+								case 0xB4: RES_N_DRR_E_R(6, H); NEXT_OPCODE();
+								// res 6,(iy+e),l
+								case 0xB5: RES_N_DRR_E_R(6, L); NEXT_OPCODE();
+								// res 6,(iy+e)
+								case 0xB6: RES_N_DRR_E(6); NEXT_OPCODE();
+								// res 6,(iy+e),a
+								case 0xB7: RES_N_DRR_E_R(6, A); NEXT_OPCODE();
+								// res 7,(iy+e),b
+								case 0xB8: RES_N_DRR_E_R(7, B); NEXT_OPCODE();
+								// res 7,(iy+e),c
+								case 0xB9: RES_N_DRR_E_R(7, C); NEXT_OPCODE();
+								// res 7,(iy+e),d
+								case 0xBA: RES_N_DRR_E_R(7, D); NEXT_OPCODE();
+								// res 7,(iy+e),e
+								case 0xBB: RES_N_DRR_E_R(7, E); NEXT_OPCODE();
+								// res 7,(iy+e),h
+								case 0xBC: RES_N_DRR_E_R(7, H); NEXT_OPCODE();
+								// res 7,(iy+e),l
+								case 0xBD: RES_N_DRR_E_R(7, L); NEXT_OPCODE();
+								// res 7,(iy+e)
+								case 0xBE: RES_N_DRR_E(7); NEXT_OPCODE();
+								// res 7,(iy+e),a
+								case 0xBF: RES_N_DRR_E_R(7, A); NEXT_OPCODE();
+								// set 0,(iy+e),b
+								case 0xC0: SET_N_DRR_E_R(0, B); NEXT_OPCODE();
+								// set 0,(iy+e),c
+								case 0xC1: SET_N_DRR_E_R(0, C); NEXT_OPCODE();
+								// set 0,(iy+e),d
+								case 0xC2: SET_N_DRR_E_R(0, D); NEXT_OPCODE();
+								// set 0,(iy+e),e
+								case 0xC3: SET_N_DRR_E_R(0, E); NEXT_OPCODE();
+								// set 0,(iy+e),h
+								case 0xC4: SET_N_DRR_E_R(0, H); NEXT_OPCODE();
+								// set 0,(iy+e),l
+								case 0xC5: SET_N_DRR_E_R(0, L); NEXT_OPCODE();
+								// set 0,(iy+e)
+								case 0xC6: SET_N_DRR_E(0); NEXT_OPCODE();
+								// set 0,(iy+e),a
+								case 0xC7: SET_N_DRR_E_R(0, A); NEXT_OPCODE();
+								// set 1,(iy+e),b
+								case 0xC8: SET_N_DRR_E_R(1, B); NEXT_OPCODE();
+								// set 1,(iy+e),c
+								case 0xC9: SET_N_DRR_E_R(1, C); NEXT_OPCODE();
+								// set 1,(iy+e),d
+								case 0xCA: SET_N_DRR_E_R(1, D); NEXT_OPCODE();
+								// set 1,(iy+e),e
+								case 0xCB: SET_N_DRR_E_R(1, E); NEXT_OPCODE();
+								// set 1,(iy+e),h
+								case 0xCC: SET_N_DRR_E_R(1, H); NEXT_OPCODE();
+								// set 1,(iy+e),l
+								case 0xCD: SET_N_DRR_E_R(1, L); NEXT_OPCODE();
+								// set 1,(iy+e)
+								case 0xCE: SET_N_DRR_E(1); NEXT_OPCODE();
+								// set 1,(iy+e),a
+								case 0xCF: SET_N_DRR_E_R(1, A); NEXT_OPCODE();
+								// set 2,(iy+e),b
+								case 0xD0: SET_N_DRR_E_R(2, B); NEXT_OPCODE();
+								// set 2,(iy+e),c
+								case 0xD1: SET_N_DRR_E_R(2, C); NEXT_OPCODE();
+								// set 2,(iy+e),d
+								case 0xD2: SET_N_DRR_E_R(2, D); NEXT_OPCODE();
+								// set 2,(iy+e),e
+								case 0xD3: SET_N_DRR_E_R(2, E); NEXT_OPCODE();
+								// set 2,(iy+e),h
+								case 0xD4: SET_N_DRR_E_R(2, H); NEXT_OPCODE();
+								// set 2,(iy+e),l
+								case 0xD5: SET_N_DRR_E_R(2, L); NEXT_OPCODE();
+								// set 2,(iy+e)
+								case 0xD6: SET_N_DRR_E(2); NEXT_OPCODE();
+								// set 2,(iy+e),a
+								case 0xD7: SET_N_DRR_E_R(2, A); NEXT_OPCODE();
+								// set 3,(iy+e),b
+								case 0xD8: SET_N_DRR_E_R(3, B); NEXT_OPCODE();
+								// set 3,(iy+e),c
+								case 0xD9: SET_N_DRR_E_R(3, C); NEXT_OPCODE();
+								// set 3,(iy+e),d
+								case 0xDA: SET_N_DRR_E_R(3, D); NEXT_OPCODE();
+								// set 3,(iy+e),e
+								case 0xDB: SET_N_DRR_E_R(3, E); NEXT_OPCODE();
+								// set 3,(iy+e),h
+								case 0xDC: SET_N_DRR_E_R(3, H); NEXT_OPCODE();
+								// set 3,(iy+e),l
+								case 0xDD: SET_N_DRR_E_R(3, L); NEXT_OPCODE();
+								// set 3,(iy+e)
+								case 0xDE: SET_N_DRR_E(3); NEXT_OPCODE();
+								// set 3,(iy+e),a
+								case 0xDF: SET_N_DRR_E_R(3, A); NEXT_OPCODE();
+								// set 4,(iy+e),b
+								case 0xE0: SET_N_DRR_E_R(4, B); NEXT_OPCODE();
+								// set 4,(iy+e),c
+								case 0xE1: SET_N_DRR_E_R(4, C); NEXT_OPCODE();
+								// set 4,(iy+e),d
+								case 0xE2: SET_N_DRR_E_R(4, D); NEXT_OPCODE();
+								// set 4,(iy+e),e
+								case 0xE3: SET_N_DRR_E_R(4, E); NEXT_OPCODE();
+								// set 4,(iy+e),h
+								case 0xE4: SET_N_DRR_E_R(4, H); NEXT_OPCODE();
+								// set 4,(iy+e),l
+								case 0xE5: SET_N_DRR_E_R(4, L); NEXT_OPCODE();
+								// set 4,(iy+e)
+								case 0xE6: SET_N_DRR_E(4); NEXT_OPCODE();
+								// set 4,(iy+e),a
+								case 0xE7: SET_N_DRR_E_R(4, A); NEXT_OPCODE();
+								// set 5,(iy+e),b
+								case 0xE8: SET_N_DRR_E_R(5, B); NEXT_OPCODE();
+								// set 5,(iy+e),c
+								case 0xE9: SET_N_DRR_E_R(5, C); NEXT_OPCODE();
+								// set 5,(iy+e),d
+								case 0xEA: SET_N_DRR_E_R(5, D); NEXT_OPCODE();
+								// set 5,(iy+e),e
+								case 0xEB: SET_N_DRR_E_R(5, E); NEXT_OPCODE();
+								// set 5,(iy+e),h
+								case 0xEC: SET_N_DRR_E_R(5, H); NEXT_OPCODE();
+								// set 5,(iy+e),l
+								case 0xED: SET_N_DRR_E_R(5, L); NEXT_OPCODE();
+								// set 5,(iy+e)
+								case 0xEE: SET_N_DRR_E(5); NEXT_OPCODE();
+								// set 5,(iy+e),a
+								case 0xEF: SET_N_DRR_E_R(5, A); NEXT_OPCODE();
+								// set 6,(iy+e),b
+								case 0xF0: SET_N_DRR_E_R(6, B); NEXT_OPCODE();
+								// set 6,(iy+e),c
+								case 0xF1: SET_N_DRR_E_R(6, C); NEXT_OPCODE();
+								// set 6,(iy+e),d
+								case 0xF2: SET_N_DRR_E_R(6, D); NEXT_OPCODE();
+								// set 6,(iy+e),e
+								case 0xF3: SET_N_DRR_E_R(6, E); NEXT_OPCODE();
+								// set 6,(iy+e),h
+								case 0xF4: SET_N_DRR_E_R(6, H); NEXT_OPCODE();
+								// set 6,(iy+e),l
+								case 0xF5: SET_N_DRR_E_R(6, L); NEXT_OPCODE();
+								// set 6,(iy+e)
+								case 0xF6: SET_N_DRR_E(6); NEXT_OPCODE();
+								// set 6,(iy+e),a
+								case 0xF7: SET_N_DRR_E_R(6, A); NEXT_OPCODE();
+								// set 7,(iy+e),b
+								case 0xF8: SET_N_DRR_E_R(7, B); NEXT_OPCODE();
+								// set 7,(iy+e),c
+								case 0xF9: SET_N_DRR_E_R(7, C); NEXT_OPCODE();
+								// set 7,(iy+e),d
+								case 0xFA: SET_N_DRR_E_R(7, D); NEXT_OPCODE();
+								// set 7,(iy+e),e
+								case 0xFB: SET_N_DRR_E_R(7, E); NEXT_OPCODE();
+								// set 7,(iy+e),h
+								case 0xFC: SET_N_DRR_E_R(7, H); NEXT_OPCODE();
+								// set 7,(iy+e),l
+								case 0xFD: SET_N_DRR_E_R(7, L); NEXT_OPCODE();
+								// set 7,(iy+e)
+								case 0xFE: SET_N_DRR_E(7); NEXT_OPCODE();
+								// set 7,(iy+e),a
+								case 0xFF: SET_N_DRR_E_R(7, A); NEXT_OPCODE();
+							}
+
+							break;
+						}
+						// call z,nn
+						case 0xCC: CALL_CC_NN(FLAG_ZF()); NEXT_OPCODE();
+						// call nn
+						case 0xCD: CALL_CC_NN(true); NEXT_OPCODE();
+						// adc a,n
+						case 0xCE: ADC_A_N(); NEXT_OPCODE();
+						// rst 0x08
+						case 0xCF: RST(0x08); NEXT_OPCODE();
+						// ret nc
+						case 0xD0: RET_CC(!FLAG_CF()); NEXT_OPCODE();
+						// pop de
+						case 0xD1: POP(D, E); NEXT_OPCODE();
+						// jp nc,nn
+						case 0xD2: JP_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+						// out (n),a
+						case 0xD3: OUT_DN_A(); NEXT_OPCODE();
+						// call nc,nn
+						case 0xD4: CALL_CC_NN(!FLAG_CF()); NEXT_OPCODE();
+						// push de
+						case 0xD5: PUSH(D, E); NEXT_OPCODE();
+						// sub a,n
+						case 0xD6: SUB_A_N(); NEXT_OPCODE();
+						// rst 0x10
+						case 0xD7: RST(0x10); NEXT_OPCODE();
+						// ret c
+						case 0xD8: RET_CC(FLAG_CF()); NEXT_OPCODE();
+						// exx
+						case 0xD9: EXX(); NEXT_OPCODE();
+						// jp c,nn
+						case 0xDA: JP_CC_NN(FLAG_CF()); NEXT_OPCODE();
+						// in a,(n)
+						case 0xDB: IN_A_DN(); NEXT_OPCODE();
+						// call c,nn
+						case 0xDC: CALL_CC_NN(FLAG_CF()); NEXT_OPCODE();
+						// 0xDD prefix
+						case 0xDD: REPEAT_PREFIX(); NEXT_OPCODE();
+						// sbc a,n
+						case 0xDE: SBC_A_N(); NEXT_OPCODE();
+						// rst 0x18
+						case 0xDF: RST(0x18); NEXT_OPCODE();
+						// ret po
+						case 0xE0: RET_CC(!FLAG_PF()); NEXT_OPCODE();
+						// pop iy
+						case 0xE1: POP(IYH, IYL); NEXT_OPCODE();
+						// jp po,nn
+						case 0xE2: JP_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+						// ex (sp),iy
+						case 0xE3: EX_DSP_RR(IYH, IYL); NEXT_OPCODE();
+						// call po,nn
+						case 0xE4: CALL_CC_NN(!FLAG_PF()); NEXT_OPCODE();
+						// push iy
+						case 0xE5: PUSH(IYH, IYL); NEXT_OPCODE();
+						// and a,n
+						case 0xE6: AND_A_N(); NEXT_OPCODE();
+						// rst 0x20
+						case 0xE7: RST(0x20); NEXT_OPCODE();
+						// ret pe
+						case 0xE8: RET_CC(FLAG_PF()); NEXT_OPCODE();
+						// jp iy
+						case 0xE9: JP_RR(IY); NEXT_OPCODE();
+						// jp pe,nn
+						case 0xEA: JP_CC_NN(FLAG_PF()); NEXT_OPCODE();
+						// ex de,hl
+						case 0xEB: EX_DE_HL(); NEXT_OPCODE();
+						// call pe,nn
+						case 0xEC: CALL_CC_NN(FLAG_PF()); NEXT_OPCODE();
+						// 0xED prefix
+						case 0xED: REPEAT_PREFIX(); NEXT_OPCODE();
+						// xor a,n
+						case 0xEE: XOR_A_N(); NEXT_OPCODE();
+						// rst 0x28
+						case 0xEF: RST(0x28); NEXT_OPCODE();
+						// ret p
+						case 0xF0: RET_CC(!FLAG_SF()); NEXT_OPCODE();
+						// pop af
+						case 0xF1: POP_AF(); NEXT_OPCODE();
+						// jp p,nn
+						case 0xF2: JP_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+						// di
+						case 0xF3: DI(); NEXT_OPCODE();
+						// call p,nn
+						case 0xF4: CALL_CC_NN(!FLAG_SF()); NEXT_OPCODE();
+						// push af
+						case 0xF5: PUSH_AF(); NEXT_OPCODE();
+						// or a,n
+						case 0xF6: OR_A_N(); NEXT_OPCODE();
+						// rst 0x30
+						case 0xF7: RST(0x30); NEXT_OPCODE();
+						// ret m
+						case 0xF8: RET_CC(FLAG_SF()); NEXT_OPCODE();
+						// ld sp,iy
+						case 0xF9: LD_SP_RR(IY); NEXT_OPCODE();
+						// jp m,nn
+						case 0xFA: JP_CC_NN(FLAG_SF()); NEXT_OPCODE();
+						// ei
+						case 0xFB: EI(); NEXT_OPCODE();
+						// call m,nn
+						case 0xFC: CALL_CC_NN(FLAG_SF()); NEXT_OPCODE();
+						// 0xFD prefix
+						case 0xFD: REPEAT_PREFIX(); NEXT_OPCODE();
+						// cp a,n
+						case 0xFE: CP_A_N(); NEXT_OPCODE();
+						// rst 0x38
+						case 0xFF: RST(0x38); NEXT_OPCODE();
+					}
+
+					break;
+				}
+				// cp a,n
+				OPCODE(0xFE): CP_A_N(); NEXT_OPCODE();
+				// rst 0x38
+				OPCODE(0xFF): RST(0x38); NEXT_OPCODE();
+#ifdef THREADED_DISPATCH
+				// superinstructions, only entered from NEXT_OPCODE
+				FUSED_OP_HANDLERS
+#endif
+			}
+		}
+
+#ifdef THREADED_DISPATCH
+	event:
+#endif
+		SPILL_REGS();
+		if (UNLIKELY(TI83->CallbacksChanged)) {
+			// NextEventTime was only brought forward to get here, see CallbacksChanged
+			TI83->CallbacksChanged = false;
+			UpdateNextEvent(TI83);
+			u64 cycleCount = CYCLE_COUNT();
+			if (cycleCount >= TI83->NextEventTime) {
+				cycleCount = Event(TI83, cycleCount);
+			}
+			if (SelectRunFrameVariant(TI83) > RUN_FRAME_VARIANT) {
+				TI83->CycleCount = cycleCount;
+				return false;
+			}
+			RELOAD_REGS();
+			SET_CYCLE_COUNT(cycleCount);
+			continue;
+		}
+		if (UNLIKELY(CYCLE_COUNT() < TI83->NextEventTime)) {
+			// only got here from the cap on eventTime
+			SYNC_BUDGET();
+			continue;
+		}
+		SET_CYCLE_COUNT(Event(TI83, CYCLE_COUNT()));
+		RELOAD_REGS();
+	}
+
+	TI83->CycleCount = CYCLE_COUNT();
+	return true;
+}
+
+#undef RUN_FRAME_NAME
+#undef RUN_FRAME_VARIANT
+#undef FAST_MODE
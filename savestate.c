@@ -23,11 +23,18 @@ SOFTWARE.
 */
 
 #include <assert.h>
+#include <stddef.h>
 
 #include "ti83.h"
+#include "z80.h"
+#include "memory.h"
 #include "crc32.h"
 #include "queue.h"
 
+// bumped whenever TI83State_t changes, states from before the version existed end right before it
+#define STATE_VERSION 1
+#define STATE_SIZE_UNVERSIONED offsetof(TI83State_t, Version)
+
 #pragma pack(push, 1)
 
 typedef struct {
@@ -100,6 +107,9 @@ typedef struct {
 	u64 NextEventTime;
 
 	u64 CycleCount;
+
+	u8 Version; // STATE_VERSION
+	u8 Inexact; // a frame ran in fast mode before this was made, so it doesn't match a normal run
 } TI83State_t;
 
 #pragma pack(pop)
@@ -121,6 +131,7 @@ bool SaveState(TI83_t* TI83, void* buf) {
 
 	TI83State.ROMPage = TI83->ROMPage;
 
+	MaterializeFlags(TI83);
 	TI83State.MainRegs.AF = TI83->MainRegs.AF;
 	TI83State.MainRegs.BC = TI83->MainRegs.BC;
 	TI83State.MainRegs.DE = TI83->MainRegs.DE;
@@ -194,17 +205,30 @@ bool SaveState(TI83_t* TI83, void* buf) {
 
 	TI83State.CycleCount = TI83->CycleCount;
 
+	TI83State.Version = STATE_VERSION;
+	TI83State.Inexact = TI83->Inexact;
+
 	memcpy(buf, &TI83State, StateSize());
 	return true;
 }
 
-bool LoadState(TI83_t* TI83, void* buf) {
+bool LoadState(TI83_t* TI83, void* buf, u64 size) {
 	if (!TI83->LinkFilesAreLoaded) {
 		return false;
 	}
 
 	TI83State_t* TI83State = buf;
 
+	// an unversioned state is the current layout without the fields from Version on, which all start out zeroed
+	TI83State_t unversioned;
+	if (size == STATE_SIZE_UNVERSIONED) {
+		memset(&unversioned, 0, sizeof (unversioned));
+		memcpy(&unversioned, buf, STATE_SIZE_UNVERSIONED);
+		TI83State = &unversioned;
+	} else if (size != sizeof (TI83State_t) || TI83State->Version != STATE_VERSION) {
+		return false;
+	}
+
 	if (TI83State->ROMCRC != CRC32(TI83->ROM, sizeof (TI83->ROM))) {
 		return false;
 	}
@@ -243,12 +267,15 @@ bool LoadState(TI83_t* TI83, void* buf) {
 	}
 
 	memcpy(TI83->RAM, TI83State->RAM, sizeof (TI83->RAM));
+	InvalidateDecodedRAM(TI83);
 	memcpy(TI83->VRAM, TI83State->VRAM, sizeof (TI83->VRAM));
 
 	TI83->ROMPage = TI83State->ROMPage;
 	TI83->ReadPtrs[1] = TI83->ROM + (0x4000 * TI83->ROMPage) - 0x4000;
+	TI83->DecodePtrs[1] = TI83->DecodeCache + (0x4000 * TI83->ROMPage) - 0x4000;
 
 	TI83->MainRegs.AF = TI83State->MainRegs.AF;
+	TI83->LazyFlags.Op = FLAGS_NONE;
 	TI83->MainRegs.BC = TI83State->MainRegs.BC;
 	TI83->MainRegs.DE = TI83State->MainRegs.DE;
 	TI83->MainRegs.HL = TI83State->MainRegs.HL;
@@ -357,5 +384,12 @@ bool LoadState(TI83_t* TI83, void* buf) {
 
 	TI83->CycleCount = TI83State->CycleCount;
 
+	// fast mode is up to the host, the state only says whether it was ever used
+	TI83->Inexact = TI83State->Inexact;
+
+	// a frame stopped at a breakpoint isn't continued into another state
+	TI83->BreakpointHit = false;
+	TI83->BreakpointCycleCount = EVENT_TIME_NEVER;
+
 	return true;
 }
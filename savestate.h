@@ -27,6 +27,6 @@ SOFTWARE.
 
 u64 StateSize(void);
 bool SaveState(TI83_t* TI83, void* buf);
-bool LoadState(TI83_t* TI83, void* buf);
+bool LoadState(TI83_t* TI83, void* buf, u64 size);
 
 #endif
@@ -28,6 +28,8 @@ SOFTWARE.
 #include "events.h"
 #include "link.h"
 #include "savestate.h"
+#include "jit.h"
+#include "aot.h"
 
 TI83_t* TI83_CreateContext(u8* ROMData, u32 ROMSize) {
 	if (ROMSize > 0x40000) {
@@ -43,14 +45,26 @@ TI83_t* TI83_CreateContext(u8* ROMData, u32 ROMSize) {
 		memset(TI83->ROM + ROMSize, 0xFF, paddingSize);
 	}
 	memset(TI83->RAM, 0xFF, sizeof (TI83->RAM));
+	memset(TI83->ReadWatch, 0xFF, sizeof (TI83->ReadWatch));
+	memset(TI83->WriteWatch, 0xFF, sizeof (TI83->WriteWatch));
+	memset(TI83->ExecuteWatch, 0xFF, sizeof (TI83->ExecuteWatch));
 	TI83->ReadPtrs[0] = TI83->ROM;
 	TI83->WritePtrs[0] = TI83->DisabledWritePage;
 	TI83->ReadPtrs[1] = TI83->ROM - 0x4000;
 	TI83->WritePtrs[1] = TI83->DisabledWritePage - 0x4000;
 	TI83->ReadPtrs[2] = TI83->WritePtrs[2] = TI83->ReadPtrs[3] = TI83->WritePtrs[3] = TI83->RAM - 0x8000;
+	TI83->DecodeCache = calloc(sizeof (TI83->ROM) + sizeof (TI83->RAM), sizeof (DecodedOp_t));
+	if (!TI83->DecodeCache) {
+		free(TI83);
+		return NULL;
+	}
+	TI83->DecodePtrs[0] = TI83->DecodeCache;
+	TI83->DecodePtrs[1] = TI83->DecodeCache - 0x4000;
+	TI83->DecodePtrs[2] = TI83->DecodePtrs[3] = TI83->DecodeCache + sizeof (TI83->ROM) - 0x8000;
 	TI83->IM = 1;
 	TI83->CurrentLinkData.Data = malloc(0x1000);
 	if (!TI83->CurrentLinkData.Data) {
+		free(TI83->DecodeCache);
 		free(TI83);
 		return NULL;
 	}
@@ -61,6 +75,8 @@ TI83_t* TI83_CreateContext(u8* ROMData, u32 ROMSize) {
 	memset(TI83->EventSchedule, 0xFF, sizeof (TI83->EventSchedule));
 	TI83->NextEventId = NUM_EVENTS;
 	TI83->NextEventTime = EVENT_TIME_NEVER;
+	TI83->BreakpointCycleCount = EVENT_TIME_NEVER;
+	LoadAOT(TI83);
 	return TI83;
 }
 
@@ -69,6 +85,9 @@ void TI83_DestroyContext(TI83_t* TI83) {
 		free(TI83->LinkFiles[i].Data);
 	}
 	free(TI83->CurrentLinkData.Data);
+	free(TI83->DecodeCache);
+	DestroyJIT(TI83);
+	DestroyAOT(TI83);
 	free(TI83);
 }
 
@@ -98,17 +117,27 @@ bool TI83_GetLinkActive(TI83_t* TI83) {
 }
 
 bool TI83_Advance(TI83_t* TI83, bool onPressed, bool sendNextLinkFile, u32* videoBuffer, u32 backgroundColor, u32 foreColor) {
-	TI83->Lagged = true;
-	TI83->OnPressed = onPressed;
-	if (onPressed && TI83->OnIntEn && !TI83->OnIntPending) {
-		TI83->OnIntPending = true;
-		if (TI83->IFF) {
-			ScheduleEvent(TI83, INTERRUPT, EVENT_TIME_NOW);
+	// a frame which stopped at a breakpoint is continued, not started over
+	// so the input it started with still applies, and this call's is ignored
+	if (!TI83->BreakpointHit) {
+		TI83->Lagged = true;
+		TI83->OnPressed = onPressed;
+		if (onPressed && TI83->OnIntEn && !TI83->OnIntPending) {
+			TI83->OnIntPending = true;
+			if (TI83->IFF) {
+				ScheduleEvent(TI83, INTERRUPT, EVENT_TIME_NOW);
+			}
+		}
+		if (sendNextLinkFile) {
+			SendNextLinkFile(TI83);
 		}
 	}
-	if (sendNextLinkFile) {
-		SendNextLinkFile(TI83);
+	if (TI83->FastMode) {
+		TI83->Inexact = true;
 	}
+	// RAM may have been written through TI83_GetMemoryArea since the last frame
+	InvalidateDecodedRAM(TI83);
+	CheckAOT(TI83);
 	RunFrame(TI83);
 	if (videoBuffer) {
 		for (u32 i = 0; i < (96 * 64); i++) {
@@ -119,6 +148,18 @@ bool TI83_Advance(TI83_t* TI83, bool onPressed, bool sendNextLinkFile, u32* vide
 	return TI83->Lagged;
 }
 
+// advances n contexts by a frame each, with one call for hosts where crossing into the library is expensive
+// any of the per context arrays can be NULL (not pressed, not sent, no video, lag not wanted)
+// every context runs exactly as TI83_Advance would run it, one after another
+void TI83_AdvanceBatch(TI83_t** TI83s, u32 n, const bool* onPressed, const bool* sendNextLinkFile, u32** videoBuffers, u32 backgroundColor, u32 foreColor, bool* lagged) {
+	for (u32 i = 0; i < n; i++) {
+		bool ret = TI83_Advance(TI83s[i], onPressed && onPressed[i], sendNextLinkFile && sendNextLinkFile[i], videoBuffers ? videoBuffers[i] : NULL, backgroundColor, foreColor);
+		if (lagged) {
+			lagged[i] = ret;
+		}
+	}
+}
+
 u64 TI83_GetStateSize(void) {
 	return StateSize();
 }
@@ -128,10 +169,16 @@ bool TI83_SaveState(TI83_t* TI83, void* buf) {
 }
 
 bool TI83_LoadState(TI83_t* TI83, void* buf) {
-	return LoadState(TI83, buf);
+	return LoadState(TI83, buf, StateSize());
+}
+
+// also takes states made before they had a version (see LoadState)
+bool TI83_LoadStateSized(TI83_t* TI83, void* buf, u64 size) {
+	return LoadState(TI83, buf, size);
 }
 
 void TI83_GetRegs(TI83_t* TI83, u32* buf) {
+	MaterializeFlags(TI83);
 	buf[0] = TI83->MainRegs.AF;
 	buf[1] = TI83->MainRegs.BC;
 	buf[2] = TI83->MainRegs.DE;
@@ -149,6 +196,10 @@ void TI83_GetRegs(TI83_t* TI83, u32* buf) {
 bool TI83_GetMemoryArea(TI83_t* TI83, MemoryArea_t which, void** ptr, u32* len) {
 	switch (which) {
 		case MEM_ROM:
+			// the caller may patch ROM through this pointer, so drop any decoded instructions
+			memset(TI83->DecodeCache, 0, sizeof (TI83->ROM) * sizeof (DecodedOp_t));
+			FlushJIT(TI83);
+			InvalidateAOT(TI83);
 			if (ptr) *ptr = TI83->ROM;
 			if (len) *len = sizeof (TI83->ROM);
 			return true;
@@ -177,18 +228,164 @@ u64 TI83_GetCycleCount(TI83_t* TI83) {
 	return TI83->CycleCount;
 }
 
+// instructions aren't decoded if the read or execute callback (or log) watches their bytes (see DecodeOp), so these changing means decoding everything again
+static void ClearDecodeCache(TI83_t* TI83) {
+	memset(TI83->DecodeCache, 0, (sizeof (TI83->ROM) + sizeof (TI83->RAM)) * sizeof (DecodedOp_t));
+}
+
 void TI83_SetMemoryCallback(TI83_t* TI83, MemoryCallbackId_t id, MemoryCallback_t callback) {
 	switch (id) {
-		case MEM_CB_READ: TI83->ReadCallback = callback; break;
-		case MEM_CB_WRITE: TI83->WriteCallback = callback; break;
-		case MEM_CB_EXECUTE: TI83->ExecuteCallback = callback; break;
+		case MEM_CB_READ:
+			if (!TI83->ReadCallback != !callback) {
+				ClearDecodeCache(TI83);
+			}
+			TI83->ReadCallback = callback;
+			break;
+		case MEM_CB_WRITE:
+			TI83->WriteCallback = callback;
+			break;
+		case MEM_CB_EXECUTE:
+			if (!TI83->ExecuteCallback != !callback) {
+				ClearDecodeCache(TI83);
+			}
+			TI83->ExecuteCallback = callback;
+			break;
+	}
+	CallbacksChanged(TI83);
+}
+
+// (un)watches len addresses from addr (wrapping around after 0xFFFF) for the callback id
+// to only watch a few addresses, unwatch all 0x10000 first
+void TI83_SetMemoryWatch(TI83_t* TI83, MemoryCallbackId_t id, u16 addr, u32 len, bool watched) {
+	u8* watch;
+	switch (id) {
+		case MEM_CB_READ: watch = TI83->ReadWatch; break;
+		case MEM_CB_WRITE: watch = TI83->WriteWatch; break;
+		case MEM_CB_EXECUTE: watch = TI83->ExecuteWatch; break;
+		default: return;
+	}
+
+	if (len > 0x10000) {
+		len = 0x10000;
+	}
+
+	for (u32 i = 0; i < len; i++, addr++) {
+		if (watched) {
+			watch[addr >> 3] |= 1 << (addr & 7);
+		} else {
+			watch[addr >> 3] &= ~(1 << (addr & 7));
+		}
+	}
+
+	if (id != MEM_CB_WRITE) {
+		ClearDecodeCache(TI83);
 	}
 }
 
+// sets or clears a breakpoint on the instruction starting at offset into ROM (page * 0x4000 + (addr & 0x3FFF)) or RAM (addr - 0x8000)
+// returns false if there's no such byte
+bool TI83_SetBreakpoint(TI83_t* TI83, MemoryArea_t area, u32 offset, bool enabled) {
+	switch (area) {
+		case MEM_ROM:
+			if (offset >= sizeof (TI83->ROM)) {
+				return false;
+			}
+			break;
+		case MEM_RAM:
+			if (offset >= sizeof (TI83->RAM)) {
+				return false;
+			}
+			offset += sizeof (TI83->ROM);
+			break;
+		default:
+			return false;
+	}
+
+	u8 bit = 1 << (offset & 7);
+	u8* breakpoints = &TI83->Breakpoints[offset >> 3];
+	if (enabled && !(*breakpoints & bit)) {
+		*breakpoints |= bit;
+		++TI83->NumBreakpoints;
+	} else if (!enabled && (*breakpoints & bit)) {
+		*breakpoints &= ~bit;
+		--TI83->NumBreakpoints;
+	}
+
+	// only the variants with memory callbacks check for breakpoints
+	CallbacksChanged(TI83);
+	return true;
+}
+
+// whether the last TI83_Advance stopped at a breakpoint (with PC on it) before the end of the frame
+bool TI83_GetBreakpointHit(TI83_t* TI83) {
+	return TI83->BreakpointHit;
+}
+
+// switches memory log mode on for the kinds of access set in kinds (a bit per MemoryCallbackId_t), or off with 0
+// watched accesses (the same watches as the callbacks) are appended to buffer, which is handed to callback when capacity records are in it
+// and at the end of every frame (or when stopping at a breakpoint), records still waiting in the previous buffer are handed over first
+void TI83_SetMemoryLog(TI83_t* TI83, MemoryLogRecord_t* buffer, u32 capacity, u8 kinds, MemoryLogCallback_t callback) {
+	FlushMemoryLog(TI83);
+
+	kinds &= (1 << MEM_CB_READ) | (1 << MEM_CB_WRITE) | (1 << MEM_CB_EXECUTE);
+	if (!buffer || !capacity || !callback) {
+		kinds = 0;
+	}
+
+	if ((kinds ^ TI83->MemoryLogKinds) & ((1 << MEM_CB_READ) | (1 << MEM_CB_EXECUTE))) {
+		ClearDecodeCache(TI83);
+	}
+
+	TI83->MemoryLog = buffer;
+	TI83->MemoryLogCapacity = capacity;
+	TI83->MemoryLogCallback = callback;
+	TI83->MemoryLogKinds = kinds;
+	CallbacksChanged(TI83);
+}
+
 void TI83_SetTraceCallback(TI83_t* TI83, TraceCallback_t callback) {
 	TI83->TraceCallback = callback;
+	CallbacksChanged(TI83);
 }
 
 void TI83_SetInputCallback(TI83_t* TI83, InputCallback_t callback) {
 	TI83->InputCallback = callback;
 }
+
+// passed to every callback, so hosts running several contexts can tell them apart
+void TI83_SetCallbackUserdata(TI83_t* TI83, void* userdata) {
+	TI83->CallbackUserdata = userdata;
+}
+
+bool TI83_SetJITEnabled(TI83_t* TI83, bool enabled) {
+	return SetJITEnabled(TI83, enabled);
+}
+
+bool TI83_SetAOTEnabled(TI83_t* TI83, bool enabled) {
+	return SetAOTEnabled(TI83, enabled);
+}
+
+void TI83_SetIdleLoopSkipEnabled(TI83_t* TI83, bool enabled) {
+	TI83->IdleLoopSkip = enabled;
+	TI83->IdleLoop.End = 0;
+}
+
+u64 TI83_GetIdleCyclesSkipped(TI83_t* TI83) {
+	return TI83->IdleCyclesSkipped;
+}
+
+void TI83_SetFastModeEnabled(TI83_t* TI83, bool enabled) {
+	TI83->FastMode = enabled;
+}
+
+bool TI83_GetFastModeEnabled(TI83_t* TI83) {
+	return TI83->FastMode;
+}
+
+bool TI83_GetStateInexact(TI83_t* TI83) {
+	return TI83->Inexact;
+}
+
+void TI83_SetReferenceCoreEnabled(TI83_t* TI83, bool enabled) {
+	TI83->ReferenceCore = enabled;
+}
@@ -47,6 +47,14 @@ SOFTWARE.
 	_Noreturn static void UNREACHABLE(void) {}
 #endif
 
+#if defined(_MSC_VER)
+	#define NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+	#define NOINLINE __attribute__((noinline))
+#else
+	#define NOINLINE
+#endif
+
 #define EVENT_TIME_NOW 0
 #define EVENT_TIME_NEVER 0xFFFFFFFFFFFFFFFFull
 
@@ -75,6 +83,58 @@ typedef union {
 	};
 } Registers_t;
 
+typedef enum {
+	FLAGS_NONE, // F is up to date
+	FLAGS_ADD, // add, adc, inc
+	FLAGS_SUB, // sub, sbc, dec, neg
+	FLAGS_CP,
+	FLAGS_AND,
+	FLAGS_LOGIC, // xor, or, rotates, shifts (S, Z, Y, X, P from the result, H and N reset)
+} LazyFlagsOp_t;
+
+typedef struct {
+	u8 Op;
+	u8 N1, N2, Res;
+	bool Carry;
+} LazyFlags_t;
+
+typedef enum {
+	DECODE_NONE, // not decoded yet
+	DECODE_UNPREFIXED,
+	DECODE_CB,
+	DECODE_DD,
+	DECODE_ED,
+	DECODE_FD,
+	DECODE_UNCACHEABLE, // crosses into another memory region, always fetched normally
+	DECODE_BLOCK, // unprefixed, and a JIT block starts here
+	DECODE_FUSED, // unprefixed, and starts a superinstruction in ROM (Kind - DECODE_FUSED indexes FusedOps, see z80.c)
+} DecodeKind_t;
+
+// an instruction, decoded once on first execution
+// no instruction has more than 2 bytes after its (prefixed) opcode, so they are always copied
+typedef struct {
+	u8 Kind;
+	u8 Opcode;
+	u8 Operand[2];
+} DecodedOp_t;
+
+// registers compared between iterations of a polling loop, see IdleLoopBranch in z80.c
+typedef struct {
+	Registers_t MainRegs;
+	Registers_t AltRegs;
+	LazyFlags_t LazyFlags;
+	u16 IX, IY, SP, WZ;
+} IdleLoopRegs_t;
+
+typedef struct {
+	u16 Start, End; // body of the loop being watched, End is 0 if there is none
+	bool Pure; // the body has no side effects
+	u8 R;
+	u64 CycleCount;
+	u64 NextEventTime;
+	IdleLoopRegs_t Regs;
+} IdleLoop_t;
+
 typedef enum {
 	TIMER_IRQ,
 	INTERRUPT,
@@ -120,9 +180,28 @@ typedef enum {
 	MEM_CB_EXECUTE,
 } MemoryCallbackId_t;
 
-typedef void (*MemoryCallback_t)(u16 addr, u64 cycleCount);
-typedef void (*TraceCallback_t)(u64 cycleCount);
-typedef u8 (*InputCallback_t)(u8 keyboardMask);
+// native code state, see jit.c
+typedef struct JIT_t JIT_t;
+
+// precompiled blocks for the loaded ROM, see aot.c
+typedef struct AOT_t AOT_t;
+
+// a watched memory access, as appended to the host's buffer in memory log mode (see TI83_SetMemoryLog)
+// the layout is fixed at 16 bytes (Reserved is always 0), so hosts can read the buffer in place
+typedef struct {
+	u64 CycleCount;
+	u16 Addr;
+	u8 Kind; // MemoryCallbackId_t
+	u8 ROMPage; // mapped at 0x4000-0x7FFF at the time
+	u8 Value; // read, written, or fetched
+	u8 Reserved[3];
+} MemoryLogRecord_t;
+
+// every callback gets the context's userdata first (see TI83_SetCallbackUserdata)
+typedef void (*MemoryCallback_t)(void* userdata, u16 addr, u64 cycleCount);
+typedef void (*MemoryLogCallback_t)(void* userdata, const MemoryLogRecord_t* records, u32 count);
+typedef void (*TraceCallback_t)(void* userdata, u64 cycleCount);
+typedef u8 (*InputCallback_t)(void* userdata, u8 keyboardMask);
 
 typedef struct {
 	u8 ROM[0x40000];
@@ -133,10 +212,29 @@ typedef struct {
 	u8* ReadPtrs[4];
 	u8* WritePtrs[4];
 
+	DecodedOp_t* DecodeCache; // one entry per ROM byte, then one per RAM byte
+	DecodedOp_t* DecodePtrs[4]; // mapped like ReadPtrs
+	bool DecodedPages[0x100]; // 256 byte pages of RAM which decoded instructions were read from, indexed by address high byte
+
+	JIT_t* JIT; // allocated the first time the JIT is enabled
+	bool JITEnabled;
+
+	AOT_t* AOT; // loaded when creating the context, if there's a plugin for the ROM
+	bool AOTEnabled;
+
+	bool IdleLoopSkip; // fast forward polling loops to the next event
+	IdleLoop_t IdleLoop;
+	u64 IdleCyclesSkipped;
+
+	bool FastMode; // skip WZ, XF/YF, and R upkeep (see TI83_SetFastModeEnabled)
+	bool Inexact; // a frame ran in fast mode, so the state no longer matches a normal run (savestates carry this)
+	bool ReferenceCore; // run the plain interpreter, for checking the rest against (see TI83_SetReferenceCoreEnabled)
+
 	u8 ROMPage;
 
 	Registers_t MainRegs;
 	Registers_t AltRegs;
+	LazyFlags_t LazyFlags; // pending flag computation for MainRegs.F
 
 	union {
 		struct {
@@ -173,8 +271,30 @@ typedef struct {
 	MemoryCallback_t WriteCallback;
 	MemoryCallback_t ExecuteCallback;
 
+	// one bit per address (whichever page is mapped there), callbacks only fire for set bits
+	// every address is watched until the host narrows it down (see TI83_SetMemoryWatch)
+	u8 ReadWatch[0x2000];
+	u8 WriteWatch[0x2000];
+	u8 ExecuteWatch[0x2000];
+
+	// memory log mode, watched accesses of the kinds set (a bit per MemoryCallbackId_t) are appended to the host's buffer
+	MemoryLogRecord_t* MemoryLog;
+	u32 MemoryLogCapacity;
+	u32 MemoryLogLength;
+	u8 MemoryLogKinds;
+	MemoryLogCallback_t MemoryLogCallback; // handed the records when the buffer fills up and at the end of the frame
+
 	TraceCallback_t TraceCallback;
 
+	// one bit per ROM byte, then one per RAM byte (indexed like DecodeCache), RunFrame stops before an instruction starting on a set one
+	u8 Breakpoints[(0x40000 + 0x8000) / 8];
+	u32 NumBreakpoints;
+	bool BreakpointHit; // RunFrame stopped at a breakpoint, the next TI83_Advance continues the frame (ignoring its onPressed and sendNextLinkFile)
+	u64 BreakpointCycleCount; // when it stopped, the instruction there runs when it continues at the same cycle
+
+	bool InFrame; // RunFrame is running, so callbacks are being set from within callbacks
+	bool CallbacksChanged; // RunFrame needs to stop at the next instruction to switch variants
+
 	bool CursorMoved;
 	bool DisplayMode;
 	u8 DisplayMove;
@@ -183,6 +303,8 @@ typedef struct {
 	InputCallback_t InputCallback;
 	u8 KeyboardMask;
 
+	void* CallbackUserdata;
+
 	Stream_t LinkFiles[256]; // nobody should need more than 255 files sent, right?
 	u8 CurrentLinkFile;
 	Queue_t CurrentLinkData;
@@ -220,16 +342,31 @@ EXPORT bool TI83_LoadLinkFile(TI83_t* TI83, u8* linkFile, u32 len);
 EXPORT void TI83_SetLinkFilesAreLoaded(TI83_t* TI83);
 EXPORT bool TI83_GetLinkActive(TI83_t* TI83);
 EXPORT bool TI83_Advance(TI83_t* TI83, bool onPressed, bool sendNextLinkFile, u32* videoBuffer, u32 backgroundColor, u32 foreColor);
+EXPORT void TI83_AdvanceBatch(TI83_t** TI83s, u32 n, const bool* onPressed, const bool* sendNextLinkFile, u32** videoBuffers, u32 backgroundColor, u32 foreColor, bool* lagged);
 EXPORT u64 TI83_GetStateSize(void);
 EXPORT bool TI83_SaveState(TI83_t* TI83, void* buf);
 EXPORT bool TI83_LoadState(TI83_t* TI83, void* buf);
+EXPORT bool TI83_LoadStateSized(TI83_t* TI83, void* buf, u64 size);
 EXPORT void TI83_GetRegs(TI83_t* TI83, u32* buf);
 EXPORT bool TI83_GetMemoryArea(TI83_t* TI83, MemoryArea_t which, void** ptr, u32* len);
 EXPORT u8 TI83_ReadMemory(TI83_t* TI83, u16 addr);
 EXPORT void TI83_WriteMemory(TI83_t* TI83, u16 addr, u8 val);
 EXPORT u64 TI83_GetCycleCount(TI83_t* TI83);
 EXPORT void TI83_SetMemoryCallback(TI83_t* TI83, MemoryCallbackId_t id, MemoryCallback_t callback);
+EXPORT void TI83_SetMemoryWatch(TI83_t* TI83, MemoryCallbackId_t id, u16 addr, u32 len, bool watched);
+EXPORT void TI83_SetMemoryLog(TI83_t* TI83, MemoryLogRecord_t* buffer, u32 capacity, u8 kinds, MemoryLogCallback_t callback);
+EXPORT bool TI83_SetBreakpoint(TI83_t* TI83, MemoryArea_t area, u32 offset, bool enabled);
+EXPORT bool TI83_GetBreakpointHit(TI83_t* TI83);
 EXPORT void TI83_SetTraceCallback(TI83_t* TI83, TraceCallback_t callback);
 EXPORT void TI83_SetInputCallback(TI83_t* TI83, InputCallback_t callback);
+EXPORT void TI83_SetCallbackUserdata(TI83_t* TI83, void* userdata);
+EXPORT bool TI83_SetJITEnabled(TI83_t* TI83, bool enabled);
+EXPORT bool TI83_SetAOTEnabled(TI83_t* TI83, bool enabled);
+EXPORT void TI83_SetIdleLoopSkipEnabled(TI83_t* TI83, bool enabled);
+EXPORT u64 TI83_GetIdleCyclesSkipped(TI83_t* TI83);
+EXPORT void TI83_SetFastModeEnabled(TI83_t* TI83, bool enabled);
+EXPORT bool TI83_GetFastModeEnabled(TI83_t* TI83);
+EXPORT bool TI83_GetStateInexact(TI83_t* TI83);
+EXPORT void TI83_SetReferenceCoreEnabled(TI83_t* TI83, bool enabled);
 
 #endif
@@ -0,0 +1,537 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// ahead of time compiler, turning the code reachable in a ROM into a plugin of precompiled blocks (see aot.c)
+// emu83aot rom.bin out.c [--entry OFFSET]... [--jump-table OFFSET COUNT]...
+// then: cc -O2 -shared -fPIC -I<emu83 source dir> out.c -o <printed name>.so, and point EMU83_AOT_DIR at its directory
+// code is found by walking every statically known branch from the entry points: the rst vectors (including the 0x38 interrupt),
+// anything given with --entry, and each 3 byte entry of a --jump-table (e.g. the OS's jp table)
+// offsets are into the ROM image (page * 0x4000 + (addr & 0x3FFF)), so banked code is walked with its page mapped in
+// blocks follow the JIT's rules exactly (see CompileBlock in jit.c), code in RAM is left to the interpreter and JIT
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "../crc32.h"
+
+#define ROM_SIZE 0x40000
+#define MAX_BLOCK_LENGTH 64
+
+static u8 ROM[ROM_SIZE];
+static bool Queued[ROM_SIZE];
+static bool IsBlock[ROM_SIZE];
+static u32 Worklist[ROM_SIZE];
+static u32 WorklistSize;
+
+static FILE* Out; // NULL while walking, blocks are only emitted once all of them are known
+
+static void Emit(const char* fmt, ...) {
+	if (Out) {
+		va_list args;
+		va_start(args, fmt);
+		vfprintf(Out, fmt, args);
+		va_end(args);
+	}
+}
+
+static const char* const Reg8Names[8] = {
+	"MainRegs.B", "MainRegs.C", "MainRegs.D", "MainRegs.E",
+	"MainRegs.H", "MainRegs.L", NULL, "MainRegs.A",
+};
+
+static const char* const Reg16Names[4] = {
+	"MainRegs.BC", "MainRegs.DE", "MainRegs.HL", "SP",
+};
+
+// high, low
+static const char* const PushPopNames[3][2] = {
+	{ "MainRegs.B", "MainRegs.C" },
+	{ "MainRegs.D", "MainRegs.E" },
+	{ "MainRegs.H", "MainRegs.L" },
+};
+
+// nz, z, nc, c
+static const char* const Conditions[4] = {
+	"!AOTFlagZF(TI83)", "AOTFlagZF(TI83)", "!AOTFlagCF(TI83)", "AOTFlagCF(TI83)",
+};
+
+static u32 Offset(u32 page, u16 addr) {
+	return addr < 0x4000 ? addr : page * 0x4000 + addr - 0x4000;
+}
+
+static u8 Byte(u32 page, u16 addr) {
+	return ROM[Offset(page, addr)];
+}
+
+// queues a branch target, page 0 is only banked in at 0x4000 when it's also the current page
+static void Queue(u32 page, u16 addr) {
+	if (addr >= 0x8000 || (addr >= 0x4000 && !page)) {
+		return;
+	}
+
+	u32 offset = Offset(page, addr);
+	if (!Queued[offset]) {
+		Queued[offset] = true;
+		Worklist[WorklistSize++] = offset;
+	}
+}
+
+// length of any instruction, for walking past those blocks can't contain
+static u32 UnprefixedLength(u8 op) {
+	u8 x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+	switch (x) {
+		case 0:
+			switch (z) {
+				case 0: return y < 2 ? 1 : 2;
+				case 1: return (y & 1) ? 1 : 3;
+				case 2: return y >= 4 ? 3 : 1;
+				case 6: return 2;
+				default: return 1;
+			}
+		case 3:
+			switch (z) {
+				case 2: case 4: return 3;
+				case 3: return y == 0 ? 3 : (y == 2 || y == 3) ? 2 : 1;
+				case 5: return y == 1 ? 3 : 1;
+				case 6: return 2;
+				default: return 1;
+			}
+		default:
+			return 1;
+	}
+}
+
+static u32 InstructionLength(u32 page, u16 addr) {
+	u8 op = Byte(page, addr);
+	if (op == 0xCB) {
+		return 2;
+	}
+
+	if (op == 0xED) {
+		// ld (nn),rr / ld rr,(nn)
+		return (Byte(page, addr + 1) & 0xC7) == 0x43 ? 4 : 2;
+	}
+
+	if (op == 0xDD || op == 0xFD) {
+		u8 op2 = Byte(page, addr + 1);
+		if (op2 == 0xCB) {
+			return 4;
+		}
+		if (op2 == 0xDD || op2 == 0xFD || op2 == 0xED) {
+			return 1; // the prefix is ignored
+		}
+		// (hl) becomes (ix+d)
+		bool displacement = (op2 >= 0x34 && op2 <= 0x36) || (op2 >= 0x40 && op2 < 0xC0 && op2 != 0x76 && ((op2 & 7) == 6 || (op2 >= 0x70 && op2 < 0x78)));
+		return 1 + UnprefixedLength(op2) + displacement;
+	}
+
+	return UnprefixedLength(op);
+}
+
+// queues where an instruction can go next
+static void QueueSuccessors(u32 page, u16 addr, u32 len) {
+	u8 op = Byte(page, addr);
+	u16 next = addr + len;
+	u16 nn = Byte(page, addr + 1) | (Byte(page, addr + 2) << 8);
+	u16 target = next + (s8)Byte(page, addr + 1);
+	u8 op2 = Byte(page, addr + 1);
+
+	if (op == 0xC3) { // jp nn
+		Queue(page, nn);
+	} else if (op == 0xCD || (op & 0xC7) == 0xC2 || (op & 0xC7) == 0xC4) { // call nn / jp cc,nn / call cc,nn
+		Queue(page, nn);
+		Queue(page, next);
+	} else if (op == 0x18) { // jr e
+		Queue(page, target);
+	} else if (op == 0x10 || (op & 0xE7) == 0x20) { // djnz e / jr cc,e
+		Queue(page, target);
+		Queue(page, next);
+	} else if ((op & 0xC7) == 0xC7) { // rst n
+		Queue(page, op & 0x38);
+		Queue(page, next);
+	} else if (op == 0xC9 || op == 0xE9 || ((op == 0xDD || op == 0xFD) && op2 == 0xE9) || (op == 0xED && (op2 & 0xC7) == 0x45)) {
+		// ret / jp (hl) / jp (ix) / jp (iy) / retn / reti, nowhere known
+	} else {
+		Queue(page, next);
+	}
+}
+
+// compiles the block starting at start (in page), returning false if it can't start one
+// with no output set this only finds the block's successors
+static bool CompileBlock(u32 page, u16 start, u32* lastStartOut, u32* fetchesOut) {
+	// the start is also a decoded instruction for the interpreter (see DecodeOp), which has the same restriction
+	u16 last = start + 2;
+	if ((start ^ last) & 0xC000) {
+		return false;
+	}
+
+	u16 pc = start;
+	u32 cycles = 0, lastStart = 0, count = 0;
+	bool terminated = false;
+	while (!terminated && count < MAX_BLOCK_LENGTH) {
+		u8 opcode = Byte(page, pc);
+		u32 len;
+		switch (opcode) {
+			case 0x01: case 0x11: case 0x21: case 0x31: // ld rr,nn
+			case 0x32: case 0x3A: // ld (nn),a / ld a,(nn)
+			case 0xC3: case 0xC2: case 0xCA: case 0xD2: case 0xDA: // jp (cc,)nn
+			case 0xCD: // call nn
+				len = 3;
+				break;
+			case 0x06: case 0x0E: case 0x16: case 0x1E: case 0x26: case 0x2E: case 0x3E: // ld r,n
+			case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE: // alu a,n
+			case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: // djnz / jr (cc,)e
+				len = 2;
+				break;
+			case 0x00: // nop
+			case 0x02: case 0x12: case 0x0A: case 0x1A: // ld (rr),a / ld a,(rr)
+			case 0x03: case 0x13: case 0x23: case 0x33: case 0x0B: case 0x1B: case 0x2B: case 0x3B: // inc/dec rr
+			case 0x04: case 0x0C: case 0x14: case 0x1C: case 0x24: case 0x2C: case 0x3C: // inc r
+			case 0x05: case 0x0D: case 0x15: case 0x1D: case 0x25: case 0x2D: case 0x3D: // dec r
+			case 0xEB: // ex de,hl
+			case 0xC1: case 0xD1: case 0xE1: case 0xC5: case 0xD5: case 0xE5: // pop/push rr
+			case 0xC9: case 0xC0: case 0xC8: case 0xD0: case 0xD8: // ret (cc)
+				len = 1;
+				break;
+			default:
+				// ld r,r' / ld r,(hl) / ld (hl),r / alu a,r / alu a,(hl), but not halt
+				len = (opcode >= 0x40 && opcode < 0xC0 && opcode != 0x76) ? 1 : 0;
+				break;
+		}
+
+		if (!len || ((pc ^ (pc + len - 1)) & 0xC000)) {
+			break;
+		}
+
+		u8 n1 = len > 1 ? Byte(page, pc + 1) : 0;
+		u8 n2 = len > 2 ? Byte(page, pc + 2) : 0;
+		u16 nn = n1 | (n2 << 8);
+		u16 next = pc + len;
+		lastStart = cycles;
+		++count;
+
+		switch (opcode) {
+			case 0x00:
+				cycles += 4;
+				break;
+			case 0x01: case 0x11: case 0x21: case 0x31:
+				Emit("\tTI83->%s = 0x%04X;\n", Reg16Names[opcode >> 4], nn);
+				cycles += 10;
+				break;
+			case 0x02: case 0x12: {
+				const char* rr = Reg16Names[opcode >> 4];
+				Emit("\thost->WriteMem(TI83, TI83->%s, TI83->MainRegs.A);\n", rr);
+				Emit("\tTI83->W = TI83->MainRegs.A;\n");
+				Emit("\tTI83->Z = (u8)(TI83->%s + 1);\n", rr);
+				cycles += 7;
+				break;
+			}
+			case 0x0A: case 0x1A: {
+				const char* rr = Reg16Names[opcode >> 4];
+				Emit("\tTI83->MainRegs.A = host->ReadMem(TI83, TI83->%s);\n", rr);
+				Emit("\tTI83->WZ = TI83->%s + 1;\n", rr);
+				cycles += 7;
+				break;
+			}
+			case 0x32:
+				Emit("\thost->WriteMem(TI83, 0x%04X, TI83->MainRegs.A);\n", nn);
+				Emit("\tTI83->W = TI83->MainRegs.A;\n");
+				Emit("\tTI83->Z = 0x%02X;\n", (u8)(n1 + 1));
+				cycles += 13;
+				break;
+			case 0x3A:
+				Emit("\tTI83->MainRegs.A = host->ReadMem(TI83, 0x%04X);\n", nn);
+				Emit("\tTI83->WZ = 0x%04X;\n", (u16)(nn + 1));
+				cycles += 13;
+				break;
+			case 0x03: case 0x13: case 0x23: case 0x33:
+			case 0x0B: case 0x1B: case 0x2B: case 0x3B:
+				Emit("\t%sTI83->%s;\n", (opcode & 8) ? "--" : "++", Reg16Names[opcode >> 4]);
+				cycles += 6;
+				break;
+			case 0x04: case 0x0C: case 0x14: case 0x1C: case 0x24: case 0x2C: case 0x3C:
+			case 0x05: case 0x0D: case 0x15: case 0x1D: case 0x25: case 0x2D: case 0x3D:
+				Emit("\tAOTIncDec8(TI83, &TI83->%s, %s);\n", Reg8Names[opcode >> 3], (opcode & 1) ? "true" : "false");
+				cycles += 4;
+				break;
+			case 0x06: case 0x0E: case 0x16: case 0x1E: case 0x26: case 0x2E: case 0x3E:
+				Emit("\tTI83->%s = 0x%02X;\n", Reg8Names[opcode >> 3], n1);
+				cycles += 7;
+				break;
+			case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE:
+				Emit("\tAOTALU(TI83, %u, 0x%02X);\n", (opcode >> 3) & 7, n1);
+				cycles += 7;
+				break;
+			case 0xEB:
+				Emit("\t{ u16 de = TI83->MainRegs.DE; TI83->MainRegs.DE = TI83->MainRegs.HL; TI83->MainRegs.HL = de; }\n");
+				cycles += 4;
+				break;
+			case 0xC1: case 0xD1: case 0xE1: {
+				const char* const* rr = PushPopNames[(opcode >> 4) - 0xC];
+				Emit("\tTI83->%s = host->ReadMem(TI83, TI83->SP++);\n", rr[1]);
+				Emit("\tTI83->%s = host->ReadMem(TI83, TI83->SP++);\n", rr[0]);
+				cycles += 10;
+				break;
+			}
+			case 0xC5: case 0xD5: case 0xE5: {
+				const char* const* rr = PushPopNames[(opcode >> 4) - 0xC];
+				Emit("\thost->WriteMem(TI83, --TI83->SP, TI83->%s);\n", rr[0]);
+				Emit("\thost->WriteMem(TI83, --TI83->SP, TI83->%s);\n", rr[1]);
+				cycles += 11;
+				break;
+			}
+			case 0xC3:
+				Emit("\tTI83->WZ = TI83->PC = 0x%04X;\n", nn);
+				Emit("\treturn %u;\n", cycles + 10);
+				terminated = true;
+				break;
+			case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+				Emit("\tTI83->WZ = 0x%04X;\n", nn);
+				Emit("\tTI83->PC = %s ? 0x%04X : 0x%04X;\n", Conditions[(opcode >> 3) & 3], nn, next);
+				Emit("\treturn %u;\n", cycles + 10);
+				terminated = true;
+				break;
+			case 0xCD:
+				Emit("\tTI83->WZ = 0x%04X;\n", nn);
+				Emit("\thost->WriteMem(TI83, --TI83->SP, 0x%02X);\n", next >> 8);
+				Emit("\thost->WriteMem(TI83, --TI83->SP, 0x%02X);\n", next & 0xFF);
+				Emit("\tTI83->PC = 0x%04X;\n", nn);
+				Emit("\treturn %u;\n", cycles + 17);
+				terminated = true;
+				break;
+			case 0xC9:
+				Emit("\tTI83->PCL = host->ReadMem(TI83, TI83->SP++);\n");
+				Emit("\tTI83->PCH = host->ReadMem(TI83, TI83->SP++);\n");
+				Emit("\tTI83->WZ = TI83->PC;\n");
+				Emit("\treturn %u;\n", cycles + 10);
+				terminated = true;
+				break;
+			case 0xC0: case 0xC8: case 0xD0: case 0xD8:
+				Emit("\tif (%s) {\n", Conditions[(opcode >> 3) & 3]);
+				Emit("\t\tTI83->PCL = host->ReadMem(TI83, TI83->SP++);\n");
+				Emit("\t\tTI83->PCH = host->ReadMem(TI83, TI83->SP++);\n");
+				Emit("\t\tTI83->WZ = TI83->PC;\n");
+				Emit("\t\treturn %u;\n", cycles + 11);
+				Emit("\t}\n");
+				Emit("\tTI83->PC = 0x%04X;\n", next);
+				Emit("\treturn %u;\n", cycles + 5);
+				terminated = true;
+				break;
+			case 0x18: {
+				u16 target = next + (s8)n1;
+				Emit("\tTI83->WZ = TI83->PC = 0x%04X;\n", target);
+				Emit("\treturn %u;\n", cycles + 12);
+				terminated = true;
+				break;
+			}
+			case 0x10: case 0x20: case 0x28: case 0x30: case 0x38: {
+				u16 target = next + (s8)n1;
+				u32 base = opcode == 0x10 ? 8 : 7;
+				Emit("\tif (%s) {\n", opcode == 0x10 ? "--TI83->MainRegs.B" : Conditions[(opcode >> 3) & 3]);
+				Emit("\t\tTI83->WZ = TI83->PC = 0x%04X;\n", target);
+				Emit("\t\treturn %u;\n", cycles + base + 5);
+				Emit("\t}\n");
+				Emit("\tTI83->PC = 0x%04X;\n", next);
+				Emit("\treturn %u;\n", cycles + base);
+				terminated = true;
+				break;
+			}
+			default: {
+				u8 dst = (opcode >> 3) & 7, src = opcode & 7;
+				if (opcode < 0x80) {
+					if (src == 6) {
+						Emit("\tTI83->%s = host->ReadMem(TI83, TI83->MainRegs.HL);\n", Reg8Names[dst]);
+						cycles += 7;
+					} else if (dst == 6) {
+						Emit("\thost->WriteMem(TI83, TI83->MainRegs.HL, TI83->%s);\n", Reg8Names[src]);
+						cycles += 7;
+					} else {
+						Emit("\tTI83->%s = TI83->%s;\n", Reg8Names[dst], Reg8Names[src]);
+						cycles += 4;
+					}
+				} else {
+					if (src == 6) {
+						Emit("\tAOTALU(TI83, %u, host->ReadMem(TI83, TI83->MainRegs.HL));\n", dst);
+						cycles += 7;
+					} else {
+						Emit("\tAOTALU(TI83, %u, TI83->%s);\n", dst, Reg8Names[src]);
+						cycles += 4;
+					}
+				}
+				break;
+			}
+		}
+
+		if (terminated) {
+			QueueSuccessors(page, pc, len);
+		}
+
+		pc = next;
+	}
+
+	if (!count) {
+		return false;
+	}
+
+	if (!terminated) {
+		Emit("\tTI83->PC = 0x%04X;\n", pc);
+		Emit("\treturn %u;\n", cycles);
+		Queue(page, pc);
+	}
+
+	*lastStartOut = lastStart;
+	*fetchesOut = count;
+	return true;
+}
+
+static void Walk(void) {
+	while (WorklistSize) {
+		u32 offset = Worklist[--WorklistSize];
+		u32 page = offset >> 14;
+		u16 addr = page ? 0x4000 + (offset & 0x3FFF) : offset;
+		u32 lastStart, fetches;
+		if (CompileBlock(page, addr, &lastStart, &fetches)) {
+			IsBlock[offset] = true;
+		} else {
+			// left to the interpreter, but the code after it still counts
+			u32 len = InstructionLength(page, addr);
+			if (!(((addr ^ (addr + len - 1))) & 0xC000)) {
+				QueueSuccessors(page, addr, len);
+			}
+		}
+	}
+}
+
+static void PrintPlugin(u32 crc) {
+	Emit("// generated by emu83aot for the ROM with CRC32 %08X, do not edit\n\n", crc);
+	Emit("#include \"aot.h\"\n\n");
+
+	for (u32 offset = 0; offset < ROM_SIZE; offset++) {
+		if (IsBlock[offset]) {
+			u32 page = offset >> 14;
+			u16 addr = page ? 0x4000 + (offset & 0x3FFF) : offset;
+			u32 lastStart, fetches;
+			Emit("// page %u, %04X\n", page, addr);
+			Emit("static u32 Block_%05X(TI83_t* TI83, const AOTHost_t* host) {\n", offset);
+			Emit("\t(void)host;\n");
+			CompileBlock(page, addr, &lastStart, &fetches);
+			Emit("}\n\n");
+		}
+	}
+
+	Emit("static const AOTBlock_t Blocks[] = {\n");
+	for (u32 offset = 0; offset < ROM_SIZE; offset++) {
+		if (IsBlock[offset]) {
+			u32 page = offset >> 14;
+			u16 addr = page ? 0x4000 + (offset & 0x3FFF) : offset;
+			u32 lastStart, fetches;
+			FILE* out = Out;
+			Out = NULL;
+			CompileBlock(page, addr, &lastStart, &fetches);
+			Out = out;
+			Emit("\t{ 0x%05X, %u, %u, Block_%05X },\n", offset, lastStart, fetches, offset);
+		}
+	}
+	Emit("};\n\n");
+
+	Emit("EXPORT const AOTPlugin_t TI83_AOTPlugin = {\n");
+	Emit("\tAOT_VERSION,\n");
+	Emit("\tsizeof (TI83_t),\n");
+	Emit("\tAOT_CONTEXT_LAYOUT,\n");
+	Emit("\t0x%08X,\n", crc);
+	Emit("\tsizeof (Blocks) / sizeof (*Blocks),\n");
+	Emit("\tBlocks,\n");
+	Emit("};\n");
+}
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s rom.bin out.c [--entry OFFSET]... [--jump-table OFFSET COUNT]...\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	FILE* f = fopen(argv[1], "rb");
+	if (!f) {
+		fprintf(stderr, "failed to open %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	// padded just like TI83_CreateContext does, which the CRC has to match
+	memset(ROM, 0xFF, sizeof (ROM));
+	size_t size = fread(ROM, 1, sizeof (ROM), f);
+	bool tooLarge = fgetc(f) != EOF;
+	fclose(f);
+	if (!size || tooLarge) {
+		fprintf(stderr, "%s is not a ROM\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	for (u32 i = 0; i < 0x40; i += 8) {
+		Queue(0, i);
+	}
+
+	for (int i = 3; i < argc; i++) {
+		if (!strcmp(argv[i], "--entry") && i + 1 < argc) {
+			u32 offset = strtoul(argv[++i], NULL, 0);
+			if (offset < ROM_SIZE) {
+				Queue(offset >> 14, (offset >> 14) ? 0x4000 + (offset & 0x3FFF) : offset);
+			}
+		} else if (!strcmp(argv[i], "--jump-table") && i + 2 < argc) {
+			u32 offset = strtoul(argv[++i], NULL, 0);
+			u32 count = strtoul(argv[++i], NULL, 0);
+			for (u32 j = 0; j < count && offset + j * 3 < ROM_SIZE; j++) {
+				u32 entry = offset + j * 3;
+				Queue(entry >> 14, (entry >> 14) ? 0x4000 + (entry & 0x3FFF) : entry);
+			}
+		} else {
+			fprintf(stderr, "unknown option %s\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	Walk();
+
+	Out = fopen(argv[2], "w");
+	if (!Out) {
+		fprintf(stderr, "failed to open %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	u32 crc = CRC32(ROM, sizeof (ROM));
+	PrintPlugin(crc);
+	bool failed = ferror(Out);
+	failed |= fclose(Out) != 0;
+	if (failed) {
+		fprintf(stderr, "failed to write %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	// the name TI83_CreateContext looks for
+	printf("emu83aot_%08X\n", crc);
+	return EXIT_SUCCESS;
+}
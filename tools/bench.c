@@ -0,0 +1,434 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// headless benchmark for the core, running small synthetic Z80 programs (see workloads.h)
+
+#include <time.h>
+
+#include "../ti83.h"
+#include "workloads.h"
+
+static u64 InstructionCount;
+static bool UseJIT;
+static bool UseIdleLoopSkip;
+static bool UseFastMode;
+static bool UseAOT;
+static bool UseWatch;
+static bool UseLog;
+
+static u64 WatchHits;
+static MemoryLogRecord_t LogBuffer[0x1000];
+
+static void CountInstruction(void* userdata, u64 cycleCount) {
+	(void)userdata;
+	(void)cycleCount;
+	++InstructionCount;
+}
+
+static void CountWatchHit(void* userdata, u16 addr, u64 cycleCount) {
+	(void)userdata;
+	(void)addr;
+	(void)cycleCount;
+	++WatchHits;
+}
+
+static void CountLogged(void* userdata, const MemoryLogRecord_t* records, u32 count) {
+	(void)userdata;
+	(void)records;
+	WatchHits += count;
+}
+
+// opcode pairs executed one after the other from ROM, the input for tools/fusegen.c
+static u32 PairCounts[256][256];
+static u16 LastPC;
+static u8 LastOpcode;
+static bool HaveLast;
+
+static void CountPair(void* userdata, u64 cycleCount) {
+	(void)cycleCount;
+	TI83_t* TI83 = userdata;
+	u32 regs[12];
+	TI83_GetRegs(TI83, regs);
+	u16 pc = regs[10];
+	u8 opcode = TI83_ReadMemory(TI83, pc);
+
+	// only straight-line code counts, anything else (branches, interrupts) can't be fused
+	if (HaveLast && pc < 0x8000 && (u16)(pc - LastPC) >= 1 && (u16)(pc - LastPC) <= 3) {
+		++PairCounts[LastOpcode][opcode];
+	}
+
+	LastPC = pc;
+	LastOpcode = opcode;
+	HaveLast = pc < 0x8000;
+}
+
+static bool CollectPairs(u8* rom, u32 size, u32 frames) {
+	TI83_t* TI83 = TI83_CreateContext(rom, size);
+	if (!TI83) {
+		return false;
+	}
+
+	TI83_SetCallbackUserdata(TI83, TI83);
+	HaveLast = false;
+	TI83_SetTraceCallback(TI83, CountPair);
+	for (u32 i = 0; i < frames; i++) {
+		TI83_Advance(TI83, false, false, NULL, 0, 0);
+	}
+	TI83_DestroyContext(TI83);
+	return true;
+}
+
+typedef struct {
+	u32 Count;
+	u8 First, Second;
+} Pair_t;
+
+static int ComparePairs(const void* a, const void* b) {
+	u32 countA = ((const Pair_t*)a)->Count;
+	u32 countB = ((const Pair_t*)b)->Count;
+	return (countA < countB) - (countA > countB);
+}
+
+// one "first second count" line per pair, most frequent first
+static void PrintPairs(void) {
+	static Pair_t pairs[256 * 256];
+	u32 n = 0;
+	for (u32 i = 0; i < 256; i++) {
+		for (u32 j = 0; j < 256; j++) {
+			if (PairCounts[i][j]) {
+				pairs[n++] = (Pair_t){ PairCounts[i][j], i, j };
+			}
+		}
+	}
+
+	qsort(pairs, n, sizeof (Pair_t), ComparePairs);
+	for (u32 i = 0; i < n; i++) {
+		printf("%02X %02X %u\n", pairs[i].First, pairs[i].Second, pairs[i].Count);
+	}
+}
+
+static bool EnableOptions(TI83_t* TI83) {
+	if (UseJIT && !TI83_SetJITEnabled(TI83, true)) {
+		return false;
+	}
+	TI83_SetIdleLoopSkipEnabled(TI83, UseIdleLoopSkip);
+	TI83_SetFastModeEnabled(TI83, UseFastMode);
+	if (UseWatch || UseLog) {
+		// reads and writes of a few dozen addresses, like a RAM watch would have, through callbacks or the memory log
+		for (MemoryCallbackId_t id = MEM_CB_READ; id <= MEM_CB_WRITE; id++) {
+			TI83_SetMemoryWatch(TI83, id, 0, 0x10000, false);
+			TI83_SetMemoryWatch(TI83, id, 0x8000, 32, true);
+			if (UseWatch) {
+				TI83_SetMemoryCallback(TI83, id, CountWatchHit);
+			}
+		}
+		if (UseLog) {
+			TI83_SetMemoryLog(TI83, LogBuffer, sizeof (LogBuffer) / sizeof (LogBuffer[0]), (1 << MEM_CB_READ) | (1 << MEM_CB_WRITE), CountLogged);
+		}
+	}
+	// a plugin is loaded whenever EMU83_AOT_DIR has one for the workload, but only used with --aot
+	return TI83_SetAOTEnabled(TI83, UseAOT);
+}
+
+// writes the workload's program as a ROM file, for building an AOT plugin with tools/aot.c
+static bool DumpWorkload(const Workload_t* workload, const char* dir) {
+	char path[4096];
+	snprintf(path, sizeof (path), "%s/%s.rom", dir, workload->Name);
+	FILE* f = fopen(path, "wb");
+	if (!f) {
+		return false;
+	}
+
+	bool ret = fwrite(workload->Program, 1, workload->Size, f) == workload->Size;
+	ret &= fclose(f) == 0;
+	return ret;
+}
+
+static double Now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool RunWorkload(const Workload_t* workload, u32 frames) {
+	TI83_t* TI83 = TI83_CreateContext((u8*)workload->Program, workload->Size);
+	if (!TI83) {
+		return false;
+	}
+
+	// count instructions with a trace callback first, then time the same frames without it
+	InstructionCount = 0;
+	TI83_SetTraceCallback(TI83, CountInstruction);
+	for (u32 i = 0; i < frames; i++) {
+		TI83_Advance(TI83, false, false, NULL, 0, 0);
+	}
+	TI83_SetTraceCallback(TI83, NULL);
+	TI83_DestroyContext(TI83);
+
+	// best of 3 runs
+	double elapsed = 0;
+	for (u32 run = 0; run < 3; run++) {
+		TI83 = TI83_CreateContext((u8*)workload->Program, workload->Size);
+		if (!TI83) {
+			return false;
+		}
+		if (!EnableOptions(TI83)) {
+			TI83_DestroyContext(TI83);
+			return false;
+		}
+
+		double start = Now();
+		for (u32 i = 0; i < frames; i++) {
+			TI83_Advance(TI83, false, false, NULL, 0, 0);
+		}
+		double runTime = Now() - start;
+		TI83_DestroyContext(TI83);
+
+		if (run == 0 || runTime < elapsed) {
+			elapsed = runTime;
+		}
+	}
+
+	printf("%-10s %8u frames %10.2f ms %8.2f ns/instr %8.1f MIPS\n",
+		workload->Name, frames, elapsed * 1e3, elapsed * 1e9 / InstructionCount, InstructionCount / elapsed / 1e6);
+	return true;
+}
+
+// runs the workload with and without the JIT (and/or idle loop skipping, AOT blocks), comparing savestates after every frame
+// the plain interpreter is the reference, any difference is a bug
+static bool DiffWorkload(const Workload_t* workload, u32 frames) {
+	TI83_t* interp = TI83_CreateContext((u8*)workload->Program, workload->Size);
+	TI83_t* jit = TI83_CreateContext((u8*)workload->Program, workload->Size);
+	u64 stateSize = TI83_GetStateSize();
+	u8* interpState = malloc(stateSize);
+	u8* jitState = malloc(stateSize);
+	bool ret = interp && jit && interpState && jitState && EnableOptions(jit);
+	if (ret) {
+		// savestates can't be made before this
+		TI83_SetLinkFilesAreLoaded(interp);
+		TI83_SetLinkFilesAreLoaded(jit);
+		TI83_SetAOTEnabled(interp, false);
+	} else {
+		fprintf(stderr, "failed to create contexts for %s\n", workload->Name);
+	}
+
+	for (u32 i = 0; ret && i < frames; i++) {
+		TI83_Advance(interp, false, false, NULL, 0, 0);
+		TI83_Advance(jit, false, false, NULL, 0, 0);
+		if (!TI83_SaveState(interp, interpState) || !TI83_SaveState(jit, jitState)) {
+			fprintf(stderr, "failed to save state for %s\n", workload->Name);
+			ret = false;
+		} else if (memcmp(interpState, jitState, stateSize)) {
+			printf("%-10s diverged at frame %u\n", workload->Name, i);
+			ret = false;
+		}
+	}
+
+	if (ret) {
+		printf("%-10s %8u frames identical\n", workload->Name, frames);
+	}
+
+	free(jitState);
+	free(interpState);
+	if (jit) TI83_DestroyContext(jit);
+	if (interp) TI83_DestroyContext(interp);
+	return ret;
+}
+
+#define NUM_WORKLOADS (sizeof (Workloads) / sizeof (Workloads[0]))
+
+// runs every workload as one batch through TI83_AdvanceBatch, and each on its own through TI83_Advance
+// comparing lag results, video, and savestates after every frame, as a batch has to run exactly like the separate calls
+static bool DiffBatch(u32 frames) {
+	static u32 batchVideo[NUM_WORKLOADS][96 * 64];
+	static u32 video[NUM_WORKLOADS][96 * 64];
+	TI83_t* batch[NUM_WORKLOADS] = { NULL };
+	TI83_t* single[NUM_WORKLOADS] = { NULL };
+	u32* videoBuffers[NUM_WORKLOADS];
+	bool onPressed[NUM_WORKLOADS];
+	bool lagged[NUM_WORKLOADS];
+	u64 stateSize = TI83_GetStateSize();
+	u8* batchState = malloc(stateSize);
+	u8* state = malloc(stateSize);
+	bool ret = batchState && state;
+	for (u32 i = 0; ret && i < NUM_WORKLOADS; i++) {
+		batch[i] = TI83_CreateContext((u8*)Workloads[i].Program, Workloads[i].Size);
+		single[i] = TI83_CreateContext((u8*)Workloads[i].Program, Workloads[i].Size);
+		ret = batch[i] && single[i] && EnableOptions(batch[i]) && EnableOptions(single[i]);
+		if (ret) {
+			// savestates can't be made before this
+			TI83_SetLinkFilesAreLoaded(batch[i]);
+			TI83_SetLinkFilesAreLoaded(single[i]);
+			videoBuffers[i] = batchVideo[i];
+		} else {
+			fprintf(stderr, "failed to create contexts for %s\n", Workloads[i].Name);
+		}
+	}
+
+	for (u32 frame = 0; ret && frame < frames; frame++) {
+		// ON is held now and then, by a different context each frame
+		for (u32 i = 0; i < NUM_WORKLOADS; i++) {
+			onPressed[i] = ((frame + i) & 7) == 7;
+		}
+
+		TI83_AdvanceBatch(batch, NUM_WORKLOADS, onPressed, NULL, videoBuffers, 0xFFFFFFFF, 0xFF000000, lagged);
+		for (u32 i = 0; ret && i < NUM_WORKLOADS; i++) {
+			bool lag = TI83_Advance(single[i], onPressed[i], false, video[i], 0xFFFFFFFF, 0xFF000000);
+			if (!TI83_SaveState(batch[i], batchState) || !TI83_SaveState(single[i], state)) {
+				fprintf(stderr, "failed to save state for %s\n", Workloads[i].Name);
+				ret = false;
+			} else if (lag != lagged[i] || memcmp(batchVideo[i], video[i], sizeof (video[i])) || memcmp(batchState, state, stateSize)) {
+				printf("%-10s diverged at frame %u in the batch\n", Workloads[i].Name, frame);
+				ret = false;
+			}
+		}
+	}
+
+	if (ret) {
+		printf("%u workloads %8u frames identical in a batch\n", (u32)NUM_WORKLOADS, frames);
+	}
+
+	for (u32 i = 0; i < NUM_WORKLOADS; i++) {
+		if (single[i]) TI83_DestroyContext(single[i]);
+		if (batch[i]) TI83_DestroyContext(batch[i]);
+	}
+	free(state);
+	free(batchState);
+	return ret;
+}
+
+int main(int argc, char* argv[]) {
+	// emu83bench [--jit] [--idle] [--fast] [--aot] [--watch] [--log] [--diff] [--batch] [--pairs] [--dump dir] [workload|all|rom file] [frames]
+	bool diff = false;
+	bool batch = false;
+	bool pairs = false;
+	const char* dumpDir = NULL;
+	while (argc > 1 && argv[1][0] == '-') {
+		if (!strcmp(argv[1], "--jit")) {
+			UseJIT = true;
+		} else if (!strcmp(argv[1], "--idle")) {
+			UseIdleLoopSkip = true;
+		} else if (!strcmp(argv[1], "--fast")) {
+			UseFastMode = true;
+		} else if (!strcmp(argv[1], "--diff")) {
+			diff = true;
+		} else if (!strcmp(argv[1], "--batch")) {
+			batch = true;
+		} else if (!strcmp(argv[1], "--aot")) {
+			UseAOT = true;
+		} else if (!strcmp(argv[1], "--watch")) {
+			UseWatch = true;
+		} else if (!strcmp(argv[1], "--log")) {
+			UseLog = true;
+		} else if (!strcmp(argv[1], "--pairs")) {
+			pairs = true;
+		} else if (!strcmp(argv[1], "--dump") && argc > 2) {
+			dumpDir = argv[2];
+			--argc;
+			++argv;
+		} else {
+			fprintf(stderr, "unknown option %s\n", argv[1]);
+			return EXIT_FAILURE;
+		}
+		--argc;
+		++argv;
+	}
+
+	// fast mode states never match the interpreter's
+	if (diff && UseFastMode) {
+		fprintf(stderr, "--fast can't be used with --diff\n");
+		return EXIT_FAILURE;
+	}
+
+	// --diff on its own checks the JIT
+	if (diff && !UseIdleLoopSkip && !UseAOT) {
+		UseJIT = true;
+	}
+
+	const char* only = argc > 1 ? argv[1] : NULL;
+	u32 frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 2000;
+
+	// the batch always has every workload in it
+	if (batch) {
+		return DiffBatch(frames) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	bool isWorkload = !only || !strcmp(only, "all");
+	for (u32 i = 0; i < sizeof (Workloads) / sizeof (Workloads[0]); i++) {
+		isWorkload |= only && !strcmp(only, Workloads[i].Name);
+	}
+
+	if (pairs && !isWorkload) {
+		u32 size;
+		u8* rom = LoadROM(only, &size);
+		if (!rom || !CollectPairs(rom, size, frames)) {
+			fprintf(stderr, "failed to run %s\n", only);
+			free(rom);
+			return EXIT_FAILURE;
+		}
+		free(rom);
+		PrintPairs();
+		return EXIT_SUCCESS;
+	}
+
+	for (u32 i = 0; i < sizeof (Workloads) / sizeof (Workloads[0]); i++) {
+		if (only && strcmp(only, "all") && strcmp(only, Workloads[i].Name)) {
+			continue;
+		}
+
+		if (dumpDir) {
+			if (!DumpWorkload(&Workloads[i], dumpDir)) {
+				fprintf(stderr, "failed to dump %s\n", Workloads[i].Name);
+				return EXIT_FAILURE;
+			}
+			continue;
+		}
+
+		if (pairs) {
+			if (!CollectPairs((u8*)Workloads[i].Program, Workloads[i].Size, frames)) {
+				fprintf(stderr, "failed to create a context for %s\n", Workloads[i].Name);
+				return EXIT_FAILURE;
+			}
+			continue;
+		}
+
+		if (diff) {
+			if (!DiffWorkload(&Workloads[i], frames)) {
+				return EXIT_FAILURE;
+			}
+			continue;
+		}
+
+		if (!RunWorkload(&Workloads[i], frames)) {
+			fprintf(stderr, "failed to create a context for %s\n", Workloads[i].Name);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (pairs) {
+		PrintPairs();
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// runs DAA for every A and F on the normal core and on the reference core (which takes the result from a table)
+// and reports every input they disagree on
+// emu83daatest [--fast]
+
+#include "../ti83.h"
+
+// each chunk of 0x2000 inputs starts from the AF stored at 0xC000, and the results (AF after daa) go to 0x8000 onwards
+static const u8 DAAProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF, // di / ld sp,0xFFF0
+	0xED, 0x4B, 0x00, 0xC0, 0x11, 0x00, 0x80, // ld bc,(0xC000) / ld de,0x8000
+	// 0x000B
+	0xC5, 0xF1, 0x27, 0xF5, 0xE1, // push bc / pop af / daa / push af / pop hl
+	0xEB, 0x73, 0x23, 0x72, 0x23, 0xEB, // ex de,hl / ld (hl),e / inc hl / ld (hl),d / inc hl / ex de,hl
+	0x03, 0x7A, 0xFE, 0xC0, 0x20, 0xEF, // inc bc / ld a,d / cp 0xC0 / jr nz,0x000B
+	// 0x001C
+	0x76, 0x18, 0xFD, // halt / jr 0x001C
+};
+
+#define CHUNK_SIZE 0x2000
+#define MAX_FRAMES 100
+
+// returns the results for the chunk, or NULL if it didn't finish
+static const u8* RunChunk(TI83_t* TI83, u32 start) {
+	void* ram;
+	u32 len;
+	TI83_GetMemoryArea(TI83, MEM_RAM, &ram, &len);
+	((u8*)ram)[0x4000] = start & 0xFF;
+	((u8*)ram)[0x4001] = start >> 8;
+
+	for (u32 i = 0; i < MAX_FRAMES && !TI83->Halted; i++) {
+		TI83_Advance(TI83, false, false, NULL, 0, 0);
+	}
+
+	return TI83->Halted ? ram : NULL;
+}
+
+int main(int argc, char* argv[]) {
+	bool fast = argc > 1 && !strcmp(argv[1], "--fast");
+	if (argc > 1 && !fast) {
+		fprintf(stderr, "unknown option %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	u32 mismatches = 0;
+	for (u32 start = 0; start < 0x10000; start += CHUNK_SIZE) {
+		TI83_t* ref = TI83_CreateContext((u8*)DAAProgram, sizeof (DAAProgram));
+		TI83_t* TI83 = TI83_CreateContext((u8*)DAAProgram, sizeof (DAAProgram));
+		if (!ref || !TI83) {
+			fprintf(stderr, "failed to create contexts\n");
+			return EXIT_FAILURE;
+		}
+		TI83_SetReferenceCoreEnabled(ref, true);
+		TI83_SetFastModeEnabled(TI83, fast);
+
+		const u8* expected = RunChunk(ref, start);
+		const u8* results = RunChunk(TI83, start);
+		if (!expected || !results) {
+			fprintf(stderr, "the program didn't finish for %04X-%04X\n", start, start + CHUNK_SIZE - 1);
+			return EXIT_FAILURE;
+		}
+
+		for (u32 i = 0; i < CHUNK_SIZE; i++) {
+			u16 want = expected[i * 2] | (expected[i * 2 + 1] << 8);
+			u16 got = results[i * 2] | (results[i * 2 + 1] << 8);
+			// fast mode doesn't keep XF/YF (bits 5 and 3 of F)
+			if (fast) {
+				want &= ~0x28;
+				got &= ~0x28;
+			}
+			if (want != got) {
+				if (mismatches < 16) {
+					u32 af = start + i;
+					printf("A=%02X F=%02X: reference AF=%04X, got %04X\n", af >> 8, af & 0xFF, want, got);
+				}
+				++mismatches;
+			}
+		}
+
+		TI83_DestroyContext(TI83);
+		TI83_DestroyContext(ref);
+	}
+
+	if (mismatches) {
+		printf("%u of 65536 inputs differ\n", mismatches);
+		return EXIT_FAILURE;
+	}
+
+	printf("all 65536 inputs match\n");
+	return EXIT_SUCCESS;
+}
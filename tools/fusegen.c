@@ -0,0 +1,418 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// generates fusion.h (the superinstruction table, see FusedOp_t in z80.c) from an opcode pair histogram
+// emu83fusegen runframe.h pairs.txt > fusion.h
+// pairs.txt has one "first second count" line per pair (in hex, hex, decimal), as printed by emu83bench --pairs
+// each hot pair whose first instruction is simple starts a superinstruction, which is then extended while
+// the most frequent successor of its last instruction is at least half as common as the starting pair
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+typedef uint8_t u8;
+typedef uint32_t u32;
+
+#define MAX_FUSED_OPS 16
+#define MAX_FUSED_LENGTH 8
+#define MAX_CHAIN 4
+
+typedef enum {
+	FUSE_NEVER, // prefixes, halt, port I/O, di/ei
+	FUSE_LAST, // branches, may only end a superinstruction
+	FUSE_ANY, // simple, with a fixed cycle count
+} FuseKind_t;
+
+typedef struct {
+	FuseKind_t Kind;
+	u8 Length;
+	u8 Cycles; // including the opcode fetch, only needed for FUSE_ANY
+} OpcodeInfo_t;
+
+typedef struct {
+	u32 Count;
+	u8 First, Second;
+} Pair_t;
+
+typedef struct {
+	u8 Opcodes[MAX_CHAIN];
+	u32 Count;
+	u32 Length;
+	u8 Bytes;
+	u8 Lead;
+} Chain_t;
+
+static OpcodeInfo_t Info[256];
+static char* Handlers[256]; // the handler's macros, from runframe.h
+static char* Mnemonics[256]; // the comment above it
+static u32 PairCounts[256][256];
+static Pair_t Pairs[256 * 256];
+static u32 NumPairs;
+static Chain_t Chains[MAX_FUSED_OPS];
+static u32 NumChains;
+
+#define ANY(LENGTH, CYCLES) (OpcodeInfo_t){ FUSE_ANY, LENGTH, CYCLES }
+#define LAST(LENGTH) (OpcodeInfo_t){ FUSE_LAST, LENGTH, 0 }
+#define NEVER() (OpcodeInfo_t){ FUSE_NEVER, 1, 0 }
+
+// decoded per http://z80.info/decoding.htm
+static OpcodeInfo_t ClassifyOpcode(u8 op) {
+	u8 x = op >> 6, y = (op >> 3) & 7, z = op & 7, p = y >> 1, q = y & 1;
+	switch (x) {
+		case 0:
+			switch (z) {
+				case 0:
+					switch (y) {
+						case 0: case 1: return ANY(1, 4); // nop / ex af,af'
+						case 2: return LAST(2); // djnz
+						default: return LAST(2); // jr / jr cc
+					}
+				case 1: return q ? ANY(1, 11) : ANY(3, 10); // add hl,rr / ld rr,nn
+				case 2:
+					switch (p) {
+						case 0: case 1: return ANY(1, 7); // ld (rr),a / ld a,(rr)
+						case 2: return ANY(3, 16); // ld (nn),hl / ld hl,(nn)
+						default: return ANY(3, 13); // ld (nn),a / ld a,(nn)
+					}
+				case 3: return ANY(1, 6); // inc/dec rr
+				case 4: case 5: return y == 6 ? ANY(1, 11) : ANY(1, 4); // inc/dec r
+				case 6: return y == 6 ? ANY(2, 10) : ANY(2, 7); // ld r,n
+				default: return ANY(1, 4); // rlca/rrca/rla/rra/daa/cpl/scf/ccf
+			}
+		case 1:
+			if (op == 0x76) {
+				return NEVER(); // halt
+			}
+			return (y == 6 || z == 6) ? ANY(1, 7) : ANY(1, 4); // ld r,r'
+		case 2:
+			return z == 6 ? ANY(1, 7) : ANY(1, 4); // alu a,r
+		default:
+			switch (z) {
+				case 0: return LAST(1); // ret cc
+				case 1:
+					if (!q) {
+						return ANY(1, 10); // pop
+					}
+					switch (p) {
+						case 0: return LAST(1); // ret
+						case 1: return ANY(1, 4); // exx
+						case 2: return LAST(1); // jp (hl)
+						default: return ANY(1, 6); // ld sp,hl
+					}
+				case 2: return LAST(3); // jp cc,nn
+				case 3:
+					switch (y) {
+						case 0: return LAST(3); // jp nn
+						case 4: return ANY(1, 19); // ex (sp),hl
+						case 5: return ANY(1, 4); // ex de,hl
+						default: return NEVER(); // cb prefix / out (n),a / in a,(n) / di / ei
+					}
+				case 4: return LAST(3); // call cc,nn
+				case 5:
+					if (!q) {
+						return ANY(1, 11); // push
+					}
+					return p ? NEVER() : LAST(3); // dd/ed/fd prefixes / call nn
+				case 6: return ANY(2, 7); // alu a,n
+				default: return LAST(1); // rst
+			}
+	}
+}
+
+static char* Trim(char* s) {
+	while (*s == ' ' || *s == '\t') {
+		s++;
+	}
+
+	char* end = s + strlen(s);
+	while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n')) {
+		*--end = '\0';
+	}
+
+	return s;
+}
+
+static char* Duplicate(const char* s) {
+	char* ret = malloc(strlen(s) + 1);
+	if (ret) {
+		strcpy(ret, s);
+	}
+	return ret;
+}
+
+// picks up every "OPCODE(0xNN): <macros> NEXT_OPCODE();" line, along with the comment above it
+static bool ReadHandlers(const char* path) {
+	FILE* f = fopen(path, "r");
+	if (!f) {
+		return false;
+	}
+
+	char line[1024];
+	char comment[1024] = "";
+	while (fgets(line, sizeof (line), f)) {
+		char* s = Trim(line);
+		if (!strncmp(s, "// ", 3)) {
+			strcpy(comment, s + 3);
+			continue;
+		}
+
+		unsigned op;
+		int start;
+		if (sscanf(s, "OPCODE(0x%2x): %n", &op, &start) == 1 && start > 0) {
+			char* end = strstr(s, "NEXT_OPCODE();");
+			if (end && !Handlers[op]) {
+				*end = '\0';
+				Handlers[op] = Duplicate(Trim(s + start));
+				Mnemonics[op] = Duplicate(comment);
+			}
+		}
+		comment[0] = '\0';
+	}
+
+	fclose(f);
+	return true;
+}
+
+static bool ReadPairs(const char* path) {
+	FILE* f = fopen(path, "r");
+	if (!f) {
+		return false;
+	}
+
+	unsigned first, second, count;
+	while (fscanf(f, "%x %x %u", &first, &second, &count) == 3) {
+		if (first < 256 && second < 256) {
+			PairCounts[first][second] += count;
+		}
+	}
+
+	fclose(f);
+	return true;
+}
+
+static int ComparePairs(const void* a, const void* b) {
+	const Pair_t* pairA = a;
+	const Pair_t* pairB = b;
+	if (pairA->Count != pairB->Count) {
+		return (pairA->Count < pairB->Count) - (pairA->Count > pairB->Count);
+	}
+	return (pairA->First * 256 + pairA->Second) - (pairB->First * 256 + pairB->Second);
+}
+
+static bool CanFollow(u8 op) {
+	return Info[op].Kind != FUSE_NEVER && Handlers[op];
+}
+
+static bool CanLead(u8 op) {
+	return Info[op].Kind == FUSE_ANY && Handlers[op];
+}
+
+static void BuildChains(void) {
+	for (u32 i = 0; i < 256; i++) {
+		for (u32 j = 0; j < 256; j++) {
+			if (PairCounts[i][j] && CanLead(i) && CanFollow(j)) {
+				Pairs[NumPairs++] = (Pair_t){ PairCounts[i][j], i, j };
+			}
+		}
+	}
+
+	qsort(Pairs, NumPairs, sizeof (Pair_t), ComparePairs);
+
+	for (u32 i = 0; i < NumPairs && NumChains < MAX_FUSED_OPS; i++) {
+		// pairs already inside a superinstruction would mostly just give a shifted copy of it
+		bool covered = false;
+		for (u32 j = 0; j < NumChains; j++) {
+			for (u32 k = 0; k + 1 < Chains[j].Length; k++) {
+				covered |= Chains[j].Opcodes[k] == Pairs[i].First && Chains[j].Opcodes[k + 1] == Pairs[i].Second;
+			}
+		}
+
+		if (covered) {
+			continue;
+		}
+
+		Chain_t chain = { .Count = Pairs[i].Count };
+		chain.Opcodes[chain.Length++] = Pairs[i].First;
+		chain.Opcodes[chain.Length++] = Pairs[i].Second;
+		chain.Bytes = Info[Pairs[i].First].Length + Info[Pairs[i].Second].Length;
+
+		while (chain.Length < MAX_CHAIN && CanLead(chain.Opcodes[chain.Length - 1])) {
+			u8 last = chain.Opcodes[chain.Length - 1];
+			u32 best = 0;
+			for (u32 j = 1; j < 256; j++) {
+				if (PairCounts[last][j] > PairCounts[last][best] && CanFollow(j)) {
+					best = j;
+				}
+			}
+
+			if (!CanFollow(best) || PairCounts[last][best] * 2 < chain.Count || chain.Bytes + Info[best].Length > MAX_FUSED_LENGTH) {
+				break;
+			}
+
+			chain.Opcodes[chain.Length++] = best;
+			chain.Bytes += Info[best].Length;
+		}
+
+		if (chain.Bytes > MAX_FUSED_LENGTH) {
+			continue;
+		}
+
+		for (u32 j = 0; j < chain.Length - 1; j++) {
+			chain.Lead += Info[chain.Opcodes[j]].Cycles;
+		}
+
+		Chains[NumChains++] = chain;
+	}
+
+	// the matcher takes the first match, so longer superinstructions go first (insertion sort keeps the hot ones first otherwise)
+	for (u32 i = 1; i < NumChains; i++) {
+		Chain_t chain = Chains[i];
+		u32 j = i;
+		while (j > 0 && Chains[j - 1].Length < chain.Length) {
+			Chains[j] = Chains[j - 1];
+			j--;
+		}
+		Chains[j] = chain;
+	}
+}
+
+static void PrintHeader(FILE* out) {
+	static const char* const License[] = {
+		"/*",
+		"MIT License",
+		"",
+		"Copyright (c) 2022 CasualPokePlayer",
+		"",
+		"Permission is hereby granted, free of charge, to any person obtaining a copy",
+		"of this software and associated documentation files (the \"Software\"), to deal",
+		"in the Software without restriction, including without limitation the rights",
+		"to use, copy, modify, merge, publish, distribute, sublicense, and/or sell",
+		"copies of the Software, and to permit persons to whom the Software is",
+		"furnished to do so, subject to the following conditions:",
+		"",
+		"The above copyright notice and this permission notice shall be included in all",
+		"copies or substantial portions of the Software.",
+		"",
+		"THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR",
+		"IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,",
+		"FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE",
+		"AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER",
+		"LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,",
+		"OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE",
+		"SOFTWARE.",
+		"*/",
+	};
+
+	for (u32 i = 0; i < sizeof (License) / sizeof (License[0]); i++) {
+		fprintf(out, "%s\r\n", License[i]);
+	}
+}
+
+static void PrintFusion(FILE* out) {
+	// CRLF, like the rest of the tree
+	PrintHeader(out);
+	fprintf(out, "\r\n// generated by tools/fusegen.c, don't edit by hand (see README.md)\r\n\r\n");
+	fprintf(out, "#ifndef FUSION_H\r\n#define FUSION_H\r\n\r\n");
+
+	fprintf(out, "static const FusedOp_t FusedOps[] = {\r\n");
+	for (u32 i = 0; i < NumChains; i++) {
+		const Chain_t* chain = &Chains[i];
+		u8 bytes[MAX_FUSED_LENGTH] = { 0 };
+		u8 mask[MAX_FUSED_LENGTH] = { 0 };
+		u32 n = 0;
+		fprintf(out, "\t//");
+		for (u32 j = 0; j < chain->Length; j++) {
+			u8 op = chain->Opcodes[j];
+			fprintf(out, "%s %s", j ? " /" : "", Mnemonics[op]);
+			bytes[n] = op;
+			mask[n] = 0xFF;
+			n += Info[op].Length;
+		}
+		fprintf(out, " (%u pairs)\r\n", chain->Count);
+
+		fprintf(out, "\t{ %u, %u, {", chain->Bytes, chain->Lead);
+		for (u32 j = 0; j < chain->Bytes; j++) {
+			fprintf(out, "%s 0x%02X", j ? "," : "", bytes[j]);
+		}
+		fprintf(out, " }, {");
+		for (u32 j = 0; j < chain->Bytes; j++) {
+			fprintf(out, "%s 0x%02X", j ? "," : "", mask[j]);
+		}
+		fprintf(out, " } },\r\n");
+	}
+	fprintf(out, "};\r\n\r\n");
+
+	// same macros as the handlers in runframe.h, with FUSED_NEXT() in place of all but the last NEXT_OPCODE()
+	fprintf(out, "#define FUSED_OP_HANDLERS \\\r\n");
+	for (u32 i = 0; i < NumChains; i++) {
+		const Chain_t* chain = &Chains[i];
+		fprintf(out, "\tFUSED_OP(%u):", i);
+		for (u32 j = 0; j < chain->Length; j++) {
+			const char* handler = Handlers[chain->Opcodes[j]];
+			fprintf(out, "%s%s %s", *handler ? " " : "", handler, j + 1 < chain->Length ? "FUSED_NEXT();" : "NEXT_OPCODE();");
+		}
+		fprintf(out, "%s\r\n", i + 1 < NumChains ? " \\" : "");
+	}
+	fprintf(out, "\r\n");
+
+	fprintf(out, "#define FUSED_OP_LABELS \\\r\n");
+	for (u32 i = 0; i < NumChains; i++) {
+		fprintf(out, "\t&&FUSED_OP(%u),%s\r\n", i, i + 1 < NumChains ? " \\" : "");
+	}
+	fprintf(out, "\r\n#endif\r\n");
+}
+
+int main(int argc, char* argv[]) {
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s runframe.h pairs.txt > fusion.h\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	for (u32 i = 0; i < 256; i++) {
+		Info[i] = ClassifyOpcode(i);
+	}
+
+	if (!ReadHandlers(argv[1])) {
+		fprintf(stderr, "failed to read %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	if (!ReadPairs(argv[2])) {
+		fprintf(stderr, "failed to read %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	BuildChains();
+
+	// binary mode, so the CRLFs aren't doubled on Windows
+	if (!freopen(NULL, "wb", stdout)) {
+		return EXIT_FAILURE;
+	}
+
+	PrintFusion(stdout);
+	return EXIT_SUCCESS;
+}
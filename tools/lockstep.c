@@ -0,0 +1,433 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// runs programs on the reference core (see TI83_SetReferenceCoreEnabled) and the normal core side by side, reporting the first difference
+// emu83lockstep [--frames] [--jit] [--idle] [--aot] [--watch] [--log] [--break] [--random n] [workload|all|rom file] [frames]
+// by default the CPU state is compared before every instruction (through the trace callback), and savestates after every frame
+// --watch also compares the accesses the memory callbacks are called for, with a few bytes of RAM and ROM watched
+// --log does the same, but the other core reports them through the memory log (with a small buffer, so it fills up often)
+// --break stops the other core at a few breakpoints, continuing the frame each time, which must not change anything
+// the JIT, AOT blocks, superinstructions, and idle loop skipping only run without callbacks, so --frames (implied by the others)
+// only compares savestates after every frame, which still names the first frame that differs
+// --random runs n ROMs of random bytes (starting with random RAM) in place of the workloads, each seed always makes the same one
+
+#include "../ti83.h"
+#include "workloads.h"
+
+// everything the trace callback can see of the CPU, in this order
+static const char* const StateNames[] = {
+	"AF", "BC", "DE", "HL", "AF'", "BC'", "DE'", "HL'", "IX", "IY", "PC", "SP",
+	"WZ", "I", "R", "IM", "IFF", "Halted", "ROM page", "cycles",
+};
+
+#define STATE_SIZE (sizeof (StateNames) / sizeof (StateNames[0]))
+
+typedef struct {
+	u64 Values[STATE_SIZE];
+} State_t;
+
+static State_t* Trace;
+static u32 TraceLength, TraceCapacity;
+static u32 TraceIndex;
+static bool TraceFailed;
+static bool Diverged;
+static State_t DivergedState;
+
+static bool UseJIT;
+static bool UseIdleLoopSkip;
+static bool UseAOT;
+static bool UseWatch;
+static bool UseLog;
+static bool UseBreakpoints;
+static bool FramesOnly;
+static u32 RandomSeeds;
+
+static u64 RandomState;
+
+// xorshift
+static u32 Random(void) {
+	RandomState ^= RandomState << 13;
+	RandomState ^= RandomState >> 7;
+	RandomState ^= RandomState << 17;
+	return (u32)RandomState;
+}
+
+typedef struct {
+	u64 CycleCount;
+	u16 Addr;
+	u8 Kind;
+} Access_t;
+
+// the accesses the reference made in this frame, then the ones the other core made
+static Access_t* Accesses[2];
+static u32 AccessLength[2], AccessCapacity[2];
+static u32 AccessCore;
+
+static void GetState(TI83_t* TI83, u64 cycleCount, State_t* state) {
+	u32 regs[12];
+	TI83_GetRegs(TI83, regs);
+	for (u32 i = 0; i < 12; i++) {
+		state->Values[i] = regs[i];
+	}
+	state->Values[12] = TI83->WZ;
+	state->Values[13] = TI83->I;
+	state->Values[14] = TI83->R;
+	state->Values[15] = TI83->IM;
+	state->Values[16] = TI83->IFF;
+	state->Values[17] = TI83->Halted;
+	state->Values[18] = TI83->ROMPage;
+	state->Values[19] = cycleCount;
+}
+
+static void RecordState(void* userdata, u64 cycleCount) {
+	if (TraceLength == TraceCapacity) {
+		u32 capacity = TraceCapacity ? TraceCapacity * 2 : 0x10000;
+		State_t* trace = realloc(Trace, capacity * sizeof (State_t));
+		if (!trace) {
+			TraceFailed = true;
+			return;
+		}
+		Trace = trace;
+		TraceCapacity = capacity;
+	}
+
+	GetState(userdata, cycleCount, &Trace[TraceLength++]);
+}
+
+static void CompareState(void* userdata, u64 cycleCount) {
+	if (Diverged) {
+		return;
+	}
+
+	State_t state;
+	GetState(userdata, cycleCount, &state);
+	if (TraceIndex >= TraceLength || memcmp(&state, &Trace[TraceIndex], sizeof (State_t))) {
+		Diverged = true;
+		DivergedState = state;
+		return;
+	}
+
+	++TraceIndex;
+}
+
+static void RecordAccess(MemoryCallbackId_t kind, u16 addr, u64 cycleCount) {
+	u32 core = AccessCore;
+	if (AccessLength[core] == AccessCapacity[core]) {
+		u32 capacity = AccessCapacity[core] ? AccessCapacity[core] * 2 : 0x10000;
+		Access_t* accesses = realloc(Accesses[core], capacity * sizeof (Access_t));
+		if (!accesses) {
+			TraceFailed = true;
+			return;
+		}
+		Accesses[core] = accesses;
+		AccessCapacity[core] = capacity;
+	}
+
+	Accesses[core][AccessLength[core]++] = (Access_t){ cycleCount, addr, kind };
+}
+
+static void RecordRead(void* userdata, u16 addr, u64 cycleCount) {
+	(void)userdata;
+	RecordAccess(MEM_CB_READ, addr, cycleCount);
+}
+
+static void RecordWrite(void* userdata, u16 addr, u64 cycleCount) {
+	(void)userdata;
+	RecordAccess(MEM_CB_WRITE, addr, cycleCount);
+}
+
+static void RecordExecute(void* userdata, u16 addr, u64 cycleCount) {
+	(void)userdata;
+	RecordAccess(MEM_CB_EXECUTE, addr, cycleCount);
+}
+
+static MemoryLogRecord_t LogBuffer[64];
+
+static void RecordLogged(void* userdata, const MemoryLogRecord_t* records, u32 count) {
+	(void)userdata;
+	for (u32 i = 0; i < count; i++) {
+		RecordAccess(records[i].Kind, records[i].Addr, records[i].CycleCount);
+	}
+}
+
+// watches the start of RAM (where the workloads keep their data), the stack, and some of the code, for every kind of access
+static void SetWatches(TI83_t* TI83, bool log) {
+	static const MemoryCallback_t callbacks[] = { RecordRead, RecordWrite, RecordExecute };
+	for (MemoryCallbackId_t id = MEM_CB_READ; id <= MEM_CB_EXECUTE; id++) {
+		TI83_SetMemoryWatch(TI83, id, 0, 0x10000, false);
+		TI83_SetMemoryWatch(TI83, id, 0x0024, 8, true);
+		TI83_SetMemoryWatch(TI83, id, 0x8000, 0x40, true);
+		TI83_SetMemoryWatch(TI83, id, 0xFFE0, 0x10, true);
+		if (!log) {
+			TI83_SetMemoryCallback(TI83, id, callbacks[id]);
+		}
+	}
+	if (log) {
+		TI83_SetMemoryLog(TI83, LogBuffer, sizeof (LogBuffer) / sizeof (LogBuffer[0]), (1 << MEM_CB_READ) | (1 << MEM_CB_WRITE) | (1 << MEM_CB_EXECUTE), RecordLogged);
+	}
+}
+
+// the loop start of the workloads (and the ldir in blockcopy), one of the lines the RAM workload runs, and the interrupt handler
+static void SetBreakpoints(TI83_t* TI83) {
+	TI83_SetBreakpoint(TI83, MEM_ROM, 0x0020, true);
+	TI83_SetBreakpoint(TI83, MEM_ROM, 0x0029, true);
+	TI83_SetBreakpoint(TI83, MEM_ROM, 0x0038, true);
+	TI83_SetBreakpoint(TI83, MEM_RAM, 0x100B, true);
+}
+
+static const char* const AccessNames[] = { "read", "write", "execute" };
+
+// returns false after printing the first difference
+static bool CompareAccesses(const char* name, u32 frame) {
+	for (u32 i = 0; i < AccessLength[0] || i < AccessLength[1]; i++) {
+		if (i == AccessLength[0] || i == AccessLength[1]) {
+			printf("%-10s diverged at frame %u, the %s reported %u watched accesses instead of %u\n",
+				name, frame, i == AccessLength[0] ? "core" : "reference", AccessLength[1], AccessLength[0]);
+			return false;
+		}
+		const Access_t* ref = &Accesses[0][i];
+		const Access_t* access = &Accesses[1][i];
+		if (ref->CycleCount != access->CycleCount || ref->Addr != access->Addr || ref->Kind != access->Kind) {
+			printf("%-10s diverged at frame %u, watched access %u\n", name, frame, i);
+			printf("  reference %s %04X at cycle %llu, got %s %04X at cycle %llu\n",
+				AccessNames[ref->Kind], ref->Addr, (unsigned long long)ref->CycleCount,
+				AccessNames[access->Kind], access->Addr, (unsigned long long)access->CycleCount);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void PrintDifferences(const State_t* ref, const State_t* state) {
+	for (u32 i = 0; i < STATE_SIZE; i++) {
+		if (ref->Values[i] != state->Values[i]) {
+			printf("  %-8s reference %llX, got %llX\n", StateNames[i], (unsigned long long)ref->Values[i], (unsigned long long)state->Values[i]);
+		}
+	}
+}
+
+// ram is copied into both contexts before the first frame, if given
+static bool Lockstep(const char* name, const u8* rom, u32 size, const u8* ram, u32 frames) {
+	TI83_t* ref = TI83_CreateContext((u8*)rom, size);
+	TI83_t* TI83 = TI83_CreateContext((u8*)rom, size);
+	u64 stateSize = TI83_GetStateSize();
+	u8* refState = malloc(stateSize);
+	u8* state = malloc(stateSize);
+	bool ret = ref && TI83 && refState && state;
+	if (ret && UseJIT) {
+		ret = TI83_SetJITEnabled(TI83, true);
+	}
+	if (ret) {
+		// a plugin is loaded whenever EMU83_AOT_DIR has one for the ROM, but only used with --aot
+		ret = TI83_SetAOTEnabled(TI83, UseAOT);
+	}
+	if (ret) {
+		TI83_SetReferenceCoreEnabled(ref, true);
+		TI83_SetIdleLoopSkipEnabled(TI83, UseIdleLoopSkip);
+		// savestates can't be made before this
+		TI83_SetLinkFilesAreLoaded(ref);
+		TI83_SetLinkFilesAreLoaded(TI83);
+		TI83_SetCallbackUserdata(ref, ref);
+		TI83_SetCallbackUserdata(TI83, TI83);
+		if (UseWatch || UseLog) {
+			SetWatches(ref, false);
+			SetWatches(TI83, UseLog);
+		}
+		if (UseBreakpoints) {
+			SetBreakpoints(TI83);
+		}
+		if (ram) {
+			void* area;
+			u32 len;
+			TI83_GetMemoryArea(ref, MEM_RAM, &area, &len);
+			memcpy(area, ram, len);
+			TI83_GetMemoryArea(TI83, MEM_RAM, &area, &len);
+			memcpy(area, ram, len);
+		}
+	} else {
+		fprintf(stderr, "failed to create contexts for %s\n", name);
+	}
+
+	bool perInstruction = !FramesOnly && !UseJIT && !UseIdleLoopSkip && !UseAOT;
+	u64 instructions = 0;
+	u64 stops = 0;
+	for (u32 i = 0; ret && i < frames; i++) {
+		// ON is held now and then, for the programs that enable its interrupt
+		bool onPressed = (i & 7) == 7;
+		if (perInstruction) {
+			TraceLength = 0;
+			TI83_SetTraceCallback(ref, RecordState);
+		}
+		AccessCore = 0;
+		AccessLength[0] = AccessLength[1] = 0;
+		TI83_Advance(ref, onPressed, false, NULL, 0, 0);
+		TI83_SetTraceCallback(ref, NULL);
+
+		if (perInstruction) {
+			TraceIndex = 0;
+			TI83_SetTraceCallback(TI83, CompareState);
+		}
+		AccessCore = 1;
+		TI83_Advance(TI83, onPressed, false, NULL, 0, 0);
+		while (TI83_GetBreakpointHit(TI83)) {
+			++stops;
+			// continuing the frame ignores this, whichever it is
+			TI83_Advance(TI83, !onPressed, false, NULL, 0, 0);
+		}
+		TI83_SetTraceCallback(TI83, NULL);
+
+		if (TraceFailed) {
+			fprintf(stderr, "out of memory for the trace of %s\n", name);
+			ret = false;
+		} else if (Diverged) {
+			printf("%-10s diverged at frame %u, before instruction %u\n", name, i, TraceIndex);
+			if (TraceIndex) {
+				printf("  last matching PC %04llX\n", (unsigned long long)Trace[TraceIndex - 1].Values[10]);
+			}
+			if (TraceIndex < TraceLength) {
+				PrintDifferences(&Trace[TraceIndex], &DivergedState);
+			} else {
+				printf("  the reference ended the frame here\n");
+			}
+			ret = false;
+		} else if (perInstruction && TraceIndex != TraceLength) {
+			printf("%-10s diverged at frame %u, ended after %u of %u instructions\n", name, i, TraceIndex, TraceLength);
+			ret = false;
+		} else if (!CompareAccesses(name, i)) {
+			ret = false;
+		} else if (!TI83_SaveState(ref, refState) || !TI83_SaveState(TI83, state)) {
+			fprintf(stderr, "failed to save state for %s\n", name);
+			ret = false;
+		} else if (memcmp(refState, state, stateSize)) {
+			u64 offset = 0;
+			while (refState[offset] == state[offset]) {
+				++offset;
+			}
+			printf("%-10s diverged at the end of frame %u, savestates differ from byte %llu\n", name, i, (unsigned long long)offset);
+			if (!perInstruction) {
+				State_t a, b;
+				GetState(ref, TI83_GetCycleCount(ref), &a);
+				GetState(TI83, TI83_GetCycleCount(TI83), &b);
+				PrintDifferences(&a, &b);
+			}
+			ret = false;
+		}
+
+		instructions += TraceLength;
+	}
+
+	if (ret) {
+		if (perInstruction) {
+			printf("%-10s %8u frames identical, %llu instructions compared", name, frames, (unsigned long long)instructions);
+		} else {
+			printf("%-10s %8u frames identical", name, frames);
+		}
+		if (UseBreakpoints) {
+			printf(", %llu breakpoint stops", (unsigned long long)stops);
+		}
+		printf("\n");
+	}
+
+	free(state);
+	free(refState);
+	if (TI83) TI83_DestroyContext(TI83);
+	if (ref) TI83_DestroyContext(ref);
+	return ret;
+}
+
+int main(int argc, char* argv[]) {
+	while (argc > 1 && argv[1][0] == '-') {
+		if (!strcmp(argv[1], "--frames")) {
+			FramesOnly = true;
+		} else if (!strcmp(argv[1], "--jit")) {
+			UseJIT = true;
+		} else if (!strcmp(argv[1], "--idle")) {
+			UseIdleLoopSkip = true;
+		} else if (!strcmp(argv[1], "--aot")) {
+			UseAOT = true;
+		} else if (!strcmp(argv[1], "--watch")) {
+			UseWatch = true;
+		} else if (!strcmp(argv[1], "--log")) {
+			UseLog = true;
+		} else if (!strcmp(argv[1], "--break")) {
+			UseBreakpoints = true;
+		} else if (!strcmp(argv[1], "--random") && argc > 2) {
+			RandomSeeds = strtoul(argv[2], NULL, 0);
+			--argc;
+			++argv;
+		} else {
+			fprintf(stderr, "unknown option %s\n", argv[1]);
+			return EXIT_FAILURE;
+		}
+		--argc;
+		++argv;
+	}
+
+	const char* only = argc > 1 ? argv[1] : NULL;
+	u32 frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 200;
+
+	bool isWorkload = !only || !strcmp(only, "all");
+	for (u32 i = 0; i < sizeof (Workloads) / sizeof (Workloads[0]); i++) {
+		isWorkload |= only && !strcmp(only, Workloads[i].Name);
+	}
+
+	bool ret = true;
+	if (RandomSeeds) {
+		static u8 rom[0x40000];
+		static u8 ram[0x8000];
+		for (u32 seed = 1; ret && seed <= RandomSeeds; seed++) {
+			RandomState = 0x9E3779B97F4A7C15ull * seed + 1;
+			for (u32 i = 0; i < sizeof (rom); i++) {
+				rom[i] = Random();
+			}
+			for (u32 i = 0; i < sizeof (ram); i++) {
+				ram[i] = Random();
+			}
+			char name[32];
+			snprintf(name, sizeof (name), "seed %u", seed);
+			ret = Lockstep(name, rom, sizeof (rom), ram, frames);
+		}
+	} else if (!isWorkload) {
+		u32 size;
+		u8* rom = LoadROM(only, &size);
+		if (!rom) {
+			fprintf(stderr, "failed to load %s\n", only);
+			return EXIT_FAILURE;
+		}
+		ret = Lockstep(only, rom, size, NULL, frames);
+		free(rom);
+	} else {
+		for (u32 i = 0; ret && i < sizeof (Workloads) / sizeof (Workloads[0]); i++) {
+			if (!only || !strcmp(only, "all") || !strcmp(only, Workloads[i].Name)) {
+				ret = Lockstep(Workloads[i].Name, Workloads[i].Program, Workloads[i].Size, NULL, frames);
+			}
+		}
+	}
+
+	free(Trace);
+	free(Accesses[0]);
+	free(Accesses[1]);
+	return ret ? EXIT_SUCCESS : EXIT_FAILURE;
+}
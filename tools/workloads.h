@@ -0,0 +1,302 @@
+/*
+MIT License
+
+Copyright (c) 2022 CasualPokePlayer
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// small synthetic Z80 programs shared by the benchmark and the lockstep harness
+// every program starts with di / ld sp,0xFFF0, does its setup, then loops from 0x0020
+
+#ifndef WORKLOADS_H
+#define WORKLOADS_H
+
+#include "../ti83.h"
+
+typedef struct {
+	const char* Name;
+	const u8* Program;
+	u32 Size;
+} Workload_t;
+
+// 8-bit ALU, rotates, and a conditional branch on the result
+static const u8 ALUProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x06, 0x12, 0x0E, 0x34, 0x16, 0x56, 0x1E, 0x78, 0x26, 0x9A, 0x2E, 0xBC,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x80, 0x89, 0x92, 0x9B, 0xA4, 0xAD, 0xB0, 0xB9, // add a,b / adc a,c / sub d / sbc a,e / and h / xor l / or b / cp c
+	0x3C, 0x05, 0x0C, // inc a / dec b / inc c
+	0xCB, 0x01, 0xCB, 0x1A, // rlc c / rr d
+	0x87, 0x8F, // add a,a / adc a,a
+	0xC6, 0x11, 0xD6, 0x05, 0xEE, 0x5A, 0xFE, 0x40, // add a,0x11 / sub 0x05 / xor 0x5A / cp 0x40
+	0x1D, 0x20, 0xE4, // dec e / jr nz,0x0020
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// ALU ops whose flags are always observed (push af, bit)
+static const u8 FlagsProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x21, 0x00, 0x80, 0x06, 0x12, 0x0E, 0x34, 0x16, 0x56, 0x1E, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x80, 0xF5, 0x91, 0xF5, 0xA2, 0xF5, 0xB3, 0xF5, // add a,b / push af / sub c / push af / and d / push af / or e / push af
+	0xCB, 0x5F, 0xCB, 0x7E, // bit 3,a / bit 7,(hl)
+	0xF1, 0xF1, 0xF1, 0xF1, // pop af (x4)
+	0x0C, 0x3C, 0xF5, 0xF1, // inc c / inc a / push af / pop af
+	0x1D, 0x20, 0xE9, // dec e / jr nz,0x0020
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// loads and stores through hl, de, and ix
+static const u8 MemoryProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x21, 0x00, 0x80, 0x11, 0x00, 0xC0, 0xDD, 0x21, 0x00, 0x90, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x7E, 0x23, 0x12, 0x13, // ld a,(hl) / inc hl / ld (de),a / inc de
+	0xDD, 0x77, 0x05, 0xDD, 0x23, // ld (ix+5),a / inc ix
+	0x77, 0x1A, // ld (hl),a / ld a,(de)
+	0x10, 0xF3, // djnz 0x0020
+	0xC3, 0x04, 0x00, // jp 0x0004
+};
+
+// the ALU loop and some loads and stores, copied to and run from RAM
+static const u8 RAMProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x21, 0x30, 0x00, 0x11, 0x00, 0x90, 0x01, 0x11, 0x00, 0xED, 0xB0, // ld hl,0x0030 / ld de,0x9000 / ld bc,17 / ldir
+	0x21, 0x00, 0x80, 0x11, 0x00, 0xA0, 0xC3, 0x00, 0x90, // ld hl,0x8000 / ld de,0xA000 / jp 0x9000
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0030, runs at 0x9000
+	0x80, 0x89, 0x92, 0x9B, 0xA4, 0xAD, 0xB0, 0xB9, // add a,b / adc a,c / sub d / sbc a,e / and h / xor l / or b / cp c
+	0x3C, 0x05, 0x0C, // inc a / dec b / inc c
+	0x7E, 0x2C, 0x12, 0x1C, // ld a,(hl) / inc l / ld (de),a / inc e
+	0x18, 0xEF, // jr 0x9000
+};
+
+// ldir and lddr over 4KB of RAM
+static const u8 BlockCopyProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x21, 0x00, 0x80, 0x11, 0x00, 0xA0, 0x01, 0x00, 0x10, 0xED, 0xB0, // ld hl,0x8000 / ld de,0xA000 / ld bc,0x1000 / ldir
+	0x21, 0xFF, 0x8F, 0x11, 0xFF, 0xAF, 0x01, 0x00, 0x10, 0xED, 0xB8, // ld hl,0x8FFF / ld de,0xAFFF / ld bc,0x1000 / lddr
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// cpir and cpdr over 8KB of RAM with no match
+static const u8 SearchProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x21, 0x00, 0x80, 0x01, 0x00, 0x20, 0xAF, 0xED, 0xB1, // ld hl,0x8000 / ld bc,0x2000 / xor a / cpir
+	0x21, 0xFF, 0x9F, 0x01, 0x00, 0x20, 0xED, 0xB9, // ld hl,0x9FFF / ld bc,0x2000 / cpdr
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// LCD writes, both with otir and single outs
+static const u8 LCDProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x3E, 0x01, 0xD3, 0x10, 0x3E, 0x05, 0xD3, 0x10, // ld a,1 / out (0x10),a / ld a,5 / out (0x10),a
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x3E, 0x20, 0xD3, 0x10, 0x3E, 0x80, 0xD3, 0x10, // ld a,0x20 / out (0x10),a / ld a,0x80 / out (0x10),a
+	0x21, 0x00, 0x00, 0x06, 0x40, 0x0E, 0x11, 0xED, 0xB3, // ld hl,0x0000 / ld b,64 / ld c,0x11 / otir
+	0x3E, 0xAA, 0xD3, 0x11, 0xDB, 0x11, // ld a,0xAA / out (0x11),a / in a,(0x11)
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// link port toggling and polling
+static const u8 LinkProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x3E, 0x01, 0xD3, 0x00, 0xDB, 0x00, // ld a,1 / out (0),a / in a,(0)
+	0x3E, 0x02, 0xD3, 0x00, 0xDB, 0x00, // ld a,2 / out (0),a / in a,(0)
+	0xAF, 0xD3, 0x00, 0xDB, 0x00, // xor a / out (0),a / in a,(0)
+	0xE6, 0x0C, 0x28, 0xEB, // and 0x0C / jr z,0x0020
+	0xC3, 0x20, 0x00, // jp 0x0020
+};
+
+// calls, returns, pushes and pops
+static const u8 CallProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0xCD, 0x30, 0x00, // call 0x0030
+	0xC5, 0xD5, 0xE5, 0xF5, 0xF1, 0xE1, 0xD1, 0xC1, // push bc / push de / push hl / push af / pop af / pop hl / pop de / pop bc
+	0x18, 0xF3, // jr 0x0020
+	0x00, 0x00, 0x00,
+	// 0x0030
+	0x3C, 0xC9, // inc a / ret
+};
+
+// a keyboard polling loop waiting on the timer interrupt, which counts ticks
+static const u8 IdleProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x3E, 0x0B, 0xD3, 0x03, 0xED, 0x56, 0xFB, 0xC3, 0x20, 0x00, // ld a,0x0B / out (3),a / im 1 / ei / jp 0x0020
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00,
+	// 0x0020
+	0xDB, 0x01, 0xFE, 0xFF, 0x28, 0xFA, // in a,(1) / cp 0xFF / jr z,0x0020
+	0xC3, 0x20, 0x00, // jp 0x0020
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0038
+	0xF5, 0xE5, 0x21, 0x00, 0x80, 0x34, // push af / push hl / ld hl,0x8000 / inc (hl)
+	0x3E, 0x09, 0xD3, 0x03, 0x3E, 0x0B, 0xD3, 0x03, // ld a,0x09 / out (3),a / ld a,0x0B / out (3),a
+	0xE1, 0xF1, 0xFB, 0xC9, // pop hl / pop af / ei / ret
+};
+
+// the same routines called through bank 0 and, with ROM page 0 also mapped there, through bank 1
+// so the return addresses they push and the branches they take depend on which bank they run from
+static const u8 BankProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0xAF, 0xD3, 0x02, 0x06, 0x10, // xor a / out (2),a / ld b,0x10
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0xCD, 0x30, 0x00, 0xCD, 0x30, 0x40, // call 0x0030 / call 0x4030
+	0xCD, 0x40, 0x00, 0xCD, 0x40, 0x40, // call 0x0040 / call 0x4040
+	0xC3, 0x20, 0x00, // jp 0x0020
+	0x00,
+	// 0x0030
+	0x0C, 0x10, 0xFD, 0x06, 0x10, 0xC9, // inc c / djnz 0x0030 / ld b,0x10 / ret
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0040
+	0x79, 0xCD, 0x48, 0x00, 0x81, 0x4F, 0xC9, // ld a,c / call 0x0048 / add a,c / ld c,a / ret
+	0x00,
+	// 0x0048
+	0x3C, 0x87, 0xC9, // inc a / add a,a / ret
+};
+
+// idioms TI-OS routines are built from: copying, scanning for a terminator, and summing through hl
+// counting down bc to zero, and pointer arithmetic through ex de,hl / add hl,de
+// the shipped superinstruction table is generated from this one (see README.md)
+static const u8 OSProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x21, 0x90, 0x00, 0x11, 0x00, 0x80, 0x06, 0x21, 0xCD, 0x50, 0x00, // ld hl,0x0090 / ld de,0x8000 / ld b,33 / call 0x0050
+	0x21, 0x00, 0x80, 0xCD, 0x58, 0x00, // ld hl,0x8000 / call 0x0058
+	0x21, 0x90, 0x00, 0x06, 0x20, 0xCD, 0x5E, 0x00, // ld hl,0x0090 / ld b,32 / call 0x005E
+	0x01, 0x40, 0x00, 0xCD, 0x66, 0x00, // ld bc,0x0040 / call 0x0066
+	0xCD, 0x6C, 0x00, // call 0x006C
+	0xC3, 0x20, 0x00, // jp 0x0020
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0050
+	0x7E, 0x23, 0x12, 0x13, 0x10, 0xFA, 0xC9, // ld a,(hl) / inc hl / ld (de),a / inc de / djnz 0x0050 / ret
+	0x00,
+	// 0x0058
+	0x7E, 0x23, 0xB7, 0x20, 0xFB, 0xC9, // ld a,(hl) / inc hl / or a / jr nz,0x0058 / ret
+	// 0x005E
+	0x7E, 0x23, 0x81, 0x4F, 0x10, 0xFA, 0xC9, // ld a,(hl) / inc hl / add a,c / ld c,a / djnz 0x005E / ret
+	0x00,
+	// 0x0066
+	0x0B, 0x78, 0xB1, 0x20, 0xFB, 0xC9, // dec bc / ld a,b / or c / jr nz,0x0066 / ret
+	// 0x006C
+	0x21, 0x03, 0x00, 0x11, 0x00, 0x80, 0x06, 0x10, // ld hl,3 / ld de,0x8000 / ld b,16
+	0xEB, 0x19, 0xEB, 0x10, 0xFB, // ex de,hl / add hl,de / ex de,hl / djnz 0x0074
+	0x06, 0x10, 0xEB, 0x19, 0x7E, 0xEB, 0x10, 0xFA, // ld b,16 / ex de,hl / add hl,de / ld a,(hl) / ex de,hl / djnz 0x007B
+	0x06, 0x10, 0xEB, 0x19, 0x23, 0xEB, 0x10, 0xFA, // ld b,16 / ex de,hl / add hl,de / inc hl / ex de,hl / djnz 0x0083
+	0xC9, // ret
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0090
+	0x50, 0x52, 0x4F, 0x47, 0x52, 0x41, 0x4D, 0x20, 0x56, 0x41, 0x52, 0x49, 0x41, 0x42, 0x4C, 0x45, // "PROGRAM VARIABLE"
+	0x20, 0x4E, 0x41, 0x4D, 0x45, 0x53, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x4C, 0x49, 0x53, 0x54, 0x53, // " NAMES AND LISTS"
+	0x00,
+};
+
+// walks a table of (type, length, name) entries like the OS's variable table, with the same idioms as the OS workload
+// but in a different order, the superinstruction table isn't generated from it so it shows what untrained code gets
+static const u8 VATProgram[] = {
+	0xF3, 0x31, 0xF0, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0020
+	0x11, 0x60, 0x00, 0x01, 0x08, 0x00, // ld de,0x0060 / ld bc,8
+	0xEB, 0x7E, 0x23, 0x5E, 0x23, 0x16, 0x00, // ex de,hl / ld a,(hl) / inc hl / ld e,(hl) / inc hl / ld d,0
+	0xEB, 0x19, 0xEB, // ex de,hl / add hl,de / ex de,hl
+	0x0B, 0x78, 0xB1, 0x20, 0xF1, // dec bc / ld a,b / or c / jr nz,0x0026
+	0xC3, 0x20, 0x00, // jp 0x0020
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 0x0060
+	0x01, 0x04, 0x4C, 0x54, 0x50, 0x55,
+	0x00, 0x07, 0x54, 0x41, 0x50, 0x49, 0x52, 0x48, 0x47,
+	0x06, 0x08, 0x52, 0x52, 0x50, 0x4D, 0x55, 0x45, 0x48, 0x55,
+	0x06, 0x04, 0x58, 0x41, 0x56, 0x59,
+	0x01, 0x03, 0x59, 0x53, 0x42,
+	0x00, 0x05, 0x49, 0x50, 0x54, 0x58, 0x4D,
+	0x06, 0x08, 0x4D, 0x58, 0x5A, 0x53, 0x4F, 0x45, 0x4C, 0x44,
+	0x01, 0x03, 0x50, 0x47, 0x49,
+};
+
+#define WORKLOAD(NAME, PROGRAM) { NAME, PROGRAM, sizeof (PROGRAM) }
+
+static const Workload_t Workloads[] = {
+	WORKLOAD("alu", ALUProgram),
+	WORKLOAD("flags", FlagsProgram),
+	WORKLOAD("memory", MemoryProgram),
+	WORKLOAD("ram", RAMProgram),
+	WORKLOAD("blockcopy", BlockCopyProgram),
+	WORKLOAD("search", SearchProgram),
+	WORKLOAD("lcd", LCDProgram),
+	WORKLOAD("link", LinkProgram),
+	WORKLOAD("call", CallProgram),
+	WORKLOAD("idle", IdleProgram),
+	WORKLOAD("bank", BankProgram),
+	WORKLOAD("os", OSProgram),
+	WORKLOAD("vat", VATProgram),
+};
+
+// a ROM dump given in place of a workload name (e.g. for --pairs over TI-OS)
+static u8* LoadROM(const char* path, u32* size) {
+	FILE* f = fopen(path, "rb");
+	if (!f) {
+		return NULL;
+	}
+
+	u8* rom = NULL;
+	if (!fseek(f, 0, SEEK_END)) {
+		long len = ftell(f);
+		if (len > 0 && !fseek(f, 0, SEEK_SET)) {
+			rom = malloc(len);
+			if (rom && fread(rom, 1, len, f) != (size_t)len) {
+				free(rom);
+				rom = NULL;
+			}
+			*size = len;
+		}
+	}
+
+	fclose(f);
+	return rom;
+}
+
+#endif
@@ -23,39 +23,127 @@ SOFTWARE.
 */
 
 #include "ti83.h"
+#include "z80.h"
 #include "memory.h"
 #include "events.h"
+#include "jit.h"
+#include "aot.h"
+
+// whether the RunFrame variant being compiled tests for callbacks (see RunFrameVariant_t)
+#define MEMORY_CALLBACKS (RUN_FRAME_VARIANT >= RUN_FRAME_MEMORY_CALLBACKS)
+#define TRACE_CALLBACK (RUN_FRAME_VARIANT >= RUN_FRAME_ALL_CALLBACKS)
+
+// RunFrame counts down cyclesLeft, the cycles left until eventTime, instead of comparing the cycle count against NextEventTime
+// anything that might (re)schedule an event (port I/O, callbacks, ScheduleEvent, the helpers) is followed by SYNC_BUDGET()
+// which only has work to do if NextEventTime actually changed
+// eventTime is set no earlier than the current cycle, so an overdue event just leaves no cycles
+// it is also capped to fit cyclesLeft, although END_FRAME always keeps the next event within the frame
+#define CYCLE_COUNT() (eventTime - (u64)cyclesLeft)
+
+#define SET_CYCLE_COUNT(CYCLES) do { \
+	u64 now = CYCLES; \
+	eventTime = TI83->NextEventTime; \
+	if (eventTime < now) { \
+		eventTime = now; \
+	} else if (eventTime - now > INT32_MAX) { \
+		eventTime = now + INT32_MAX; \
+	} \
+	cyclesLeft = (s32)(eventTime - now); \
+} while (0)
+
+#define SYNC_BUDGET() do { \
+	if (UNLIKELY(TI83->NextEventTime != eventTime)) { \
+		SET_CYCLE_COUNT(CYCLE_COUNT()); \
+	} \
+} while (0)
+
+// memory callbacks only fire for watched addresses (see TI83_SetMemoryWatch), which is a bit test per access
+#define WATCHED(WATCH, ADDR) ((WATCH)[(ADDR) >> 3] & (1 << ((ADDR) & 7)))
+
+// in memory log mode (see TI83_SetMemoryLog), watched accesses of the kinds logged are appended to the host's buffer instead
+// the host only gets called when it fills up, and at the end of the frame (see RunFrame)
+#define LOGGED(KIND) (TI83->MemoryLogKinds & (1 << (KIND)))
+
+#define LOG_ACCESS(KIND, WATCH, ADDR, VAL) do { \
+	if (MEMORY_CALLBACKS && UNLIKELY(LOGGED(KIND)) && WATCHED(TI83->WATCH, ADDR)) { \
+		TI83->MemoryLog[TI83->MemoryLogLength] = (MemoryLogRecord_t){ CYCLE_COUNT(), ADDR, KIND, TI83->ROMPage, VAL, { 0 } }; \
+		if (++TI83->MemoryLogLength == TI83->MemoryLogCapacity) { \
+			SPILL_REGS(); \
+			FlushMemoryLog(TI83); \
+			SYNC_BUDGET(); \
+		} \
+	} \
+} while (0)
+
+// breakpoints are indexed by where ADDR is mapped to, like DecodeCache (see TI83_SetBreakpoint)
+#define BREAKPOINT_INDEX(ADDR) ((u32)(&TI83->DecodePtrs[(ADDR) >> 14][ADDR] - TI83->DecodeCache))
+
+// stops RunFrame before the instruction at PC if it has a breakpoint, checked along with the memory callbacks
+// RunFrame continues at the same cycle, which is how the instruction it stopped at gets to run
+// repeats of block instructions are fetched again, so they stop every time
+#define CHECK_BREAKPOINT() do { \
+	if (MEMORY_CALLBACKS && UNLIKELY(TI83->NumBreakpoints)) { \
+		u32 index = BREAKPOINT_INDEX(REGS(PC)); \
+		if ((TI83->Breakpoints[index >> 3] & (1 << (index & 7))) && CYCLE_COUNT() != TI83->BreakpointCycleCount) { \
+			SPILL_REGS(); \
+			TI83->CycleCount = TI83->BreakpointCycleCount = CYCLE_COUNT(); \
+			TI83->BreakpointHit = true; \
+			return false; \
+		} \
+	} \
+} while (0)
 
 #define FETCH(DEST, ADDR) do { \
 	u16 address = ADDR; \
-	if (UNLIKELY(TI83->ExecuteCallback)) { \
-		TI83->ExecuteCallback(address, cycleCount); \
+	if (MEMORY_CALLBACKS && UNLIKELY(TI83->ExecuteCallback) && WATCHED(TI83->ExecuteWatch, address)) { \
+		SPILL_REGS(); \
+		TI83->ExecuteCallback(TI83->CallbackUserdata, address, CYCLE_COUNT()); \
+		SYNC_BUDGET(); \
 	} \
-	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + 1) & 0x7F); \
+	ADVANCE_R(1); \
 	DEST = ReadMem(TI83, address); \
-	cycleCount += 4; \
+	LOG_ACCESS(MEM_CB_EXECUTE, ExecuteWatch, address, DEST); \
+	cyclesLeft -= 4; \
 } while (0)
 
 #define READ(DEST, ADDR) do { \
 	u16 address = ADDR; \
-	if (UNLIKELY(TI83->ReadCallback)) { \
-		TI83->ReadCallback(address, cycleCount); \
+	if (MEMORY_CALLBACKS && UNLIKELY(TI83->ReadCallback) && WATCHED(TI83->ReadWatch, address)) { \
+		SPILL_REGS(); \
+		TI83->ReadCallback(TI83->CallbackUserdata, address, CYCLE_COUNT()); \
+		SYNC_BUDGET(); \
 	} \
 	DEST = ReadMem(TI83, address); \
-	cycleCount += 3; \
+	LOG_ACCESS(MEM_CB_READ, ReadWatch, address, DEST); \
+	cyclesLeft -= 3; \
 } while (0)
 
 #define WRITE(ADDR, VAL) do { \
 	u16 address = ADDR; \
-	if (UNLIKELY(TI83->WriteCallback)) { \
-		TI83->WriteCallback(address, cycleCount); \
+	u8 value = VAL; \
+	if (MEMORY_CALLBACKS && UNLIKELY(TI83->WriteCallback) && WATCHED(TI83->WriteWatch, address)) { \
+		SPILL_REGS(); \
+		TI83->WriteCallback(TI83->CallbackUserdata, address, CYCLE_COUNT()); \
+		SYNC_BUDGET(); \
+	} \
+	WriteMem(TI83, address, value); \
+	LOG_ACCESS(MEM_CB_WRITE, WriteWatch, address, value); \
+	cyclesLeft -= 3; \
+} while (0)
+
+// reads the next byte of the instruction, taken from the decoded copy if there is one
+#define READ_PC(DEST) do { \
+	if (operand) { \
+		DEST = *operand++; \
+		++REGS(PC); \
+		cyclesLeft -= 3; \
+	} else { \
+		READ(DEST, REGS(PC)++); \
 	} \
-	WriteMem(TI83, address, VAL); \
-	cycleCount += 3; \
 } while (0)
 
-#define IN(DEST, PORT) do { DEST = ReadPort(TI83, PORT); cycleCount += 4; } while (0)
-#define OUT(PORT, VAL) do { WritePort(TI83, PORT, VAL, cycleCount); cycleCount += 4; } while (0)
+#define IN(DEST, PORT) do { SPILL_REGS(); DEST = ReadPort(TI83, PORT); SYNC_BUDGET(); cyclesLeft -= 4; } while (0)
+#define OUT(PORT, VAL) do { SPILL_REGS(); WritePort(TI83, PORT, VAL, CYCLE_COUNT()); SYNC_BUDGET(); cyclesLeft -= 4; } while (0)
 
 #define REGS_AF TI83->MainRegs.AF
 #define REGS_BC TI83->MainRegs.BC
@@ -95,6 +183,20 @@ SOFTWARE.
 
 #define REGS(R) REGS_##R
 
+// RunFrame can keep some of these in locals instead (see CACHE_REGISTERS)
+// SPILL_REGS() puts them back in TI83 before anything else can look at them, RELOAD_REGS() picks up any changes made there
+#define SPILL_REGS() do { } while (0)
+#define RELOAD_REGS() do { } while (0)
+
+// R counts opcode fetches in its low 7 bits, but is rarely read (ld a,r, TI83_GetRegs, savestates, Event)
+// so RunFrame only bumps a counter with ADVANCE_R(), and masks the result into R when it's read (see CACHE_REGISTERS)
+#define ADVANCE_R(N) do { REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + (N)) & 0x7F); } while (0)
+#define GET_R() REGS(R)
+#define SET_R(VAL) do { REGS(R) = VAL; } while (0)
+
+#define GET_I() REGS(I)
+#define SET_I(VAL) do { REGS(I) = VAL; } while (0)
+
 #define ALT_REGS_AF TI83->AltRegs.AF
 #define ALT_REGS_BC TI83->AltRegs.BC
 #define ALT_REGS_DE TI83->AltRegs.DE
@@ -142,7 +244,15 @@ SOFTWARE.
 	} \
 } while (0)
 
-#define PF_CHECK(N) do { if (ParityLUT[N]) REGS(F) |= PF_BIT; } while (0)
+#define PF_CHECK(N) do { REGS(F) |= SZYXPFlagsLUT[N] & PF_BIT; } while (0)
+
+// index into the 8-bit half carry (low 3 bits) and overflow (high 3 bits) tables
+// built from bit 3 and bit 7 of each operand and the result
+#define HV_INDEX(N1, N2, RES) ((((N1) & 0x88) >> 3) | (((N2) & 0x88) >> 2) | (((RES) & 0x88) >> 1))
+#define HF_ADD(INDEX) HalfCarryAddLUT[(INDEX) & 0x07]
+#define HF_SUB(INDEX) HalfCarrySubLUT[(INDEX) & 0x07]
+#define VF_ADD(INDEX) OverflowAddLUT[(INDEX) >> 4]
+#define VF_SUB(INDEX) OverflowSubLUT[(INDEX) >> 4]
 
 #if defined(__GNUC__) && __GNUC__ >= 7 && !defined(__clang__)
 	#define CHECK_ADD_OVERFLOW(N1, N2, T) __builtin_add_overflow_p(SIGNED(N1, T), SIGNED(N2, T), (T)0)
@@ -196,50 +306,91 @@ SOFTWARE.
 
 #define YF_CHECK(N) do { REGS(F) |= (N >> ((sizeof (N) - 1) * 8)) & YF_BIT; } while (0)
 
+// bit copies YF and XF from the register tested, or from W if it's memory
+#define XY_FLAGS(N) (N & (YF_BIT | XF_BIT))
+
+// block transfers and compares take YF from bit 1 of N instead
+#define BLOCK_XY_CHECK(N) do { \
+	if (N & BIT(1)) { \
+		REGS(F) |= YF_BIT; \
+	} \
+	XF_CHECK(N); \
+} while (0)
+
 #define ZF_CHECK(N) do { if (!N) REGS(F) |= ZF_BIT; } while (0)
 
 #define SF_CHECK(N) do { if (N & MSB(N)) REGS(F) |= SF_BIT; } while (0)
 
+// most flag results are overwritten before anything looks at them
+// so the common ALU ops only record their operands and result, and F is computed from those on demand
+// anything that reads or partially modifies F must SYNC_FLAGS() first (or use FLAG_*F() for a single flag)
+
+#define SET_LAZY_FLAGS(OP, LHS, RHS, RES, CARRY) do { \
+	TI83->LazyFlags.Op = OP; \
+	TI83->LazyFlags.N1 = LHS; \
+	TI83->LazyFlags.N2 = RHS; \
+	TI83->LazyFlags.Res = RES; \
+	TI83->LazyFlags.Carry = CARRY; \
+} while (0)
+
+#define SET_LAZY_LOGIC_FLAGS(OP, RES, CARRY) do { \
+	TI83->LazyFlags.Op = OP; \
+	TI83->LazyFlags.Res = RES; \
+	TI83->LazyFlags.Carry = CARRY; \
+} while (0)
+
+#define SYNC_FLAGS() do { \
+	if (TI83->LazyFlags.Op != FLAGS_NONE) { \
+		MaterializeFlags(TI83); \
+	} \
+} while (0)
+
+#define DISCARD_FLAGS() do { TI83->LazyFlags.Op = FLAGS_NONE; } while (0)
+
+// Z, S, and C come straight from a pending result, which keeps conditional branches cheap
+
+#define FLAG_ZF() (TI83->LazyFlags.Op != FLAGS_NONE ? !TI83->LazyFlags.Res : (REGS(F) & ZF_BIT))
+#define FLAG_SF() (TI83->LazyFlags.Op != FLAGS_NONE ? (TI83->LazyFlags.Res & SF_BIT) : (REGS(F) & SF_BIT))
+#define FLAG_CF() (TI83->LazyFlags.Op != FLAGS_NONE ? TI83->LazyFlags.Carry : (REGS(F) & CF_BIT))
+#define FLAG_PF() ((TI83->LazyFlags.Op != FLAGS_NONE ? MaterializeFlags(TI83) : REGS(F)) & PF_BIT)
+
 #define LD_R_R(R1, R2) do { REGS(R1) = REGS(R2); } while (0)
 
 #define LD_A_IR(IR) do { \
-	REGS(F) &= CF_BIT; \
-	REGS(A) = REGS(IR); \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	SYNC_FLAGS(); \
+	REGS(A) = GET_##IR(); \
+	REGS(F) = (REGS(F) & CF_BIT) | SZYXFlagsLUT[REGS(A)]; \
 	if (TI83->IFF) { \
 		REGS(F) |= PF_BIT; \
 	} \
-	++cycleCount; \
+	--cyclesLeft; \
 } while (0)
 
 #define LD_IR_A(IR) do { \
-	REGS(IR) = REGS(A); \
-	++cycleCount; \
+	SET_##IR(REGS(A)); \
+	--cyclesLeft; \
 } while (0)
 
 #define LD_RR_NN(R1, R2) do { \
-	READ(REGS(R2), REGS(PC)++); \
-	READ(REGS(R1), REGS(PC)++); } \
+	READ_PC(REGS(R2)); \
+	READ_PC(REGS(R1)); } \
 while (0)
 
-#define LD_R_N(R) do { READ(REGS(R), REGS(PC)++); } while (0)
+#define LD_R_N(R) do { READ_PC(REGS(R)); } while (0)
 
 #define LD_DHL_N() do { \
 	u8 val; \
-	READ(val, REGS(PC)++); \
+	READ_PC(val); \
 	WRITE(REGS(HL), val); \
 } while (0)
 
 #define LD_DRR_E_N(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 2; \
+	READ_PC(e); \
+	cyclesLeft -= 2; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 val; \
-	READ(val, REGS(PC)++); \
+	READ_PC(val); \
 	WRITE(REGS(WZ), val); \
 } while (0)
 
@@ -249,8 +400,8 @@ while (0)
 
 #define LD_DRR_E_R(RR, R) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	WRITE(REGS(WZ), REGS(R)); \
 } while (0)
@@ -261,16 +412,16 @@ while (0)
 
 #define LD_R_DRR_E(R, RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	READ(REGS(R), REGS(WZ)); \
 } while (0)
 
 #define LD_DNN_RR(R1, R2) do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	WRITE(addr.Full++, REGS(R2)); \
 	WRITE(addr.Full, REGS(R1)); \
 	REGS(WZ) = addr.Full; \
@@ -278,8 +429,8 @@ while (0)
 
 #define LD_RR_DNN(R1, R2) do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	READ(REGS(R2), addr.Full++); \
 	READ(REGS(R1), addr.Full); \
 	REGS(WZ) = addr.Full; \
@@ -287,8 +438,8 @@ while (0)
 
 #define LD_DNN_A() do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	WRITE(addr.Full, REGS(A)); \
 	REGS(W) = REGS(A); \
 	REGS(Z) = addr.Low + 1; \
@@ -296,109 +447,82 @@ while (0)
 
 #define LD_A_DNN() do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	READ(REGS(A), addr.Full); \
 	REGS(WZ) = addr.Full + 1; \
 } while (0)
 
 #define INC_RR(RR) do { \
 	++REGS(RR); \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
 } while (0)
 
 #define INC_R(R) do { \
-	REGS(F) &= CF_BIT; \
-	HF_CHECK_ADD(REGS(R), 1); \
-	VF_CHECK_ADD(REGS(R), 1, s8); \
+	bool carry = FLAG_CF(); \
+	u8 lhs = REGS(R); \
 	++REGS(R); \
-	SF_CHECK(REGS(R)); \
-	ZF_CHECK(REGS(R)); \
-	YF_CHECK(REGS(R)); \
-	XF_CHECK(REGS(R)); \
+	SET_LAZY_FLAGS(FLAGS_ADD, lhs, 1, REGS(R), carry); \
 } while (0)
 
 #define INC_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
-	REGS(F) &= CF_BIT; \
-	HF_CHECK_ADD(dhl, 1); \
-	VF_CHECK_ADD(dhl, 1, s8); \
-	WRITE(REGS(HL), ++dhl); \
-	SF_CHECK(dhl); \
-	ZF_CHECK(dhl); \
-	YF_CHECK(dhl); \
-	XF_CHECK(dhl); \
+	--cyclesLeft; \
+	bool carry = FLAG_CF(); \
+	u8 res = dhl + 1; \
+	WRITE(REGS(HL), res); \
+	SET_LAZY_FLAGS(FLAGS_ADD, dhl, 1, res, carry); \
 } while (0)
 
 #define INC_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
-	REGS(F) &= CF_BIT; \
-	HF_CHECK_ADD(drr, 1); \
-	VF_CHECK_ADD(drr, 1, s8); \
-	WRITE(REGS(WZ), ++drr); \
-	SF_CHECK(drr); \
-	ZF_CHECK(drr); \
-	YF_CHECK(drr); \
-	XF_CHECK(drr); \
+	--cyclesLeft; \
+	bool carry = FLAG_CF(); \
+	u8 res = drr + 1; \
+	WRITE(REGS(WZ), res); \
+	SET_LAZY_FLAGS(FLAGS_ADD, drr, 1, res, carry); \
 } while (0)
 
 #define DEC_RR(RR) do { \
 	--REGS(RR); \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
 } while (0)
 
 #define DEC_R(R) do { \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(REGS(R), 1); \
-	VF_CHECK_SUB(REGS(R), 1, s8); \
+	bool carry = FLAG_CF(); \
+	u8 lhs = REGS(R); \
 	--REGS(R); \
-	SF_CHECK(REGS(R)); \
-	ZF_CHECK(REGS(R)); \
-	YF_CHECK(REGS(R)); \
-	XF_CHECK(REGS(R)); \
+	SET_LAZY_FLAGS(FLAGS_SUB, lhs, 1, REGS(R), carry); \
 } while (0)
 
 #define DEC_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(dhl, 1); \
-	VF_CHECK_SUB(dhl, 1, s8); \
-	WRITE(REGS(HL), --dhl); \
-	SF_CHECK(dhl); \
-	ZF_CHECK(dhl); \
-	YF_CHECK(dhl); \
-	XF_CHECK(dhl); \
+	--cyclesLeft; \
+	bool carry = FLAG_CF(); \
+	u8 res = dhl - 1; \
+	WRITE(REGS(HL), res); \
+	SET_LAZY_FLAGS(FLAGS_SUB, dhl, 1, res, carry); \
 } while (0)
 
 #define DEC_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(drr, 1); \
-	VF_CHECK_SUB(drr, 1, s8); \
-	WRITE(REGS(WZ), --drr); \
-	SF_CHECK(drr); \
-	ZF_CHECK(drr); \
-	YF_CHECK(drr); \
-	XF_CHECK(drr); \
+	--cyclesLeft; \
+	bool carry = FLAG_CF(); \
+	u8 res = drr - 1; \
+	WRITE(REGS(WZ), res); \
+	SET_LAZY_FLAGS(FLAGS_SUB, drr, 1, res, carry); \
 } while (0)
 
 #define EX_RR_ARR(RR) do { \
@@ -407,7 +531,13 @@ while (0)
 	ALT_REGS(RR) = temp; \
 } while (0)
 
+#define EX_AF_AF() do { \
+	SYNC_FLAGS(); \
+	EX_RR_ARR(AF); \
+} while (0)
+
 #define ADD_RR_RR(RR1, RR2) do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	HF_CHECK_ADD(REGS(RR1), REGS(RR2)); \
 	CF_CHECK_ADD(REGS(RR1), REGS(RR2), u16); \
@@ -415,11 +545,12 @@ while (0)
 	REGS(RR1) += REGS(RR2); \
 	YF_CHECK(REGS(RR1)); \
 	XF_CHECK(REGS(RR1)); \
-	cycleCount += 7; \
+	cyclesLeft -= 7; \
 } while (0)
 
 #define ADC_HL_RR(RR) do { \
-	bool carry = REGS(F) & CF_BIT; \
+	bool carry = FLAG_CF(); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	HF_CHECK_ADC(REGS(HL), REGS(RR), carry); \
 	VF_CHECK_ADC(REGS(HL), REGS(RR), carry, s16); \
@@ -430,11 +561,12 @@ while (0)
 	ZF_CHECK(REGS(HL)); \
 	YF_CHECK(REGS(HL)); \
 	XF_CHECK(REGS(HL)); \
-	cycleCount += 7; \
+	cyclesLeft -= 7; \
 } while (0)
 
 #define SBC_HL_RR(RR) do { \
-	bool carry = REGS(F) & CF_BIT; \
+	bool carry = FLAG_CF(); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	REGS(F) |= NF_BIT; \
 	HF_CHECK_SBC(REGS(HL), REGS(RR), carry); \
@@ -446,25 +578,47 @@ while (0)
 	ZF_CHECK(REGS(HL)); \
 	YF_CHECK(REGS(HL)); \
 	XF_CHECK(REGS(HL)); \
-	cycleCount += 7; \
+	cyclesLeft -= 7; \
+} while (0)
+
+// lets IdleLoopBranch watch where a taken branch went
+#define IDLE_LOOP_BRANCH(END) do { \
+	if (UNLIKELY(TI83->IdleLoopSkip)) { \
+		SPILL_REGS(); \
+		cyclesLeft -= IdleLoopBranch(TI83, CYCLE_COUNT(), END); \
+		RELOAD_REGS(); \
+		SYNC_BUDGET(); \
+	} \
+} while (0)
+
+// a branch not taken at the end of the watched loop leaves it
+#define IDLE_LOOP_FALLTHROUGH() do { \
+	if (UNLIKELY(TI83->IdleLoopSkip) && REGS(PC) == TI83->IdleLoop.End) { \
+		TI83->IdleLoop.End = 0; \
+	} \
 } while (0)
 
 #define JR_CC_E(CC) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
+	READ_PC(e); \
 	if (CC) { \
+		u16 branchEnd = REGS(PC); \
 		REGS(PC) += SIGNED(e, s8); \
 		REGS(WZ) = REGS(PC); \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		IDLE_LOOP_BRANCH(branchEnd); \
+	} else { \
+		IDLE_LOOP_FALLTHROUGH(); \
 	} \
 } while (0)
 
 #define DJNZ_E() do { \
-	++cycleCount; \
+	--cyclesLeft; \
 	JR_CC_E(--REGS(B)); \
 } while (0)
 
 #define RLCA() do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	bool carry = REGS(A) & BIT(7); \
 	REGS(A) <<= 1; \
@@ -477,6 +631,7 @@ while (0)
 } while (0)
 
 #define RRCA() do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	bool carry = REGS(A) & BIT(0); \
 	REGS(A) >>= 1; \
@@ -489,6 +644,7 @@ while (0)
 } while (0)
 
 #define RLA() do { \
+	SYNC_FLAGS(); \
 	bool cf = REGS(F) & CF_BIT; \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	bool carry = REGS(A) & BIT(7); \
@@ -504,6 +660,7 @@ while (0)
 } while (0)
 
 #define RRA() do { \
+	SYNC_FLAGS(); \
 	bool cf = REGS(F) & CF_BIT; \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	bool carry = REGS(A) & BIT(0); \
@@ -519,10 +676,33 @@ while (0)
 } while (0)
 
 #define DAA() do { \
-	REGS(AF) = DaaLUT[REGS(AF)]; \
+	SYNC_FLAGS(); \
+	u8 diff = 0; \
+	u8 hf = 0; \
+	bool carry = REGS(F) & CF_BIT; \
+	if ((REGS(F) & HF_BIT) || (REGS(A) & 0x0F) > 0x09) { \
+		diff |= 0x06; \
+	} \
+	if (carry || REGS(A) > 0x99) { \
+		diff |= 0x60; \
+		carry = true; \
+	} \
+	if (REGS(F) & NF_BIT) { \
+		if ((REGS(F) & HF_BIT) && (REGS(A) & 0x0F) < 0x06) { \
+			hf = HF_BIT; \
+		} \
+		REGS(A) -= diff; \
+	} else { \
+		if ((REGS(A) & 0x0F) > 0x09) { \
+			hf = HF_BIT; \
+		} \
+		REGS(A) += diff; \
+	} \
+	REGS(F) = SZYXPFlagsLUT[REGS(A)] | (REGS(F) & NF_BIT) | hf | carry; \
 } while (0)
 
 #define CPL() do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT | CF_BIT; \
 	REGS(F) |= HF_BIT | NF_BIT; \
 	REGS(A) = ~REGS(A); \
@@ -531,6 +711,7 @@ while (0)
 } while (0)
 
 #define SCF() do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT; \
 	REGS(F) |= CF_BIT; \
 	YF_CHECK(REGS(A)); \
@@ -538,6 +719,7 @@ while (0)
 } while (0)
 
 #define CCF() do { \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | PF_BIT | CF_BIT; \
 	if (REGS(F) & CF_BIT) { \
 		REGS(F) |= HF_BIT; \
@@ -548,15 +730,10 @@ while (0)
 } while (0)
 
 #define ADD_A(N) do { \
-	REGS(F) = 0; \
-	HF_CHECK_ADD(REGS(A), N); \
-	VF_CHECK_ADD(REGS(A), N, s8); \
-	CF_CHECK_ADD(REGS(A), N, u8); \
-	REGS(A) += N; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	u8 lhs = REGS(A), rhs = N; \
+	u32 res = lhs + rhs; \
+	REGS(A) = res; \
+	SET_LAZY_FLAGS(FLAGS_ADD, lhs, rhs, res, res > 0xFF); \
 } while (0)
 
 #define ADD_A_R(R) do { \
@@ -571,14 +748,14 @@ while (0)
 
 #define ADD_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	ADD_A(n); \
 } while (0)
 
 #define ADD_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -586,16 +763,11 @@ while (0)
 } while (0)
 
 #define ADC_A(N) do { \
-	bool carry = REGS(F) & CF_BIT; \
-	REGS(F) = 0; \
-	HF_CHECK_ADC(REGS(A), N, carry); \
-	VF_CHECK_ADC(REGS(A), N, carry, s8); \
-	CF_CHECK_ADC(REGS(A), N, carry); \
-	REGS(A) += N + carry; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	bool carry = FLAG_CF(); \
+	u8 lhs = REGS(A), rhs = N; \
+	u32 res = lhs + rhs + carry; \
+	REGS(A) = res; \
+	SET_LAZY_FLAGS(FLAGS_ADD, lhs, rhs, res, res > 0xFF); \
 } while (0)
 
 #define ADC_A_R(R) do { \
@@ -610,14 +782,14 @@ while (0)
 
 #define ADC_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	ADC_A(n); \
 } while (0)
 
 #define ADC_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -625,16 +797,10 @@ while (0)
 } while (0)
 
 #define SUB_A(N) do { \
-	REGS(F) = 0; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(REGS(A), N); \
-	VF_CHECK_SUB(REGS(A), N, s8); \
-	CF_CHECK_SUB(REGS(A), N, u8); \
-	REGS(A) -= N; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	u8 lhs = REGS(A), rhs = N; \
+	u32 res = lhs - rhs; \
+	REGS(A) = res; \
+	SET_LAZY_FLAGS(FLAGS_SUB, lhs, rhs, res, res > 0xFF); \
 } while (0)
 
 #define SUB_A_R(R) do { \
@@ -649,14 +815,14 @@ while (0)
 
 #define SUB_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	SUB_A(n); \
 } while (0)
 
 #define SUB_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -664,17 +830,11 @@ while (0)
 } while (0)
 
 #define SBC_A(N) do { \
-	bool carry = REGS(F) & CF_BIT; \
-	REGS(F) = 0; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SBC(REGS(A), N, carry); \
-	VF_CHECK_SBC(REGS(A), N, carry, s8); \
-	CF_CHECK_SBC(REGS(A), N, carry); \
-	REGS(A) -= N + carry; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	bool carry = FLAG_CF(); \
+	u8 lhs = REGS(A), rhs = N; \
+	u32 res = lhs - rhs - carry; \
+	REGS(A) = res; \
+	SET_LAZY_FLAGS(FLAGS_SUB, lhs, rhs, res, res > 0xFF); \
 } while (0)
 
 #define SBC_A_R(R) do { \
@@ -689,14 +849,14 @@ while (0)
 
 #define SBC_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	SBC_A(n); \
 } while (0)
 
 #define SBC_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -704,14 +864,8 @@ while (0)
 } while (0)
 
 #define AND_A(N) do { \
-	REGS(F) = 0; \
-	REGS(F) |= HF_BIT; \
 	REGS(A) &= N; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
-	PF_CHECK(REGS(A)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_AND, REGS(A), false); \
 } while (0)
 
 #define AND_A_R(R) do { \
@@ -726,14 +880,14 @@ while (0)
 
 #define AND_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	AND_A(n); \
 } while (0)
 
 #define AND_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -741,13 +895,8 @@ while (0)
 } while (0)
 
 #define XOR_A(N) do { \
-	REGS(F) = 0; \
 	REGS(A) ^= N; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
-	PF_CHECK(REGS(A)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, REGS(A), false); \
 } while (0)
 
 #define XOR_A_R(R) do { \
@@ -762,14 +911,14 @@ while (0)
 
 #define XOR_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	XOR_A(n); \
 } while (0)
 
 #define XOR_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -777,13 +926,8 @@ while (0)
 } while (0)
 
 #define OR_A(N) do { \
-	REGS(F) = 0; \
 	REGS(A) |= N; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
-	PF_CHECK(REGS(A)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, REGS(A), false); \
 } while (0)
 
 #define OR_A_R(R) do { \
@@ -798,14 +942,14 @@ while (0)
 
 #define OR_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	OR_A(n); \
 } while (0)
 
 #define OR_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -813,16 +957,9 @@ while (0)
 } while (0)
 
 #define CP_A(N) do { \
-	REGS(F) = 0; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(REGS(A), N); \
-	VF_CHECK_SUB(REGS(A), N, s8); \
-	CF_CHECK_SUB(REGS(A), N, u8); \
-	u8 res = REGS(A) - N; \
-	SF_CHECK(res); \
-	ZF_CHECK(res); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
+	u8 lhs = REGS(A), rhs = N; \
+	u32 res = lhs - rhs; \
+	SET_LAZY_FLAGS(FLAGS_CP, lhs, rhs, res, res > 0xFF); \
 } while (0)
 
 #define CP_A_R(R) do { \
@@ -837,14 +974,14 @@ while (0)
 
 #define CP_A_N() do { \
 	u8 n; \
-	READ(n, REGS(PC)++); \
+	READ_PC(n); \
 	CP_A(n); \
 } while (0)
 
 #define CP_A_DRR_E(RR) do { \
 	u8 e; \
-	READ(e, REGS(PC)++); \
-	cycleCount += 5; \
+	READ_PC(e); \
+	cyclesLeft -= 5; \
 	REGS(WZ) = REGS(RR) + SIGNED(e, s8); \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
@@ -852,7 +989,7 @@ while (0)
 } while (0)
 
 #define PUSH(R1, R2) do { \
-	++cycleCount; \
+	--cyclesLeft; \
 	WRITE(--REGS(SP), REGS(R1)); \
 	WRITE(--REGS(SP), REGS(R2)); \
 } while (0)
@@ -862,13 +999,23 @@ while (0)
 	READ(REGS(R1), REGS(SP)++); \
 } while (0)
 
+#define PUSH_AF() do { \
+	SYNC_FLAGS(); \
+	PUSH(A, F); \
+} while (0)
+
+#define POP_AF() do { \
+	DISCARD_FLAGS(); \
+	POP(A, F); \
+} while (0)
+
 #define RET() do { \
 	POP(PCH, PCL); \
 	REGS(WZ) = REGS(PC); \
 } while (0)
 
 #define RET_CC(CC) do { \
-	++cycleCount; \
+	--cyclesLeft; \
 	if (CC) { \
 		RET(); \
 	} \
@@ -876,18 +1023,22 @@ while (0)
 
 #define JP_CC_NN(CC) do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	REGS(WZ) = addr.Full; \
 	if (CC) { \
+		u16 branchEnd = REGS(PC); \
 		REGS(PC) = addr.Full; \
+		IDLE_LOOP_BRANCH(branchEnd); \
+	} else { \
+		IDLE_LOOP_FALLTHROUGH(); \
 	} \
 } while (0)
 
 #define CALL_CC_NN(CC) do { \
 	Addr_t addr; \
-	READ(addr.Low, REGS(PC)++); \
-	READ(addr.High, REGS(PC)++); \
+	READ_PC(addr.Low); \
+	READ_PC(addr.High); \
 	REGS(WZ) = addr.Full; \
 	if (CC) { \
 		PUSH(PCH, PCL); \
@@ -903,7 +1054,7 @@ while (0)
 
 #define IN_A_DN() do { \
 	u8 port; \
-	READ(port, REGS(PC)++); \
+	READ_PC(port); \
 	REGS(W) = REGS(A); \
 	REGS(Z) = port; \
 	++REGS(WZ); \
@@ -911,31 +1062,23 @@ while (0)
 } while (0)
 
 #define IN_R_DC(R) do { \
-	REGS(F) &= CF_BIT; \
+	bool carry = FLAG_CF(); \
 	REGS(WZ) = REGS(BC) + 1; \
 	IN(REGS(R), REGS(C)); \
-	SF_CHECK(REGS(R)); \
-	ZF_CHECK(REGS(R)); \
-	YF_CHECK(REGS(R)); \
-	XF_CHECK(REGS(R)); \
-	PF_CHECK(REGS(R)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, REGS(R), carry); \
 } while (0)
 
 #define IN_DC() do { \
-	REGS(F) &= CF_BIT; \
+	bool carry = FLAG_CF(); \
 	REGS(WZ) = REGS(BC) + 1; \
 	u8 temp; \
 	IN(temp, REGS(C)); \
-	SF_CHECK(temp); \
-	ZF_CHECK(temp); \
-	YF_CHECK(temp); \
-	XF_CHECK(temp); \
-	PF_CHECK(temp); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, temp, carry); \
 } while (0)
 
 #define OUT_DN_A() do { \
 	u8 port; \
-	READ(port, REGS(PC)++); \
+	READ_PC(port); \
 	REGS(W) = REGS(A); \
 	REGS(Z) = port + 1; \
 	OUT(port, REGS(A)); \
@@ -967,16 +1110,16 @@ while (0)
 	Addr_t temp; \
 	READ(temp.Low, REGS(SP)++); \
 	READ(temp.High, REGS(SP)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	WRITE(REGS(SP)--, REGS(R1)); \
 	WRITE(REGS(SP), REGS(R2)); \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
 	REGS(Z) = REGS(R2) = temp.Low; \
 	REGS(W) = REGS(R1) = temp.High; \
 } while (0)
 
 #define LD_SP_RR(RR) do { \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
 	REGS(SP) = REGS(RR); \
 } while (0)
 
@@ -986,25 +1129,27 @@ while (0)
 
 #define HALT() do { \
 	TI83->Halted = true; \
-	if (cycleCount < TI83->NextEventTime) { \
-		u64 inc = TI83->NextEventTime - cycleCount; \
+	if (cyclesLeft > 0) { \
+		u32 inc = cyclesLeft; \
 		inc += (-inc & 3); \
-		cycleCount += inc; \
-		REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + (inc >> 2)) & 0x7F); \
+		cyclesLeft -= inc; \
+		ADVANCE_R(inc >> 2); \
 	} \
 } while (0)
 
 #define DI() do { \
 	ScheduleEvent(TI83, INTERRUPT, EVENT_TIME_NEVER); \
+	SYNC_BUDGET(); \
 	TI83->IFF = false; \
 } while (0)
 
 #define EI() do { \
 	if (!TI83->IFF && (TI83->OnIntPending || TI83->TimerIntPending)) { \
-		ScheduleEvent(TI83, INTERRUPT, cycleCount + 1); \
-		if (cycleCount >= nextFrameCycleCount) { \
-			ScheduleEvent(TI83, END_FRAME, cycleCount + 2); \
+		ScheduleEvent(TI83, INTERRUPT, CYCLE_COUNT() + 1); \
+		if (CYCLE_COUNT() >= nextFrameCycleCount) { \
+			ScheduleEvent(TI83, END_FRAME, CYCLE_COUNT() + 2); \
 		} \
+		SYNC_BUDGET(); \
 	} \
 	TI83->IFF = true; \
 } while (0)
@@ -1014,31 +1159,16 @@ while (0)
 } while (0)
 
 #define NEG() do { \
-	REGS(F) = 0; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB((u8)0, REGS(A)); \
-	VF_CHECK_SUB(0, REGS(A), s8); \
-	CF_CHECK_SUB(0, REGS(A), u8); \
-	REGS(A) = -REGS(A); \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
+	u8 rhs = REGS(A); \
+	u32 res = 0 - rhs; \
+	REGS(A) = res; \
+	SET_LAZY_FLAGS(FLAGS_SUB, 0, rhs, res, res > 0xFF); \
 } while (0)
 
 #define RLC(N) do { \
-	REGS(F) = 0; \
 	bool carry = N & BIT(7); \
-	N <<= 1; \
-	if (carry) { \
-		N |= BIT(0); \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N << 1) | carry; \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define RLC_R(R) do { \
@@ -1048,7 +1178,7 @@ while (0)
 #define RLC_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RLC(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1056,7 +1186,7 @@ while (0)
 #define RLC_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RLC(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1064,25 +1194,16 @@ while (0)
 #define RLC_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RLC(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define RRC(N) do { \
-	REGS(F) = 0; \
 	bool carry = N & BIT(0); \
-	N >>= 1; \
-	if (carry) { \
-		N |= BIT(7); \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N >> 1) | (carry << 7); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define RRC_R(R) do { \
@@ -1092,7 +1213,7 @@ while (0)
 #define RRC_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RRC(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1100,7 +1221,7 @@ while (0)
 #define RRC_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RRC(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1108,28 +1229,17 @@ while (0)
 #define RRC_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RRC(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define RL(N) do { \
-	bool cf = REGS(F) & CF_BIT; \
-	REGS(F) = 0; \
+	bool cf = FLAG_CF(); \
 	bool carry = N & BIT(7); \
-	N <<= 1;\
-	if (cf) { \
-		N |= BIT(0); \
-	} \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N << 1) | cf; \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define RL_R(R) do { \
@@ -1139,7 +1249,7 @@ while (0)
 #define RL_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RL(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1147,7 +1257,7 @@ while (0)
 #define RL_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RL(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1155,28 +1265,17 @@ while (0)
 #define RL_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RL(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define RR(N) do { \
-	bool cf = REGS(F) & CF_BIT; \
-	REGS(F) = 0; \
+	bool cf = FLAG_CF(); \
 	bool carry = N & BIT(0); \
-	N >>= 1; \
-	if (cf) { \
-		N |= BIT(7); \
-	} \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N >> 1) | (cf << 7); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define RR_R(R) do { \
@@ -1186,7 +1285,7 @@ while (0)
 #define RR_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RR(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1194,7 +1293,7 @@ while (0)
 #define RR_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RR(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1202,24 +1301,16 @@ while (0)
 #define RR_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	RR(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define SLA(N) do { \
-	REGS(F) = 0; \
 	bool carry = N & BIT(7); \
 	N <<= 1; \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define SLA_R(R) do { \
@@ -1229,7 +1320,7 @@ while (0)
 #define SLA_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLA(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1237,7 +1328,7 @@ while (0)
 #define SLA_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLA(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1245,28 +1336,16 @@ while (0)
 #define SLA_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLA(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define SRA(N) do { \
-	REGS(F) = 0; \
-	bool bit7 = N & BIT(7); \
 	bool carry = N & BIT(0); \
-	N >>= 1; \
-	if (bit7) { \
-		N |= BIT(7); \
-	} \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N >> 1) | (N & BIT(7)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define SRA_R(R) do { \
@@ -1276,7 +1355,7 @@ while (0)
 #define SRA_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRA(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1284,7 +1363,7 @@ while (0)
 #define SRA_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRA(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1292,25 +1371,16 @@ while (0)
 #define SRA_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRA(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define SLL(N) do { \
-	REGS(F) = 0; \
 	bool carry = N & BIT(7); \
-	N <<= 1; \
-	N |= BIT(0); \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	N = (N << 1) | BIT(0); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define SLL_R(R) do { \
@@ -1320,7 +1390,7 @@ while (0)
 #define SLL_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLL(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1328,7 +1398,7 @@ while (0)
 #define SLL_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLL(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1336,24 +1406,16 @@ while (0)
 #define SLL_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SLL(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define SRL(N) do { \
-	REGS(F) = 0; \
 	bool carry = N & BIT(0); \
 	N >>= 1; \
-	if (carry) { \
-		REGS(F) |= CF_BIT; \
-	} \
-	SF_CHECK(N); \
-	ZF_CHECK(N); \
-	YF_CHECK(N); \
-	XF_CHECK(N); \
-	PF_CHECK(N); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, N, carry); \
 } while (0)
 
 #define SRL_R(R) do { \
@@ -1363,7 +1425,7 @@ while (0)
 #define SRL_DHL() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRL(dhl); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1371,7 +1433,7 @@ while (0)
 #define SRL_DRR_E() do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRL(drr); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1379,49 +1441,34 @@ while (0)
 #define SRL_DRR_E_R(R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	SRL(drr); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
 } while (0)
 
 #define BIT_N_R(N, R) do { \
+	SYNC_FLAGS(); \
 	u8 r = REGS(R) & BIT(N); \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= HF_BIT; \
-	SF_CHECK(r); \
-	ZF_CHECK(r); \
-	YF_CHECK(REGS(R)); \
-	XF_CHECK(REGS(R)); \
-	PF_CHECK(r); \
+	REGS(F) = (REGS(F) & CF_BIT) | HF_BIT | (SZYXPFlagsLUT[r] & (SF_BIT | ZF_BIT | PF_BIT)) | XY_FLAGS(REGS(R)); \
 } while (0)
 
 #define BIT_N_DHL(N) do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	dhl &= BIT(N); \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= HF_BIT; \
-	SF_CHECK(dhl); \
-	ZF_CHECK(dhl); \
-	YF_CHECK(REGS(W)); \
-	XF_CHECK(REGS(W)); \
-	PF_CHECK(dhl); \
+	SYNC_FLAGS(); \
+	REGS(F) = (REGS(F) & CF_BIT) | HF_BIT | (SZYXPFlagsLUT[dhl] & (SF_BIT | ZF_BIT | PF_BIT)) | XY_FLAGS(REGS(W)); \
 } while (0)
 
 #define BIT_N_DRR_E(N) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	drr &= BIT(N); \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= HF_BIT; \
-	SF_CHECK(drr); \
-	ZF_CHECK(drr); \
-	YF_CHECK(REGS(W)); \
-	XF_CHECK(REGS(W)); \
-	PF_CHECK(drr); \
+	SYNC_FLAGS(); \
+	REGS(F) = (REGS(F) & CF_BIT) | HF_BIT | (SZYXPFlagsLUT[drr] & (SF_BIT | ZF_BIT | PF_BIT)) | XY_FLAGS(REGS(W)); \
 } while (0)
 
 #define RES_N_R(N, R) do { \
@@ -1431,7 +1478,7 @@ while (0)
 #define RES_N_DHL(N) do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	dhl &= ~BIT(N); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1439,7 +1486,7 @@ while (0)
 #define RES_N_DRR_E(N) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	drr &= ~BIT(N); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1447,7 +1494,7 @@ while (0)
 #define RES_N_DRR_E_R(N, R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	drr &= ~BIT(N); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
@@ -1460,7 +1507,7 @@ while (0)
 #define SET_N_DHL(N) do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	dhl |= BIT(N); \
 	WRITE(REGS(HL), dhl); \
 } while (0)
@@ -1468,7 +1515,7 @@ while (0)
 #define SET_N_DRR_E(N) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	drr |= BIT(N); \
 	WRITE(REGS(WZ), drr); \
 } while (0)
@@ -1476,7 +1523,7 @@ while (0)
 #define SET_N_DRR_E_R(N, R) do { \
 	u8 drr; \
 	READ(drr, REGS(WZ)); \
-	++cycleCount; \
+	--cyclesLeft; \
 	drr |= BIT(N); \
 	WRITE(REGS(WZ), drr); \
 	REGS(R) = drr; \
@@ -1485,61 +1532,60 @@ while (0)
 #define RRD() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	cycleCount += 4; \
-	REGS(F) &= CF_BIT; \
+	cyclesLeft -= 4; \
+	bool carry = FLAG_CF(); \
 	u8 temp = REGS(A); \
 	REGS(A) = (temp & 0xF0) | (dhl & 0x0F); \
 	dhl = (temp << 4) | (dhl >> 4); \
 	WRITE(REGS(HL), dhl); \
 	REGS(WZ) = REGS(HL) + 1; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
-	PF_CHECK(REGS(A)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, REGS(A), carry); \
 } while (0)
 
 #define RLD() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	cycleCount += 4; \
-	REGS(F) &= CF_BIT; \
+	cyclesLeft -= 4; \
+	bool carry = FLAG_CF(); \
 	u8 temp = REGS(A); \
 	REGS(A) = (REGS(A) & 0xF0) | (dhl >> 4); \
 	dhl = (dhl << 4) | (temp & 0x0F); \
 	WRITE(REGS(HL), dhl); \
 	REGS(WZ) = REGS(HL) + 1; \
-	SF_CHECK(REGS(A)); \
-	ZF_CHECK(REGS(A)); \
-	YF_CHECK(REGS(A)); \
-	XF_CHECK(REGS(A)); \
-	PF_CHECK(REGS(A)); \
+	SET_LAZY_LOGIC_FLAGS(FLAGS_LOGIC, REGS(A), carry); \
 } while (0)
 
 #define LDI() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
 	WRITE(REGS(DE), dhl); \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | CF_BIT; \
 	u8 n = dhl + REGS(A); \
 	++REGS(HL); \
 	++REGS(DE); \
-	if (n & BIT(1)) { \
-		REGS(F) |= YF_BIT; \
-	} \
-	XF_CHECK(n); \
+	BLOCK_XY_CHECK(n); \
 	if (--REGS(BC)) { \
 		REGS(F) |= PF_BIT; \
 	} \
 } while (0)
 
+// runs the repeats left before the next event in one go (see RepeatBlockCopy)
+#define REPEAT_BLOCK(FN, DEC) do { \
+	SPILL_REGS(); \
+	cyclesLeft -= FN(TI83, CYCLE_COUNT(), DEC); \
+	RELOAD_REGS(); \
+	SYNC_BUDGET(); \
+} while (0)
+
 #define LDIR() do { \
 	LDI(); \
 	if (REGS(BC)) { \
 		REGS(PC) -= 2; \
 		REGS(WZ) = REGS(PC) + 1; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockCopy, false); \
 	} \
 } while (0)
 
@@ -1547,15 +1593,13 @@ while (0)
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
 	WRITE(REGS(DE), dhl); \
-	cycleCount += 2; \
+	cyclesLeft -= 2; \
+	SYNC_FLAGS(); \
 	REGS(F) &= SF_BIT | ZF_BIT | CF_BIT; \
 	u8 n = dhl + REGS(A); \
 	--REGS(HL); \
 	--REGS(DE); \
-	if (n & BIT(1)) { \
-		REGS(F) |= YF_BIT; \
-	} \
-	XF_CHECK(n); \
+	BLOCK_XY_CHECK(n); \
 	if (--REGS(BC)) { \
 		REGS(F) |= PF_BIT; \
 	} \
@@ -1566,29 +1610,24 @@ while (0)
 	if (REGS(BC)) { \
 		REGS(PC) -= 2; \
 		REGS(WZ) = REGS(PC) + 1; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockCopy, true); \
 	} \
 } while (0)
 
 #define CPI() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	cycleCount += 5; \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(REGS(A), dhl); \
+	cyclesLeft -= 5; \
+	SYNC_FLAGS(); \
 	u8 res = REGS(A) - dhl; \
-	SF_CHECK(res); \
-	ZF_CHECK(res); \
+	REGS(F) = (REGS(F) & CF_BIT) | NF_BIT | (SZYXFlagsLUT[res] & (SF_BIT | ZF_BIT)) | HF_SUB(HV_INDEX(REGS(A), dhl, res)); \
 	++REGS(HL); \
 	++REGS(WZ); \
 	if (REGS(F) & HF_BIT) { \
 		--res; \
 	} \
-	if (res & BIT(1)) { \
-		REGS(F) |= YF_BIT; \
-	} \
-	XF_CHECK(res); \
+	BLOCK_XY_CHECK(res); \
 	if (--REGS(BC)) { \
 		REGS(F) |= PF_BIT; \
 	} \
@@ -1599,29 +1638,24 @@ while (0)
 	if (!(REGS(F) & ZF_BIT) && REGS(BC)) { \
 		REGS(PC) -= 2; \
 		REGS(WZ) = REGS(PC) + 2; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockCompare, false); \
 	} \
 } while (0)
 
 #define CPD() do { \
 	u8 dhl; \
 	READ(dhl, REGS(HL)); \
-	cycleCount += 5; \
-	REGS(F) &= CF_BIT; \
-	REGS(F) |= NF_BIT; \
-	HF_CHECK_SUB(REGS(A), dhl); \
+	cyclesLeft -= 5; \
+	SYNC_FLAGS(); \
 	u8 res = REGS(A) - dhl; \
-	SF_CHECK(res); \
-	ZF_CHECK(res); \
+	REGS(F) = (REGS(F) & CF_BIT) | NF_BIT | (SZYXFlagsLUT[res] & (SF_BIT | ZF_BIT)) | HF_SUB(HV_INDEX(REGS(A), dhl, res)); \
 	--REGS(HL); \
 	--REGS(WZ); \
 	if (REGS(F) & HF_BIT) { \
 		--res; \
 	} \
-	if (res & BIT(1)) { \
-		REGS(F) |= YF_BIT; \
-	} \
-	XF_CHECK(res); \
+	BLOCK_XY_CHECK(res); \
 	if (--REGS(BC)) { \
 		REGS(F) |= PF_BIT; \
 	} \
@@ -1632,15 +1666,17 @@ while (0)
 	if (!(REGS(F) & ZF_BIT) && REGS(BC)) { \
 		REGS(PC) -= 2; \
 		REGS(WZ) = REGS(PC); \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockCompare, true); \
 	} \
 } while (0)
 
 #define INI() do { \
 	u8 dc; \
-	++cycleCount; \
+	--cyclesLeft; \
 	IN(dc, REGS(C)); \
 	WRITE(REGS(HL), dc); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	if (dc & BIT(7)) { \
 		REGS(F) |= NF_BIT; \
@@ -1652,10 +1688,7 @@ while (0)
 		REGS(F) |= HF_BIT; \
 		REGS(F) |= CF_BIT; \
 	} \
-	SF_CHECK(REGS(B)); \
-	ZF_CHECK(REGS(B)); \
-	YF_CHECK(REGS(B)); \
-	XF_CHECK(REGS(B)); \
+	REGS(F) |= SZYXFlagsLUT[REGS(B)]; \
 	PF_CHECK(((dc + ((REGS(C) + 1) & 0xFF)) & 0x07) ^ REGS(B)); \
 } while (0)
 
@@ -1663,15 +1696,17 @@ while (0)
 	INI(); \
 	if (REGS(B)) { \
 		REGS(PC) -= 2; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockIn, false); \
 	} \
 } while (0)
 
 #define IND() do { \
 	u8 dc; \
-	++cycleCount; \
+	--cyclesLeft; \
 	IN(dc, REGS(C)); \
 	WRITE(REGS(HL), dc); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	if (dc & BIT(7)) { \
 		REGS(F) |= NF_BIT; \
@@ -1683,10 +1718,7 @@ while (0)
 		REGS(F) |= HF_BIT; \
 		REGS(F) |= CF_BIT; \
 	} \
-	SF_CHECK(REGS(B)); \
-	ZF_CHECK(REGS(B)); \
-	YF_CHECK(REGS(B)); \
-	XF_CHECK(REGS(B)); \
+	REGS(F) |= SZYXFlagsLUT[REGS(B)]; \
 	PF_CHECK(((dc + ((REGS(C) - 1) & 0xFF)) & 0x07) ^ REGS(B)); \
 } while (0)
 
@@ -1694,15 +1726,17 @@ while (0)
 	INI(); \
 	if (REGS(B)) { \
 		REGS(PC) -= 2; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockIn, false); \
 	} \
 } while (0)
 
 #define OUTI() do { \
 	u8 dhl; \
-	++cycleCount; \
+	--cyclesLeft; \
 	READ(dhl, REGS(HL)); \
 	OUT(REGS(C), dhl); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	if (dhl & BIT(7)) { \
 		REGS(F) |= NF_BIT; \
@@ -1714,10 +1748,7 @@ while (0)
 		REGS(F) |= HF_BIT; \
 		REGS(F) |= CF_BIT; \
 	} \
-	SF_CHECK(REGS(B)); \
-	ZF_CHECK(REGS(B)); \
-	YF_CHECK(REGS(B)); \
-	XF_CHECK(REGS(B)); \
+	REGS(F) |= SZYXFlagsLUT[REGS(B)]; \
 	PF_CHECK(((dhl + REGS(L)) & 0x07) ^ REGS(B)); \
 } while (0)
 
@@ -1725,15 +1756,17 @@ while (0)
 	OUTI(); \
 	if (REGS(B)) { \
 		REGS(PC) -= 2; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockOut, false); \
 	} \
 } while (0)
 
 #define OUTD() do { \
 	u8 dhl; \
-	++cycleCount; \
+	--cyclesLeft; \
 	READ(dhl, REGS(HL)); \
 	OUT(REGS(C), dhl); \
+	DISCARD_FLAGS(); \
 	REGS(F) = 0; \
 	if (dhl & BIT(7)) { \
 		REGS(F) |= NF_BIT; \
@@ -1745,10 +1778,7 @@ while (0)
 		REGS(F) |= HF_BIT; \
 		REGS(F) |= CF_BIT; \
 	} \
-	SF_CHECK(REGS(B)); \
-	ZF_CHECK(REGS(B)); \
-	YF_CHECK(REGS(B)); \
-	XF_CHECK(REGS(B)); \
+	REGS(F) |= SZYXFlagsLUT[REGS(B)]; \
 	PF_CHECK(((dhl + REGS(L)) & 0x07) ^ REGS(B)); \
 } while (0)
 
@@ -1756,7 +1786,8 @@ while (0)
 	OUTD(); \
 	if (REGS(B)) { \
 		REGS(PC) -= 2; \
-		cycleCount += 5; \
+		cyclesLeft -= 5; \
+		REPEAT_BLOCK(RepeatBlockOut, true); \
 	} \
 } while (0)
 
@@ -1767,13 +1798,121 @@ while (0)
 
 #define REPEAT_PREFIX() do { \
 	--REGS(PC); \
-	cycleCount -= 4; \
-	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) - 1) & 0x7F); \
-	if (cycleCount >= TI83->EventSchedule[INTERRUPT]) { \
-		ScheduleEvent(TI83, INTERRUPT, cycleCount + 1); \
+	cyclesLeft += 4; \
+	ADVANCE_R(-1); \
+	if (CYCLE_COUNT() >= TI83->EventSchedule[INTERRUPT]) { \
+		ScheduleEvent(TI83, INTERRUPT, CYCLE_COUNT() + 1); \
+		SYNC_BUDGET(); \
 	} \
 } while (0)
 
+// on GCC/Clang, opcode handlers dispatch the next opcode themselves through a label table (computed goto)
+// this gives every handler its own indirect branch, which predicts far better than the single switch branch
+// the switch is still used for the first opcode after an event, and is the only dispatch on other compilers
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(EMU83_NO_THREADED_DISPATCH)
+	#define THREADED_DISPATCH
+#endif
+
+#ifdef THREADED_DISPATCH
+	#define OPCODE(N) case N: op_##N
+
+	#define NEXT_OPCODE() do { \
+		if (UNLIKELY(cyclesLeft <= 0)) { \
+			goto event; \
+		} \
+		CHECK_BREAKPOINT(); \
+		if (TRACE_CALLBACK && UNLIKELY(TI83->TraceCallback)) { \
+			SPILL_REGS(); \
+			TI83->TraceCallback(TI83->CallbackUserdata, CYCLE_COUNT()); \
+			SYNC_BUDGET(); \
+		} \
+		const DecodedOp_t* decoded = &TI83->DecodePtrs[REGS(PC) >> 14][REGS(PC)]; \
+		if (LIKELY(decoded->Kind == DECODE_UNPREFIXED)) { \
+			ADVANCE_R(1); \
+			cyclesLeft -= 4; \
+			++REGS(PC); \
+			opcode = decoded->Opcode; \
+			operand = decoded->Operand; \
+			goto *OpcodeTable[opcode]; \
+		} \
+		if (!MEMORY_CALLBACKS && decoded->Kind >= DECODE_FUSED && cyclesLeft > FusedOps[decoded->Kind - DECODE_FUSED].Lead) { \
+			ADVANCE_R(1); \
+			cyclesLeft -= 4; \
+			++REGS(PC); \
+			operand = decoded->Operand; \
+			goto *FusedTable[decoded->Kind - DECODE_FUSED]; \
+		} \
+		goto fetch; \
+	} while (0)
+
+	// superinstructions run a few instructions in one handler, with FUSED_NEXT() fetching the next one in place of NEXT_OPCODE()
+	// all of them come from ROM, so their operands can be read in place
+	#define FUSED_OP(N) fused_##N
+
+	#define FUSED_NEXT() do { \
+		ADVANCE_R(1); \
+		cyclesLeft -= 4; \
+		++REGS(PC); \
+		operand = &TI83->ReadPtrs[REGS(PC) >> 14][REGS(PC)]; \
+	} while (0)
+
+	#define OPCODE_ROW(H) \
+		&&op_0x##H##0, &&op_0x##H##1, &&op_0x##H##2, &&op_0x##H##3, \
+		&&op_0x##H##4, &&op_0x##H##5, &&op_0x##H##6, &&op_0x##H##7, \
+		&&op_0x##H##8, &&op_0x##H##9, &&op_0x##H##A, &&op_0x##H##B, \
+		&&op_0x##H##C, &&op_0x##H##D, &&op_0x##H##E, &&op_0x##H##F
+#else
+	#define OPCODE(N) case N
+
+	#define NEXT_OPCODE() break
+#endif
+
+// instructions are decoded once (see DecodedOp_t), then executed without refetching the opcode or prefix
+// READ_PC takes the operands from the decoded copy, so instructions with bytes watched by the read or execute callback aren't decoded
+// ROM can't be written, RAM pages drop their decoded instructions when written (see WriteMem)
+// with threaded dispatch, handlers only inline the common case (unprefixed, no callbacks), the rest goes through FETCH_OPCODE
+// which is also where the JIT gets to run, as block starts are marked DECODE_BLOCK and decode misses are compile attempts
+
+#ifdef THREADED_DISPATCH
+	#define DISPATCH_PREFIX(KIND) goto *PrefixTable[KIND]
+#else
+	#define DISPATCH_PREFIX(KIND) do { \
+		switch (KIND) { \
+			case DECODE_CB: goto cb_dispatch; \
+			case DECODE_DD: goto dd_dispatch; \
+			case DECODE_ED: goto ed_dispatch; \
+			case DECODE_FD: goto fd_dispatch; \
+			default: UNREACHABLE(); \
+		} \
+	} while (0)
+#endif
+
+#define FETCH_OPCODE() do { \
+	operand = NULL; \
+	const DecodedOp_t* decoded = &TI83->DecodePtrs[REGS(PC) >> 14][REGS(PC)]; \
+	if (UNLIKELY(decoded->Kind == DECODE_NONE)) { \
+		DecodeOp(TI83, REGS(PC)); \
+	} \
+	if (LIKELY(decoded->Kind == DECODE_UNPREFIXED || decoded->Kind >= DECODE_BLOCK)) { \
+		ADVANCE_R(1); \
+		cyclesLeft -= 4; \
+		++REGS(PC); \
+		opcode = decoded->Opcode; \
+		operand = decoded->Operand; \
+		break; \
+	} \
+	if (decoded->Kind != DECODE_UNCACHEABLE) { \
+		ADVANCE_R(2); \
+		cyclesLeft -= 8; \
+		REGS(PC) += 2; \
+		opcode = decoded->Opcode; \
+		operand = decoded->Operand; \
+		DISPATCH_PREFIX(decoded->Kind); \
+	} \
+	FETCH(opcode, REGS(PC)++); \
+} while (0)
+
 typedef union {
 	u16 Full;
 	struct {
@@ -1782,3943 +1921,722 @@ typedef union {
 	};
 } Addr_t;
 
-static bool ParityLUT[256] = {
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	false, true, true, false, true, false, false, true, true, false, false, true, false, true, true, false,
-	true, false, false, true, false, true, true, false, false, true, true, false, true, false, false, true,
+// S, Z, Y, and X flags (and P for the second table) for every 8-bit result
+static const u8 SZYXFlagsLUT[256] = {
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+	0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+	0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
 };
 
-static u16 DaaLUT[65536] = {
-	0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0044, 0x6025, 0x0046, 0xA0A7, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F, 0x0604, 0x6625, 0xFABE, 0x9A9F,
-	0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0100, 0x6121, 0x0102, 0xA1A3, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B, 0x0700, 0x6721, 0xFBBA, 0x9B9B,
-	0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0200, 0x6221, 0x0202, 0xA2A3, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F, 0x0808, 0x6829, 0xFCBE, 0x9C9F,
-	0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x0304, 0x6325, 0x0306, 0xA3A7, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B, 0x090C, 0x692D, 0xFDBA, 0x9D9B,
-	0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0400, 0x6421, 0x0402, 0xA4A3, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B, 0x0A0C, 0x6A2D, 0xFEBA, 0x9E9B,
-	0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0504, 0x6525, 0x0506, 0xA5A7, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F, 0x0B08, 0x6B29, 0xFFBE, 0x9F9F,
-	0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0604, 0x6625, 0x0606, 0xA6A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7, 0x0C0C, 0x6C2D, 0x0046, 0xA0A7,
-	0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0700, 0x6721, 0x0702, 0xA7A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3, 0x0D08, 0x6D29, 0x0102, 0xA1A3,
-	0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0808, 0x6829, 0x080A, 0xA8AB, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3, 0x0E08, 0x6E29, 0x0202, 0xA2A3,
-	0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x090C, 0x692D, 0x090E, 0xA9AF, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7, 0x0F0C, 0x6F2D, 0x0306, 0xA3A7,
-	0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3, 0x1010, 0x7031, 0x0402, 0xA4A3,
-	0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7, 0x1114, 0x7135, 0x0506, 0xA5A7,
-	0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7, 0x1214, 0x7235, 0x0606, 0xA6A7,
-	0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3, 0x1310, 0x7331, 0x0702, 0xA7A3,
-	0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB, 0x1414, 0x7435, 0x080A, 0xA8AB,
-	0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF, 0x1510, 0x7531, 0x090E, 0xA9AF,
-	0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1000, 0x7021, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF, 0x1600, 0x7621, 0x0A1E, 0xAABF,
-	0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1104, 0x7125, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB, 0x1704, 0x7725, 0x0B1A, 0xABBB,
-	0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x1204, 0x7225, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF, 0x180C, 0x782D, 0x0C1E, 0xACBF,
-	0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1300, 0x7321, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB, 0x1908, 0x7929, 0x0D1A, 0xADBB,
-	0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1404, 0x7425, 0x1406, 0xB4A7, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB, 0x1A08, 0x7A29, 0x0E1A, 0xAEBB,
-	0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1500, 0x7521, 0x1502, 0xB5A3, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF, 0x1B0C, 0x7B2D, 0x0F1E, 0xAFBF,
-	0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1600, 0x7621, 0x1602, 0xB6A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3, 0x1C08, 0x7C29, 0x1002, 0xB0A3,
-	0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1704, 0x7725, 0x1706, 0xB7A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7, 0x1D0C, 0x7D2D, 0x1106, 0xB1A7,
-	0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x180C, 0x782D, 0x180E, 0xB8AF, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7, 0x1E0C, 0x7E2D, 0x1206, 0xB2A7,
-	0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1908, 0x7929, 0x190A, 0xB9AB, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3, 0x1F08, 0x7F29, 0x1302, 0xB3A3,
-	0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7, 0x2030, 0x8091, 0x1406, 0xB4A7,
-	0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3, 0x2134, 0x8195, 0x1502, 0xB5A3,
-	0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3, 0x2234, 0x8295, 0x1602, 0xB6A3,
-	0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7, 0x2330, 0x8391, 0x1706, 0xB7A7,
-	0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF, 0x2434, 0x8495, 0x180E, 0xB8AF,
-	0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB, 0x2530, 0x8591, 0x190A, 0xB9AB,
-	0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2020, 0x8081, 0x2022, 0xC087, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB, 0x2620, 0x8681, 0x1A1A, 0xBABB,
-	0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2124, 0x8185, 0x2126, 0xC183, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF, 0x2724, 0x8785, 0x1B1E, 0xBBBF,
-	0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x2224, 0x8285, 0x2226, 0xC283, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB, 0x282C, 0x888D, 0x1C1A, 0xBCBB,
-	0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2320, 0x8381, 0x2322, 0xC387, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF, 0x2928, 0x8989, 0x1D1E, 0xBDBF,
-	0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2424, 0x8485, 0x2426, 0xC483, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF, 0x2A28, 0x8A89, 0x1E1E, 0xBEBF,
-	0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2520, 0x8581, 0x2522, 0xC587, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB, 0x2B2C, 0x8B8D, 0x1F1A, 0xBFBB,
-	0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2620, 0x8681, 0x2622, 0xC687, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087, 0x2C28, 0x8C89, 0x2022, 0xC087,
-	0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2724, 0x8785, 0x2726, 0xC783, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183, 0x2D2C, 0x8D8D, 0x2126, 0xC183,
-	0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x282C, 0x888D, 0x282E, 0xC88B, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283, 0x2E2C, 0x8E8D, 0x2226, 0xC283,
-	0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2928, 0x8989, 0x292A, 0xC98F, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387, 0x2F28, 0x8F89, 0x2322, 0xC387,
-	0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483, 0x3034, 0x9095, 0x2426, 0xC483,
-	0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587, 0x3130, 0x9191, 0x2522, 0xC587,
-	0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687, 0x3230, 0x9291, 0x2622, 0xC687,
-	0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783, 0x3334, 0x9395, 0x2726, 0xC783,
-	0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B, 0x3430, 0x9491, 0x282E, 0xC88B,
-	0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F, 0x3534, 0x9595, 0x292A, 0xC98F,
-	0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3024, 0x9085, 0x3026, 0xD083, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F, 0x3624, 0x9685, 0x2A3A, 0xCA9F,
-	0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3120, 0x9181, 0x3122, 0xD187, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B, 0x3720, 0x9781, 0x2B3E, 0xCB9B,
-	0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3220, 0x9281, 0x3222, 0xD287, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F, 0x3828, 0x9889, 0x2C3A, 0xCC9F,
-	0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x3324, 0x9385, 0x3326, 0xD383, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B, 0x392C, 0x998D, 0x2D3E, 0xCD9B,
-	0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3420, 0x9481, 0x3422, 0xD487, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B, 0x3A2C, 0x9A8D, 0x2E3E, 0xCE9B,
-	0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3524, 0x9585, 0x3526, 0xD583, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F, 0x3B28, 0x9B89, 0x2F3A, 0xCF9F,
-	0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3624, 0x9685, 0x3626, 0xD683, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083, 0x3C2C, 0x9C8D, 0x3026, 0xD083,
-	0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3720, 0x9781, 0x3722, 0xD787, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187, 0x3D28, 0x9D89, 0x3122, 0xD187,
-	0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3828, 0x9889, 0x382A, 0xD88F, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287, 0x3E28, 0x9E89, 0x3222, 0xD287,
-	0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x392C, 0x998D, 0x392E, 0xD98B, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383, 0x3F2C, 0x9F8D, 0x3326, 0xD383,
-	0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487, 0x4010, 0xA0B5, 0x3422, 0xD487,
-	0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583, 0x4114, 0xA1B1, 0x3526, 0xD583,
-	0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683, 0x4214, 0xA2B1, 0x3626, 0xD683,
-	0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787, 0x4310, 0xA3B5, 0x3722, 0xD787,
-	0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F, 0x4414, 0xA4B1, 0x382A, 0xD88F,
-	0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B, 0x4510, 0xA5B5, 0x392E, 0xD98B,
-	0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4000, 0xA0A5, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B, 0x4600, 0xA6A5, 0x3A3E, 0xDA9B,
-	0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4104, 0xA1A1, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F, 0x4704, 0xA7A1, 0x3B3A, 0xDB9F,
-	0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x4204, 0xA2A1, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B, 0x480C, 0xA8A9, 0x3C3E, 0xDC9B,
-	0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4300, 0xA3A5, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F, 0x4908, 0xA9AD, 0x3D3A, 0xDD9F,
-	0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4404, 0xA4A1, 0x4406, 0xE4A7, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F, 0x4A08, 0xAAAD, 0x3E3A, 0xDE9F,
-	0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4500, 0xA5A5, 0x4502, 0xE5A3, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B, 0x4B0C, 0xABA9, 0x3F3E, 0xDF9B,
-	0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4600, 0xA6A5, 0x4602, 0xE6A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3, 0x4C08, 0xACAD, 0x4002, 0xE0A3,
-	0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4704, 0xA7A1, 0x4706, 0xE7A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7, 0x4D0C, 0xADA9, 0x4106, 0xE1A7,
-	0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x480C, 0xA8A9, 0x480E, 0xE8AF, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7, 0x4E0C, 0xAEA9, 0x4206, 0xE2A7,
-	0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4908, 0xA9AD, 0x490A, 0xE9AB, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3, 0x4F08, 0xAFAD, 0x4302, 0xE3A3,
-	0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7, 0x5014, 0xB0B1, 0x4406, 0xE4A7,
-	0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3, 0x5110, 0xB1B5, 0x4502, 0xE5A3,
-	0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3, 0x5210, 0xB2B5, 0x4602, 0xE6A3,
-	0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7, 0x5314, 0xB3B1, 0x4706, 0xE7A7,
-	0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF, 0x5410, 0xB4B5, 0x480E, 0xE8AF,
-	0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB, 0x5514, 0xB5B1, 0x490A, 0xE9AB,
-	0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5004, 0xB0A1, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB, 0x5604, 0xB6A1, 0x4A1A, 0xEABB,
-	0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5100, 0xB1A5, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF, 0x5700, 0xB7A5, 0x4B1E, 0xEBBF,
-	0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5200, 0xB2A5, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB, 0x5808, 0xB8AD, 0x4C1A, 0xECBB,
-	0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x5304, 0xB3A1, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF, 0x590C, 0xB9A9, 0x4D1E, 0xEDBF,
-	0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5400, 0xB4A5, 0x5402, 0xF4A3, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF, 0x5A0C, 0xBAA9, 0x4E1E, 0xEEBF,
-	0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5504, 0xB5A1, 0x5506, 0xF5A7, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB, 0x5B08, 0xBBAD, 0x4F1A, 0xEFBB,
-	0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5604, 0xB6A1, 0x5606, 0xF6A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7, 0x5C0C, 0xBCA9, 0x5006, 0xF0A7,
-	0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5700, 0xB7A5, 0x5702, 0xF7A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3, 0x5D08, 0xBDAD, 0x5102, 0xF1A3,
-	0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5808, 0xB8AD, 0x580A, 0xF8AB, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3, 0x5E08, 0xBEAD, 0x5202, 0xF2A3,
-	0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x590C, 0xB9A9, 0x590E, 0xF9AF, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7, 0x5F0C, 0xBFA9, 0x5306, 0xF3A7,
-	0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3, 0x6034, 0xC095, 0x5402, 0xF4A3,
-	0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7, 0x6130, 0xC191, 0x5506, 0xF5A7,
-	0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7, 0x6230, 0xC291, 0x5606, 0xF6A7,
-	0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3, 0x6334, 0xC395, 0x5702, 0xF7A3,
-	0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB, 0x6430, 0xC491, 0x580A, 0xF8AB,
-	0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF, 0x6534, 0xC595, 0x590E, 0xF9AF,
-	0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6024, 0xC085, 0x6026, 0x0047, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF, 0x6624, 0xC685, 0x5A1E, 0xFABF,
-	0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6120, 0xC181, 0x6122, 0x0103, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB, 0x6720, 0xC781, 0x5B1A, 0xFBBB,
-	0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6220, 0xC281, 0x6222, 0x0203, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF, 0x6828, 0xC889, 0x5C1E, 0xFCBF,
-	0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x6324, 0xC385, 0x6326, 0x0307, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB, 0x692C, 0xC98D, 0x5D1A, 0xFDBB,
-	0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6420, 0xC481, 0x6422, 0x0403, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB, 0x6A2C, 0xCA8D, 0x5E1A, 0xFEBB,
-	0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6524, 0xC585, 0x6526, 0x0507, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF, 0x6B28, 0xCB89, 0x5F1E, 0xFFBF,
-	0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6624, 0xC685, 0x6626, 0x0607, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047, 0x6C2C, 0xCC8D, 0x6026, 0x0047,
-	0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6720, 0xC781, 0x6722, 0x0703, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103, 0x6D28, 0xCD89, 0x6122, 0x0103,
-	0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6828, 0xC889, 0x682A, 0x080B, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203, 0x6E28, 0xCE89, 0x6222, 0x0203,
-	0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x692C, 0xC98D, 0x692E, 0x090F, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307, 0x6F2C, 0xCF8D, 0x6326, 0x0307,
-	0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403, 0x7030, 0xD091, 0x6422, 0x0403,
-	0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507, 0x7134, 0xD195, 0x6526, 0x0507,
-	0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607, 0x7234, 0xD295, 0x6626, 0x0607,
-	0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703, 0x7330, 0xD391, 0x6722, 0x0703,
-	0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B, 0x7434, 0xD495, 0x682A, 0x080B,
-	0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F, 0x7530, 0xD591, 0x692E, 0x090F,
-	0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7020, 0xD081, 0x7022, 0x1003, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F, 0x7620, 0xD681, 0x6A3E, 0x0A1F,
-	0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7124, 0xD185, 0x7126, 0x1107, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B, 0x7724, 0xD785, 0x6B3A, 0x0B1B,
-	0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x7224, 0xD285, 0x7226, 0x1207, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F, 0x782C, 0xD88D, 0x6C3E, 0x0C1F,
-	0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7320, 0xD381, 0x7322, 0x1303, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B, 0x7928, 0xD989, 0x6D3A, 0x0D1B,
-	0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7424, 0xD485, 0x7426, 0x1407, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B, 0x7A28, 0xDA89, 0x6E3A, 0x0E1B,
-	0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7520, 0xD581, 0x7522, 0x1503, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F, 0x7B2C, 0xDB8D, 0x6F3E, 0x0F1F,
-	0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7620, 0xD681, 0x7622, 0x1603, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003, 0x7C28, 0xDC89, 0x7022, 0x1003,
-	0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7724, 0xD785, 0x7726, 0x1707, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107, 0x7D2C, 0xDD8D, 0x7126, 0x1107,
-	0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x782C, 0xD88D, 0x782E, 0x180F, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207, 0x7E2C, 0xDE8D, 0x7226, 0x1207,
-	0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7928, 0xD989, 0x792A, 0x190B, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303, 0x7F28, 0xDF89, 0x7322, 0x1303,
-	0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407, 0x8090, 0xE0B1, 0x7426, 0x1407,
-	0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503, 0x8194, 0xE1B5, 0x7522, 0x1503,
-	0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603, 0x8294, 0xE2B5, 0x7622, 0x1603,
-	0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707, 0x8390, 0xE3B1, 0x7726, 0x1707,
-	0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F, 0x8494, 0xE4B5, 0x782E, 0x180F,
-	0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B, 0x8590, 0xE5B1, 0x792A, 0x190B,
-	0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8080, 0xE0A1, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B, 0x8680, 0xE6A1, 0x7A3A, 0x1A1B,
-	0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8184, 0xE1A5, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F, 0x8784, 0xE7A5, 0x7B3E, 0x1B1F,
-	0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x8284, 0xE2A5, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B, 0x888C, 0xE8AD, 0x7C3A, 0x1C1B,
-	0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8380, 0xE3A1, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F, 0x8988, 0xE9A9, 0x7D3E, 0x1D1F,
-	0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8484, 0xE4A5, 0x8486, 0x2427, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F, 0x8A88, 0xEAA9, 0x7E3E, 0x1E1F,
-	0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8580, 0xE5A1, 0x8582, 0x2523, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B, 0x8B8C, 0xEBAD, 0x7F3A, 0x1F1B,
-	0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8680, 0xE6A1, 0x8682, 0x2623, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023, 0x8C88, 0xECA9, 0x8082, 0x2023,
-	0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8784, 0xE7A5, 0x8786, 0x2727, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127, 0x8D8C, 0xEDAD, 0x8186, 0x2127,
-	0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x888C, 0xE8AD, 0x888E, 0x282F, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227, 0x8E8C, 0xEEAD, 0x8286, 0x2227,
-	0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8988, 0xE9A9, 0x898A, 0x292B, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323, 0x8F88, 0xEFA9, 0x8382, 0x2323,
-	0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427, 0x9094, 0xF0B5, 0x8486, 0x2427,
-	0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523, 0x9190, 0xF1B1, 0x8582, 0x2523,
-	0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623, 0x9290, 0xF2B1, 0x8682, 0x2623,
-	0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727, 0x9394, 0xF3B5, 0x8786, 0x2727,
-	0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F, 0x9490, 0xF4B1, 0x888E, 0x282F,
-	0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B, 0x9594, 0xF5B5, 0x898A, 0x292B,
-	0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9084, 0xF0A5, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B, 0x9684, 0xF6A5, 0x8A9A, 0x2A3B,
-	0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9180, 0xF1A1, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F, 0x9780, 0xF7A1, 0x8B9E, 0x2B3F,
-	0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9280, 0xF2A1, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B, 0x9888, 0xF8A9, 0x8C9A, 0x2C3B,
-	0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x9384, 0xF3A5, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F, 0x998C, 0xF9AD, 0x8D9E, 0x2D3F,
-	0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9480, 0xF4A1, 0x9482, 0x3423, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F, 0x9A8C, 0xFAAD, 0x8E9E, 0x2E3F,
-	0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9584, 0xF5A5, 0x9586, 0x3527, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B, 0x9B88, 0xFBA9, 0x8F9A, 0x2F3B,
-	0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9684, 0xF6A5, 0x9686, 0x3627, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027, 0x9C8C, 0xFCAD, 0x9086, 0x3027,
-	0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9780, 0xF7A1, 0x9782, 0x3723, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123, 0x9D88, 0xFDA9, 0x9182, 0x3123,
-	0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9888, 0xF8A9, 0x988A, 0x382B, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223, 0x9E88, 0xFEA9, 0x9282, 0x3223,
-	0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x998C, 0xF9AD, 0x998E, 0x392F, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327, 0x9F8C, 0xFFAD, 0x9386, 0x3327,
-	0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423, 0x0055, 0x0055, 0x3423, 0x3423,
-	0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527, 0x0111, 0x0111, 0x3527, 0x3527,
-	0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627, 0x0211, 0x0211, 0x3627, 0x3627,
-	0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723, 0x0315, 0x0315, 0x3723, 0x3723,
-	0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B, 0x0411, 0x0411, 0x382B, 0x382B,
-	0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F, 0x0515, 0x0515, 0x392F, 0x392F,
-	0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0045, 0x0045, 0x4003, 0x4003, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F, 0x0605, 0x0605, 0x3A3F, 0x3A3F,
-	0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0101, 0x0101, 0x4107, 0x4107, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B, 0x0701, 0x0701, 0x3B3B, 0x3B3B,
-	0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0201, 0x0201, 0x4207, 0x4207, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F, 0x0809, 0x0809, 0x3C3F, 0x3C3F,
-	0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x0305, 0x0305, 0x4303, 0x4303, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B, 0x090D, 0x090D, 0x3D3B, 0x3D3B,
-	0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0401, 0x0401, 0x4407, 0x4407, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B, 0x0A0D, 0x0A0D, 0x3E3B, 0x3E3B,
-	0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0505, 0x0505, 0x4503, 0x4503, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F, 0x0B09, 0x0B09, 0x3F3F, 0x3F3F,
-	0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0605, 0x0605, 0x4603, 0x4603, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003, 0x0C0D, 0x0C0D, 0x4003, 0x4003,
-	0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0701, 0x0701, 0x4707, 0x4707, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107, 0x0D09, 0x0D09, 0x4107, 0x4107,
-	0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0809, 0x0809, 0x480F, 0x480F, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207, 0x0E09, 0x0E09, 0x4207, 0x4207,
-	0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x090D, 0x090D, 0x490B, 0x490B, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303, 0x0F0D, 0x0F0D, 0x4303, 0x4303,
-	0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407, 0x1011, 0x1011, 0x4407, 0x4407,
-	0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503, 0x1115, 0x1115, 0x4503, 0x4503,
-	0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603, 0x1215, 0x1215, 0x4603, 0x4603,
-	0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707, 0x1311, 0x1311, 0x4707, 0x4707,
-	0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F, 0x1415, 0x1415, 0x480F, 0x480F,
-	0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B, 0x1511, 0x1511, 0x490B, 0x490B,
-	0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1001, 0x1001, 0x5007, 0x5007, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B, 0x1601, 0x1601, 0x4A1B, 0x4A1B,
-	0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1105, 0x1105, 0x5103, 0x5103, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F, 0x1705, 0x1705, 0x4B1F, 0x4B1F,
-	0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x1205, 0x1205, 0x5203, 0x5203, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B, 0x180D, 0x180D, 0x4C1B, 0x4C1B,
-	0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1301, 0x1301, 0x5307, 0x5307, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F, 0x1909, 0x1909, 0x4D1F, 0x4D1F,
-	0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1405, 0x1405, 0x5403, 0x5403, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F, 0x1A09, 0x1A09, 0x4E1F, 0x4E1F,
-	0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1501, 0x1501, 0x5507, 0x5507, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B, 0x1B0D, 0x1B0D, 0x4F1B, 0x4F1B,
-	0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1601, 0x1601, 0x5607, 0x5607, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007, 0x1C09, 0x1C09, 0x5007, 0x5007,
-	0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1705, 0x1705, 0x5703, 0x5703, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103, 0x1D0D, 0x1D0D, 0x5103, 0x5103,
-	0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x180D, 0x180D, 0x580B, 0x580B, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203, 0x1E0D, 0x1E0D, 0x5203, 0x5203,
-	0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1909, 0x1909, 0x590F, 0x590F, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307, 0x1F09, 0x1F09, 0x5307, 0x5307,
-	0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403, 0x2031, 0x2031, 0x5403, 0x5403,
-	0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507, 0x2135, 0x2135, 0x5507, 0x5507,
-	0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607, 0x2235, 0x2235, 0x5607, 0x5607,
-	0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703, 0x2331, 0x2331, 0x5703, 0x5703,
-	0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B, 0x2435, 0x2435, 0x580B, 0x580B,
-	0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F, 0x2531, 0x2531, 0x590F, 0x590F,
-	0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2021, 0x2021, 0x6027, 0x6027, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F, 0x2621, 0x2621, 0x5A1F, 0x5A1F,
-	0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2125, 0x2125, 0x6123, 0x6123, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B, 0x2725, 0x2725, 0x5B1B, 0x5B1B,
-	0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x2225, 0x2225, 0x6223, 0x6223, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F, 0x282D, 0x282D, 0x5C1F, 0x5C1F,
-	0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2321, 0x2321, 0x6327, 0x6327, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B, 0x2929, 0x2929, 0x5D1B, 0x5D1B,
-	0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2425, 0x2425, 0x6423, 0x6423, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B, 0x2A29, 0x2A29, 0x5E1B, 0x5E1B,
-	0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2521, 0x2521, 0x6527, 0x6527, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F, 0x2B2D, 0x2B2D, 0x5F1F, 0x5F1F,
-	0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2621, 0x2621, 0x6627, 0x6627, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027, 0x2C29, 0x2C29, 0x6027, 0x6027,
-	0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2725, 0x2725, 0x6723, 0x6723, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123, 0x2D2D, 0x2D2D, 0x6123, 0x6123,
-	0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x282D, 0x282D, 0x682B, 0x682B, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223, 0x2E2D, 0x2E2D, 0x6223, 0x6223,
-	0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2929, 0x2929, 0x692F, 0x692F, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327, 0x2F29, 0x2F29, 0x6327, 0x6327,
-	0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423, 0x3035, 0x3035, 0x6423, 0x6423,
-	0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527, 0x3131, 0x3131, 0x6527, 0x6527,
-	0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627, 0x3231, 0x3231, 0x6627, 0x6627,
-	0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723, 0x3335, 0x3335, 0x6723, 0x6723,
-	0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B, 0x3431, 0x3431, 0x682B, 0x682B,
-	0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F, 0x3535, 0x3535, 0x692F, 0x692F,
-	0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3025, 0x3025, 0x7023, 0x7023, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F, 0x3625, 0x3625, 0x6A3F, 0x6A3F,
-	0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3121, 0x3121, 0x7127, 0x7127, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B, 0x3721, 0x3721, 0x6B3B, 0x6B3B,
-	0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3221, 0x3221, 0x7227, 0x7227, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F, 0x3829, 0x3829, 0x6C3F, 0x6C3F,
-	0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x3325, 0x3325, 0x7323, 0x7323, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B, 0x392D, 0x392D, 0x6D3B, 0x6D3B,
-	0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3421, 0x3421, 0x7427, 0x7427, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B, 0x3A2D, 0x3A2D, 0x6E3B, 0x6E3B,
-	0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3525, 0x3525, 0x7523, 0x7523, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F, 0x3B29, 0x3B29, 0x6F3F, 0x6F3F,
-	0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3625, 0x3625, 0x7623, 0x7623, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023, 0x3C2D, 0x3C2D, 0x7023, 0x7023,
-	0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3721, 0x3721, 0x7727, 0x7727, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127, 0x3D29, 0x3D29, 0x7127, 0x7127,
-	0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3829, 0x3829, 0x782F, 0x782F, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227, 0x3E29, 0x3E29, 0x7227, 0x7227,
-	0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x392D, 0x392D, 0x792B, 0x792B, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323, 0x3F2D, 0x3F2D, 0x7323, 0x7323,
-	0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427, 0x4011, 0x4011, 0x7427, 0x7427,
-	0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523, 0x4115, 0x4115, 0x7523, 0x7523,
-	0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623, 0x4215, 0x4215, 0x7623, 0x7623,
-	0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727, 0x4311, 0x4311, 0x7727, 0x7727,
-	0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F, 0x4415, 0x4415, 0x782F, 0x782F,
-	0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B, 0x4511, 0x4511, 0x792B, 0x792B,
-	0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4001, 0x4001, 0x8083, 0x8083, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B, 0x4601, 0x4601, 0x7A3B, 0x7A3B,
-	0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4105, 0x4105, 0x8187, 0x8187, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F, 0x4705, 0x4705, 0x7B3F, 0x7B3F,
-	0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x4205, 0x4205, 0x8287, 0x8287, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B, 0x480D, 0x480D, 0x7C3B, 0x7C3B,
-	0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4301, 0x4301, 0x8383, 0x8383, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F, 0x4909, 0x4909, 0x7D3F, 0x7D3F,
-	0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4405, 0x4405, 0x8487, 0x8487, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F, 0x4A09, 0x4A09, 0x7E3F, 0x7E3F,
-	0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4501, 0x4501, 0x8583, 0x8583, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B, 0x4B0D, 0x4B0D, 0x7F3B, 0x7F3B,
-	0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4601, 0x4601, 0x8683, 0x8683, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083, 0x4C09, 0x4C09, 0x8083, 0x8083,
-	0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4705, 0x4705, 0x8787, 0x8787, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187, 0x4D0D, 0x4D0D, 0x8187, 0x8187,
-	0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x480D, 0x480D, 0x888F, 0x888F, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287, 0x4E0D, 0x4E0D, 0x8287, 0x8287,
-	0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4909, 0x4909, 0x898B, 0x898B, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383, 0x4F09, 0x4F09, 0x8383, 0x8383,
-	0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487, 0x5015, 0x5015, 0x8487, 0x8487,
-	0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583, 0x5111, 0x5111, 0x8583, 0x8583,
-	0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683, 0x5211, 0x5211, 0x8683, 0x8683,
-	0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787, 0x5315, 0x5315, 0x8787, 0x8787,
-	0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F, 0x5411, 0x5411, 0x888F, 0x888F,
-	0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B, 0x5515, 0x5515, 0x898B, 0x898B,
-	0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5005, 0x5005, 0x9087, 0x9087, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B, 0x5605, 0x5605, 0x8A9B, 0x8A9B,
-	0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5101, 0x5101, 0x9183, 0x9183, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F, 0x5701, 0x5701, 0x8B9F, 0x8B9F,
-	0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5201, 0x5201, 0x9283, 0x9283, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B, 0x5809, 0x5809, 0x8C9B, 0x8C9B,
-	0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x5305, 0x5305, 0x9387, 0x9387, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F, 0x590D, 0x590D, 0x8D9F, 0x8D9F,
-	0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5401, 0x5401, 0x9483, 0x9483, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F, 0x5A0D, 0x5A0D, 0x8E9F, 0x8E9F,
-	0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5505, 0x5505, 0x9587, 0x9587, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B, 0x5B09, 0x5B09, 0x8F9B, 0x8F9B,
-	0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5605, 0x5605, 0x9687, 0x9687, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087, 0x5C0D, 0x5C0D, 0x9087, 0x9087,
-	0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5701, 0x5701, 0x9783, 0x9783, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183, 0x5D09, 0x5D09, 0x9183, 0x9183,
-	0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5809, 0x5809, 0x988B, 0x988B, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283, 0x5E09, 0x5E09, 0x9283, 0x9283,
-	0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x590D, 0x590D, 0x998F, 0x998F, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387, 0x5F0D, 0x5F0D, 0x9387, 0x9387,
-	0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483, 0x6035, 0x6035, 0x9483, 0x9483,
-	0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587, 0x6131, 0x6131, 0x9587, 0x9587,
-	0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687, 0x6231, 0x6231, 0x9687, 0x9687,
-	0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783, 0x6335, 0x6335, 0x9783, 0x9783,
-	0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B, 0x6431, 0x6431, 0x988B, 0x988B,
-	0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F, 0x6535, 0x6535, 0x998F, 0x998F,
+static const u8 SZYXPFlagsLUT[256] = {
+	0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0C, 0x0C, 0x08, 0x0C, 0x08, 0x08, 0x0C,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0C, 0x08, 0x08, 0x0C, 0x08, 0x0C, 0x0C, 0x08,
+	0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2C, 0x28, 0x28, 0x2C, 0x28, 0x2C, 0x2C, 0x28,
+	0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2C, 0x2C, 0x28, 0x2C, 0x28, 0x28, 0x2C,
+	0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0C, 0x08, 0x08, 0x0C, 0x08, 0x0C, 0x0C, 0x08,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0C, 0x0C, 0x08, 0x0C, 0x08, 0x08, 0x0C,
+	0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2C, 0x2C, 0x28, 0x2C, 0x28, 0x28, 0x2C,
+	0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2C, 0x28, 0x28, 0x2C, 0x28, 0x2C, 0x2C, 0x28,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8C, 0x88, 0x88, 0x8C, 0x88, 0x8C, 0x8C, 0x88,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8C, 0x8C, 0x88, 0x8C, 0x88, 0x88, 0x8C,
+	0xA4, 0xA0, 0xA0, 0xA4, 0xA0, 0xA4, 0xA4, 0xA0, 0xA8, 0xAC, 0xAC, 0xA8, 0xAC, 0xA8, 0xA8, 0xAC,
+	0xA0, 0xA4, 0xA4, 0xA0, 0xA4, 0xA0, 0xA0, 0xA4, 0xAC, 0xA8, 0xA8, 0xAC, 0xA8, 0xAC, 0xAC, 0xA8,
+	0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8C, 0x8C, 0x88, 0x8C, 0x88, 0x88, 0x8C,
+	0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8C, 0x88, 0x88, 0x8C, 0x88, 0x8C, 0x8C, 0x88,
+	0xA0, 0xA4, 0xA4, 0xA0, 0xA4, 0xA0, 0xA0, 0xA4, 0xAC, 0xA8, 0xA8, 0xAC, 0xA8, 0xAC, 0xAC, 0xA8,
+	0xA4, 0xA0, 0xA0, 0xA4, 0xA0, 0xA4, 0xA4, 0xA0, 0xA8, 0xAC, 0xAC, 0xA8, 0xAC, 0xA8, 0xA8, 0xAC,
 };
 
-void RunFrame(TI83_t* TI83) {
-	u64 cycleCount = TI83->CycleCount;
-	u64 nextFrameCycleCount = cycleCount + 100000 - (cycleCount % 100000);
-	ScheduleEvent(TI83, END_FRAME, nextFrameCycleCount);
-	u8 opcode;
-
-	while (cycleCount < nextFrameCycleCount) {
-		if (TI83->Halted) {
-			if (cycleCount < TI83->NextEventTime) {
-				u64 inc = TI83->NextEventTime - cycleCount;
-				inc += (-inc & 3);
-				cycleCount += inc;
-				REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + (inc >> 2)) & 0x7F);
+// half carry and overflow for 8-bit add/sub, see HV_INDEX
+static const u8 HalfCarryAddLUT[8] = { 0, HF_BIT, HF_BIT, HF_BIT, 0, 0, 0, HF_BIT };
+static const u8 HalfCarrySubLUT[8] = { 0, 0, HF_BIT, 0, HF_BIT, 0, HF_BIT, HF_BIT };
+static const u8 OverflowAddLUT[8] = { 0, 0, 0, VF_BIT, VF_BIT, 0, 0, 0 };
+static const u8 OverflowSubLUT[8] = { 0, VF_BIT, 0, 0, 0, 0, VF_BIT, 0 };
+
+u8 MaterializeFlags(TI83_t* TI83) {
+	u8 n1 = TI83->LazyFlags.N1;
+	u8 n2 = TI83->LazyFlags.N2;
+	u8 res = TI83->LazyFlags.Res;
+	u8 hv = HV_INDEX(n1, n2, res);
+
+	switch (TI83->LazyFlags.Op) {
+		case FLAGS_NONE:
+		{
+			return REGS(F);
+		}
+		case FLAGS_ADD:
+		{
+			REGS(F) = SZYXFlagsLUT[res] | HF_ADD(hv) | VF_ADD(hv);
+			break;
+		}
+		case FLAGS_SUB:
+		{
+			REGS(F) = SZYXFlagsLUT[res] | HF_SUB(hv) | VF_SUB(hv) | NF_BIT;
+			break;
+		}
+		case FLAGS_CP:
+		{
+			REGS(F) = (SZYXFlagsLUT[res] & (SF_BIT | ZF_BIT)) | (n2 & (YF_BIT | XF_BIT)) | HF_SUB(hv) | VF_SUB(hv) | NF_BIT;
+			break;
+		}
+		case FLAGS_AND:
+		{
+			REGS(F) = SZYXPFlagsLUT[res] | HF_BIT;
+			break;
+		}
+		case FLAGS_LOGIC:
+		{
+			REGS(F) = SZYXPFlagsLUT[res];
+			break;
+		}
+	}
+
+	REGS(F) |= TI83->LazyFlags.Carry;
+	TI83->LazyFlags.Op = FLAGS_NONE;
+	return REGS(F);
+}
+
+// a run of instructions with a single handler, which ROM is matched against when decoding (see DECODE_FUSED)
+// the table and handlers are generated by tools/fusegen.c from the opcode pairs seen by emu83bench --pairs
+// all but the last instruction are simple (no branches, port I/O, or interrupt changes), and have a fixed cycle count
+typedef struct {
+	u8 Length; // in bytes
+	u8 Lead; // cycles taken by all but the last instruction, which must all complete before the next event
+	u8 Bytes[8];
+	u8 Mask[8]; // operands aren't matched
+} FusedOp_t;
+
+#include "fusion.h"
+
+static u8 MatchFusedOp(const u8* mem, u16 addr) {
+	for (u32 i = 0; i < sizeof (FusedOps) / sizeof (FusedOps[0]); i++) {
+		const FusedOp_t* fused = &FusedOps[i];
+		u16 last = addr + fused->Length - 1;
+		if ((addr ^ last) & 0xC000) {
+			continue;
+		}
+
+		u32 j = 0;
+		while (j < fused->Length && (mem[addr + j] & fused->Mask[j]) == fused->Bytes[j]) {
+			j++;
+		}
+
+		if (j == fused->Length) {
+			return DECODE_FUSED + i;
+		}
+	}
+
+	return DECODE_UNPREFIXED;
+}
+
+static void DecodeOp(TI83_t* TI83, u16 addr) {
+	DecodedOp_t* decoded = &TI83->DecodePtrs[addr >> 14][addr];
+	u8* mem = TI83->ReadPtrs[addr >> 14];
+	u8 kind;
+
+	switch (mem[addr]) {
+		case 0xCB: kind = DECODE_CB; break;
+		case 0xDD: kind = DECODE_DD; break;
+		case 0xED: kind = DECODE_ED; break;
+		case 0xFD: kind = DECODE_FD; break;
+		default: kind = DECODE_UNPREFIXED; break;
+	}
+
+	// the opcode (and prefix) plus 2 operand bytes must all come from the same region
+	u16 last = addr + (kind == DECODE_UNPREFIXED ? 2 : 3);
+	if ((addr ^ last) & 0xC000) {
+		decoded->Kind = DECODE_UNCACHEABLE;
+		return;
+	}
+
+	// callbacks (and the memory log) must see their watched bytes being fetched or read, which running the decoded copy would skip
+	// the decode cache is cleared whenever these callbacks or their watches change (see TI83_SetMemoryWatch)
+	bool execute = TI83->ExecuteCallback || LOGGED(MEM_CB_EXECUTE);
+	bool read = TI83->ReadCallback || LOGGED(MEM_CB_READ);
+	if (execute || read) {
+		for (u32 i = addr; i <= last; i++) {
+			if ((execute && WATCHED(TI83->ExecuteWatch, i)) || (read && i != addr && WATCHED(TI83->ReadWatch, i))) {
+				decoded->Kind = DECODE_UNCACHEABLE;
+				return;
+			}
+		}
+	}
+
+	if (addr >= 0x8000) {
+		TI83->DecodedPages[addr >> 8] = true;
+		TI83->DecodedPages[last >> 8] = true;
+	}
+
+	if (kind != DECODE_UNPREFIXED) {
+		++addr;
+	} else if (addr < 0x8000) {
+		// ROM can't change under a superinstruction (see TI83_GetMemoryArea)
+		kind = MatchFusedOp(mem, addr);
+	}
+
+	decoded->Kind = kind;
+	decoded->Opcode = mem[addr];
+	decoded->Operand[0] = mem[addr + 1];
+	decoded->Operand[1] = mem[addr + 2];
+}
+
+// runs the further repeats of an LDIR/LDDR (with PC rewound to it) which start before the next event, returning the cycles taken
+// each repeat fetches the instruction again (R += 2), takes 21 cycles, and leaves PC and WZ as they are
+// the flags only depend on the last byte copied and BC, and the final repeat is always left to the interpreter
+static u32 RepeatBlockCopy(TI83_t* TI83, u64 cycleCount, bool dec) {
+	if (TI83->ReadCallback || TI83->WriteCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints || cycleCount >= TI83->NextEventTime) {
+		return 0;
+	}
+
+	// the LDI/LDD just run might have overwritten the instruction itself, which then has to be fetched again
+	if (ReadMem(TI83, REGS(PC)) != 0xED || ReadMem(TI83, REGS(PC) + 1) != (dec ? 0xB8 : 0xB0)) {
+		return 0;
+	}
+
+	u32 repeats = REGS(BC) - 1;
+	u64 beforeEvent = (TI83->NextEventTime - cycleCount + 20) / 21;
+	if (beforeEvent < repeats) {
+		repeats = beforeEvent;
+	}
+
+	// stop short of overwriting the instruction itself
+	for (u16 i = 0; i < 2; i++) {
+		u16 distance = dec ? REGS(DE) - (REGS(PC) + i) : (REGS(PC) + i) - REGS(DE);
+		if (distance < repeats) {
+			repeats = distance;
+		}
+	}
+
+	if (!repeats) {
+		return 0;
+	}
+
+	BulkCopyMem(TI83, REGS(DE), REGS(HL), repeats, dec);
+	u16 last = dec ? REGS(HL) - (repeats - 1) : REGS(HL) + (repeats - 1);
+	u8 n = ReadMem(TI83, last) + REGS(A);
+	REGS(HL) = dec ? REGS(HL) - repeats : REGS(HL) + repeats;
+	REGS(DE) = dec ? REGS(DE) - repeats : REGS(DE) + repeats;
+	REGS(BC) -= repeats;
+
+	// LDI/LDD already synced the flags, and BC is still non-zero
+	REGS(F) = (REGS(F) & (SF_BIT | ZF_BIT | CF_BIT)) | PF_BIT;
+	BLOCK_XY_CHECK(n);
+
+	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + repeats * 2) & 0x7F);
+	return repeats * 21;
+}
+
+// like RepeatBlockCopy, but for CPIR/CPDR, running the repeats which don't find a match
+// those all leave PC and WZ as they are, so only the flags for the last byte compared need computing
+// the matching repeat (or the final one) is left to the interpreter
+static u32 RepeatBlockCompare(TI83_t* TI83, u64 cycleCount, bool dec) {
+	if (TI83->ReadCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints || cycleCount >= TI83->NextEventTime) {
+		return 0;
+	}
+
+	u32 repeats = REGS(BC) - 1;
+	u64 beforeEvent = (TI83->NextEventTime - cycleCount + 20) / 21;
+	if (beforeEvent < repeats) {
+		repeats = beforeEvent;
+	}
+
+	repeats = ScanMem(TI83, REGS(HL), repeats, REGS(A), dec);
+	if (!repeats) {
+		return 0;
+	}
+
+	u16 last = dec ? REGS(HL) - (repeats - 1) : REGS(HL) + (repeats - 1);
+	REGS(HL) = dec ? REGS(HL) - repeats : REGS(HL) + repeats;
+	REGS(BC) -= repeats;
+
+	// same as CPI/CPD (which already synced the flags), with BC still non-zero
+	u8 dhl = ReadMem(TI83, last);
+	u8 res = REGS(A) - dhl;
+	REGS(F) = (REGS(F) & CF_BIT) | NF_BIT | PF_BIT | (SZYXFlagsLUT[res] & (SF_BIT | ZF_BIT)) | HF_SUB(HV_INDEX(REGS(A), dhl, res));
+	if (REGS(F) & HF_BIT) {
+		--res;
+	}
+	BLOCK_XY_CHECK(res);
+
+	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + repeats * 2) & 0x7F);
+	return repeats * 21;
+}
+
+// like RepeatBlockCopy, but for INIR/INDR from ports which can give a block of bytes at once (see ReadPortBlock)
+// INDR repeats INI like the instruction itself does, so dec is always false for now
+static u32 RepeatBlockIn(TI83_t* TI83, u64 cycleCount, bool dec) {
+	if (TI83->WriteCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints || cycleCount >= TI83->NextEventTime) {
+		return 0;
+	}
+
+	// same as RepeatBlockCopy, the INI just run might have overwritten the instruction (INIR or INDR)
+	if (ReadMem(TI83, REGS(PC)) != 0xED || (ReadMem(TI83, REGS(PC) + 1) & 0xF7) != 0xB2) {
+		return 0;
+	}
+
+	u32 repeats = REGS(B) - 1;
+	u64 beforeEvent = (TI83->NextEventTime - cycleCount + 20) / 21;
+	if (beforeEvent < repeats) {
+		repeats = beforeEvent;
+	}
+
+	// stop short of overwriting the instruction itself
+	for (u16 i = 0; i < 2; i++) {
+		u16 distance = dec ? REGS(HL) - (REGS(PC) + i) : (REGS(PC) + i) - REGS(HL);
+		if (distance < repeats) {
+			repeats = distance;
+		}
+	}
+
+	u8 data[0xFF];
+	if (!repeats || !ReadPortBlock(TI83, REGS(C), data, repeats)) {
+		return 0;
+	}
+
+	for (u32 i = 0; i < repeats; i++) {
+		WriteMem(TI83, dec ? REGS(HL) - i : REGS(HL) + i, data[i]);
+	}
+
+	REGS(HL) = dec ? REGS(HL) - repeats : REGS(HL) + repeats;
+	REGS(B) -= repeats;
+
+	// same as INI/IND for the last byte (which already discarded the flags), WZ was set before B was decremented
+	u8 dc = data[repeats - 1];
+	u8 c = dec ? REGS(C) - 1 : REGS(C) + 1;
+	REGS(WZ) = dec ? REGS(BC) + 0x100 - 1 : REGS(BC) + 0x100 + 1;
+	REGS(F) = SZYXFlagsLUT[REGS(B)];
+	if (dc & BIT(7)) {
+		REGS(F) |= NF_BIT;
+	}
+	if (dc + c > 0xFF) {
+		REGS(F) |= HF_BIT | CF_BIT;
+	}
+	PF_CHECK(((dc + c) & 0x07) ^ REGS(B));
+
+	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + repeats * 2) & 0x7F);
+	return repeats * 21;
+}
+
+// like RepeatBlockCopy, but for OTIR/OTDR into ports which can take a block of bytes at once (see WritePortBlock)
+static u32 RepeatBlockOut(TI83_t* TI83, u64 cycleCount, bool dec) {
+	if (TI83->ReadCallback || TI83->ExecuteCallback || TI83->TraceCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints || cycleCount >= TI83->NextEventTime) {
+		return 0;
+	}
+
+	u32 repeats = REGS(B) - 1;
+	u64 beforeEvent = (TI83->NextEventTime - cycleCount + 20) / 21;
+	if (beforeEvent < repeats) {
+		repeats = beforeEvent;
+	}
+
+	if (!repeats) {
+		return 0;
+	}
+
+	// port writes can't change memory, so everything can be read first
+	u8 data[0xFF];
+	for (u32 i = 0; i < repeats; i++) {
+		data[i] = ReadMem(TI83, dec ? REGS(HL) - i : REGS(HL) + i);
+	}
+
+	if (!WritePortBlock(TI83, REGS(C), data, repeats)) {
+		return 0;
+	}
+
+	REGS(HL) = dec ? REGS(HL) - repeats : REGS(HL) + repeats;
+	REGS(B) -= repeats;
+
+	// same as OUTI/OUTD for the last byte (which already discarded the flags)
+	u8 dhl = data[repeats - 1];
+	REGS(WZ) = dec ? REGS(BC) - 1 : REGS(BC) + 1;
+	REGS(F) = SZYXFlagsLUT[REGS(B)];
+	if (dhl & BIT(7)) {
+		REGS(F) |= NF_BIT;
+	}
+	if (dhl + REGS(L) > 0xFF) {
+		REGS(F) |= HF_BIT | CF_BIT;
+	}
+	PF_CHECK(((dhl + REGS(L)) & 0x07) ^ REGS(B));
+
+	REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + repeats * 2) & 0x7F);
+	return repeats * 21;
+}
+
+#define IDLE_LOOP_MAX_LENGTH 32
+
+// checks the body of a loop only has instructions which change nothing but registers, and branches which stay on its instruction boundaries
+// anything unusual (writes, the stack, prefixed instructions besides index reads and bit tests) just isn't treated as a polling loop
+static bool IdleLoopIsPure(TI83_t* TI83, u16 start, u16 end) {
+	u32 len = (u16)(end - start);
+	u8 code[IDLE_LOOP_MAX_LENGTH];
+	for (u32 i = 0; i < len; i++) {
+		code[i] = ReadMem(TI83, start + i);
+	}
+
+	u64 boundaries = 0;
+	u16 targets[IDLE_LOOP_MAX_LENGTH / 2];
+	u32 numTargets = 0;
+	u32 i = 0;
+	while (i < len) {
+		boundaries |= 1ull << i;
+		u8 op = code[i];
+		u8 x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+		u32 size = 1;
+		bool relative = false, absolute = false;
+		if (x == 1) {
+			if (y == 6) {
+				return false; // ld (hl),r and halt
 			}
-		} else while (cycleCount < TI83->NextEventTime) {
-			if (UNLIKELY(TI83->TraceCallback)) {
-				TI83->TraceCallback(cycleCount);
+		} else if (x == 0) {
+			switch (z) {
+				case 0: size = y < 2 ? 1 : 2; relative = y >= 2; break; // nop, ex af,af', djnz, jr
+				case 1: size = (y & 1) ? 1 : 3; break; // add hl,rr / ld rr,nn
+				case 2: if (!(y & 1)) return false; size = y < 4 ? 1 : 3; break; // ld a,(rr) / ld hl,(nn) / ld a,(nn)
+				case 3: break; // inc/dec rr
+				case 4: case 5: if (y == 6) return false; break; // inc/dec r
+				case 6: if (y == 6) return false; size = 2; break; // ld r,n
+				case 7: break; // rotates, daa, cpl, scf, ccf
 			}
-			FETCH(opcode, REGS(PC)++);
-			switch (opcode) {
-				// nop
-				case 0x00: break;
-				// ld bc,nn
-				case 0x01: LD_RR_NN(B, C); break;
-				// ld (bc),a
-				case 0x02: LD_DRR_A(BC); break;
-				// inc bc
-				case 0x03: INC_RR(BC); break;
-				// inc b
-				case 0x04: INC_R(B); break;
-				// dec b
-				case 0x05: DEC_R(B); break;
-				// ld b,n
-				case 0x06: LD_R_N(B); break;
-				// rlca
-				case 0x07: RLCA(); break;
-				// ex af,af'
-				case 0x08: EX_RR_ARR(AF); break;
-				// add hl,bc
-				case 0x09: ADD_RR_RR(HL, BC); break;
-				// ld a,(bc)
-				case 0x0A: LD_A_DRR(BC); break;
-				// dec bc
-				case 0x0B: DEC_RR(BC); break;
-				// inc c
-				case 0x0C: INC_R(C); break;
-				// dec c
-				case 0x0D: DEC_R(C); break;
-				// ld c,n
-				case 0x0E: LD_R_N(C); break;
-				// rrca
-				case 0x0F: RRCA(); break;
-				// djnz e
-				case 0x10: DJNZ_E(); break;
-				// ld de,nn
-				case 0x11: LD_RR_NN(D, E); break;
-				// ld (de),a
-				case 0x12: LD_DRR_A(DE); break;
-				// inc de
-				case 0x13: INC_RR(DE); break;
-				// inc d
-				case 0x14: INC_R(D); break;
-				// dec d
-				case 0x15: DEC_R(D); break;
-				// ld d,n
-				case 0x16: LD_R_N(D); break;
-				// rla
-				case 0x17: RLA(); break;
-				// jr e
-				case 0x18: JR_CC_E(true); break;
-				// add hl,de
-				case 0x19: ADD_RR_RR(HL, DE); break;
-				// ld a,(de)
-				case 0x1A: LD_A_DRR(DE); break;
-				// dec de
-				case 0x1B: DEC_RR(DE); break;
-				// inc e
-				case 0x1C: INC_R(E); break;
-				// dec e
-				case 0x1D: DEC_R(E); break;
-				// ld e,n
-				case 0x1E: LD_R_N(E); break;
-				// rra
-				case 0x1F: RRA(); break;
-				// jr nz,e
-				case 0x20: JR_CC_E(!(REGS(F) & ZF_BIT)); break;
-				// ld hl,nn
-				case 0x21: LD_RR_NN(H, L); break;
-				// ld (nn),hl
-				case 0x22: LD_DNN_RR(H, L); break;
-				// inc hl
-				case 0x23: INC_RR(HL); break;
-				// inc h
-				case 0x24: INC_R(H); break;
-				// dec h
-				case 0x25: DEC_R(H); break;
-				// ld h,n
-				case 0x26: LD_R_N(H); break;
-				// daa
-				case 0x27: DAA(); break;
-				// jr z,e
-				case 0x28: JR_CC_E(REGS(F) & ZF_BIT); break;
-				// add hl,hl
-				case 0x29: ADD_RR_RR(HL, HL); break;
-				// ld hl,(nn)
-				case 0x2A: LD_RR_DNN(H, L); break;
-				// dec hl
-				case 0x2B: DEC_RR(HL); break;
-				// inc l
-				case 0x2C: INC_R(L); break;
-				// dec l
-				case 0x2D: DEC_R(L); break;
-				// ld l,n
-				case 0x2E: LD_R_N(L); break;
-				// cpl
-				case 0x2F: CPL(); break;
-				// jr nc,e
-				case 0x30: JR_CC_E(!(REGS(F) & CF_BIT)); break;
-				// ld sp,nn
-				case 0x31: LD_RR_NN(SPH, SPL); break;
-				// ld (nn),a
-				case 0x32: LD_DNN_A(); break;
-				// inc sp
-				case 0x33: INC_RR(SP); break;
-				// inc (hl)
-				case 0x34: INC_DHL(); break;
-				// dec (hl)
-				case 0x35: DEC_DHL(); break;
-				// ld (hl),n
-				case 0x36: LD_DHL_N(); break;
-				// scf
-				case 0x37: SCF(); break;
-				// jr c,e
-				case 0x38: JR_CC_E(REGS(F) & CF_BIT); break;
-				// add hl,sp
-				case 0x39: ADD_RR_RR(HL, SP); break;
-				// ld a,(nn)
-				case 0x3A: LD_A_DNN(); break;
-				// dec sp
-				case 0x3B: DEC_RR(SP); break;
-				// inc a
-				case 0x3C: INC_R(A); break;
-				// dec a
-				case 0x3D: DEC_R(A); break;
-				// ld a,n
-				case 0x3E: LD_R_N(A); break;
-				// ccf
-				case 0x3F: CCF(); break;
-				// ld b,b
-				case 0x40: LD_R_R(B, B); break;
-				// ld b,c
-				case 0x41: LD_R_R(B, C); break;
-				// ld b,d
-				case 0x42: LD_R_R(B, D); break;
-				// ld b,e
-				case 0x43: LD_R_R(B, E); break;
-				// ld b,h
-				case 0x44: LD_R_R(B, H); break;
-				// ld b,l
-				case 0x45: LD_R_R(B, L); break;
-				// ld b,(hl)
-				case 0x46: LD_R_DHL(B); break;
-				// ld b,a
-				case 0x47: LD_R_R(B, A); break;
-				// ld c,b
-				case 0x48: LD_R_R(C, B); break;
-				// ld c,c
-				case 0x49: LD_R_R(C, C); break;
-				// ld c,d
-				case 0x4A: LD_R_R(C, D); break;
-				// ld c,e
-				case 0x4B: LD_R_R(C, E); break;
-				// ld c,h
-				case 0x4C: LD_R_R(C, H); break;
-				// ld c,l
-				case 0x4D: LD_R_R(C, L); break;
-				// ld c,(hl)
-				case 0x4E: LD_R_DHL(C); break;
-				// ld c,a
-				case 0x4F: LD_R_R(C, A); break;
-				// ld d,b
-				case 0x50: LD_R_R(D, B); break;
-				// ld d,c
-				case 0x51: LD_R_R(D, C); break;
-				// ld d,d
-				case 0x52: LD_R_R(D, D); break;
-				// ld d,e
-				case 0x53: LD_R_R(D, E); break;
-				// ld d,h
-				case 0x54: LD_R_R(D, H); break;
-				// ld d,l
-				case 0x55: LD_R_R(D, L); break;
-				// ld d,(hl)
-				case 0x56: LD_R_DHL(D); break;
-				// ld d,a
-				case 0x57: LD_R_R(D, A); break;
-				// ld e,b
-				case 0x58: LD_R_R(E, B); break;
-				// ld e,c
-				case 0x59: LD_R_R(E, C); break;
-				// ld e,d
-				case 0x5A: LD_R_R(E, D); break;
-				// ld e,e
-				case 0x5B: LD_R_R(E, E); break;
-				// ld e,h
-				case 0x5C: LD_R_R(E, H); break;
-				// ld e,l
-				case 0x5D: LD_R_R(E, L); break;
-				// ld e,(hl)
-				case 0x5E: LD_R_DHL(E); break;
-				// ld e,a
-				case 0x5F: LD_R_R(E, A); break;
-				// ld h,b
-				case 0x60: LD_R_R(H, B); break;
-				// ld h,c
-				case 0x61: LD_R_R(H, C); break;
-				// ld h,d
-				case 0x62: LD_R_R(H, D); break;
-				// ld h,e
-				case 0x63: LD_R_R(H, E); break;
-				// ld h,h
-				case 0x64: LD_R_R(H, H); break;
-				// ld h,l
-				case 0x65: LD_R_R(H, L); break;
-				// ld h,(hl)
-				case 0x66: LD_R_DHL(H); break;
-				// ld h,a
-				case 0x67: LD_R_R(H, A); break;
-				// ld l,b
-				case 0x68: LD_R_R(L, B); break;
-				// ld l,c
-				case 0x69: LD_R_R(L, C); break;
-				// ld l,d
-				case 0x6A: LD_R_R(L, D); break;
-				// ld l,e
-				case 0x6B: LD_R_R(L, E); break;
-				// ld l,h
-				case 0x6C: LD_R_R(L, H); break;
-				// ld l,l
-				case 0x6D: LD_R_R(L, L); break;
-				// ld l,(hl)
-				case 0x6E: LD_R_DHL(L); break;
-				// ld l,a
-				case 0x6F: LD_R_R(L, A); break;
-				// ld (hl),b
-				case 0x70: LD_DHL_R(B); break;
-				// ld (hl),c
-				case 0x71: LD_DHL_R(C); break;
-				// ld (hl),d
-				case 0x72: LD_DHL_R(D); break;
-				// ld (hl),e
-				case 0x73: LD_DHL_R(E); break;
-				// ld (hl),h
-				case 0x74: LD_DHL_R(H); break;
-				// ld (hl),l
-				case 0x75: LD_DHL_R(L); break;
-				// halt
-				case 0x76: HALT(); break;
-				// ld (hl),a
-				case 0x77: LD_DHL_R(A); break;
-				// ld a,b
-				case 0x78: LD_R_R(A, B); break;
-				// ld a,c
-				case 0x79: LD_R_R(A, C); break;
-				// ld a,d
-				case 0x7A: LD_R_R(A, D); break;
-				// ld a,e
-				case 0x7B: LD_R_R(A, E); break;
-				// ld a,h
-				case 0x7C: LD_R_R(A, H); break;
-				// ld a,l
-				case 0x7D: LD_R_R(A, L); break;
-				// ld a,(hl)
-				case 0x7E: LD_R_DHL(A); break;
-				// ld a,a
-				case 0x7F: LD_R_R(A, A); break;
-				// add a,b
-				case 0x80: ADD_A_R(B); break;
-				// add a,c
-				case 0x81: ADD_A_R(C); break;
-				// add a,d
-				case 0x82: ADD_A_R(D); break;
-				// add a,e
-				case 0x83: ADD_A_R(E); break;
-				// add a,h
-				case 0x84: ADD_A_R(H); break;
-				// add a,l
-				case 0x85: ADD_A_R(L); break;
-				// add a,(hl)
-				case 0x86: ADD_A_DHL(); break;
-				// add a,a
-				case 0x87: ADD_A_R(A); break;
-				// adc a,b
-				case 0x88: ADC_A_R(B); break;
-				// adc a,c
-				case 0x89: ADC_A_R(C); break;
-				// adc a,d
-				case 0x8A: ADC_A_R(D); break;
-				// adc a,e
-				case 0x8B: ADC_A_R(E); break;
-				// adc a,h
-				case 0x8C: ADC_A_R(H); break;
-				// adc a,l
-				case 0x8D: ADC_A_R(L); break;
-				// adc a,(hl)
-				case 0x8E: ADC_A_DHL(); break;
-				// adc a,a
-				case 0x8F: ADC_A_R(A); break;
-				// sub a,b
-				case 0x90: SUB_A_R(B); break;
-				// sub a,c
-				case 0x91: SUB_A_R(C); break;
-				// sub a,d
-				case 0x92: SUB_A_R(D); break;
-				// sub a,e
-				case 0x93: SUB_A_R(E); break;
-				// sub a,h
-				case 0x94: SUB_A_R(H); break;
-				// sub a,l
-				case 0x95: SUB_A_R(L); break;
-				// sub a,(hl)
-				case 0x96: SUB_A_DHL(); break;
-				// sub a,a
-				case 0x97: SUB_A_R(A); break;
-				// sbc a,b
-				case 0x98: SBC_A_R(B); break;
-				// sbc a,c
-				case 0x99: SBC_A_R(C); break;
-				// sbc a,d
-				case 0x9A: SBC_A_R(D); break;
-				// sbc a,e
-				case 0x9B: SBC_A_R(E); break;
-				// sbc a,h
-				case 0x9C: SBC_A_R(H); break;
-				// sbc a,l
-				case 0x9D: SBC_A_R(L); break;
-				// sbc a,(hl)
-				case 0x9E: SBC_A_DHL(); break;
-				// sbc a,a
-				case 0x9F: SBC_A_R(A); break;
-				// and a,b
-				case 0xA0: AND_A_R(B); break;
-				// and a,c
-				case 0xA1: AND_A_R(C); break;
-				// and a,d
-				case 0xA2: AND_A_R(D); break;
-				// and a,e
-				case 0xA3: AND_A_R(E); break;
-				// and a,h
-				case 0xA4: AND_A_R(H); break;
-				// and a,l
-				case 0xA5: AND_A_R(L); break;
-				// and a,(hl)
-				case 0xA6: AND_A_DHL(); break;
-				// and a,a
-				case 0xA7: AND_A_R(A); break;
-				// xor a,b
-				case 0xA8: XOR_A_R(B); break;
-				// xor a,c
-				case 0xA9: XOR_A_R(C); break;
-				// xor a,d
-				case 0xAA: XOR_A_R(D); break;
-				// xor a,e
-				case 0xAB: XOR_A_R(E); break;
-				// xor a,h
-				case 0xAC: XOR_A_R(H); break;
-				// xor a,l
-				case 0xAD: XOR_A_R(L); break;
-				// xor a,(hl)
-				case 0xAE: XOR_A_DHL(); break;
-				// xor a,a
-				case 0xAF: XOR_A_R(A); break;
-				// or a,b
-				case 0xB0: OR_A_R(B); break;
-				// or a,c
-				case 0xB1: OR_A_R(C); break;
-				// or a,d
-				case 0xB2: OR_A_R(D); break;
-				// or a,e
-				case 0xB3: OR_A_R(E); break;
-				// or a,h
-				case 0xB4: OR_A_R(H); break;
-				// or a,l
-				case 0xB5: OR_A_R(L); break;
-				// or a,(hl)
-				case 0xB6: OR_A_DHL(); break;
-				// or a,a
-				case 0xB7: OR_A_R(A); break;
-				// cp a,b
-				case 0xB8: CP_A_R(B); break;
-				// cp a,c
-				case 0xB9: CP_A_R(C); break;
-				// cp a,d
-				case 0xBA: CP_A_R(D); break;
-				// cp a,e
-				case 0xBB: CP_A_R(E); break;
-				// cp a,h
-				case 0xBC: CP_A_R(H); break;
-				// cp a,l
-				case 0xBD: CP_A_R(L); break;
-				// cp a,(hl)
-				case 0xBE: CP_A_DHL(); break;
-				// cp a,a
-				case 0xBF: CP_A_R(A); break;
-				// ret nz
-				case 0xC0: RET_CC(!(REGS(F) & ZF_BIT)); break;
-				// pop bc
-				case 0xC1: POP(B, C); break;
-				// jp nz,nn
-				case 0xC2: JP_CC_NN(!(REGS(F) & ZF_BIT)); break;
-				// jp nn
-				case 0xC3: JP_CC_NN(true); break;
-				// call nz,nn
-				case 0xC4: CALL_CC_NN(!(REGS(F) & ZF_BIT)); break;
-				// push bc
-				case 0xC5: PUSH(B, C); break;
-				// add a,n
-				case 0xC6: ADD_A_N(); break;
-				// rst 0x00
-				case 0xC7: RST(0x00); break;
-				// ret z
-				case 0xC8: RET_CC(REGS(F) & ZF_BIT); break;
-				// ret
-				case 0xC9: RET(); break;
-				// jp z,nn
-				case 0xCA: JP_CC_NN(REGS(F) & ZF_BIT); break;
-				// 0xCB prefix
-				case 0xCB:
+		} else if (x == 3) {
+			switch (op) {
+				case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA: case 0xE2: case 0xEA: case 0xF2: case 0xFA:
 				{
-					FETCH(opcode, REGS(PC)++);
-					switch (opcode) {
-						// rlc b
-						case 0x00: RLC_R(B); break;
-						// rlc c
-						case 0x01: RLC_R(C); break;
-						// rlc d
-						case 0x02: RLC_R(D); break;
-						// rlc e
-						case 0x03: RLC_R(E); break;
-						// rlc h
-						case 0x04: RLC_R(H); break;
-						// rlc l
-						case 0x05: RLC_R(L); break;
-						// rlc (hl)
-						case 0x06: RLC_DHL(); break;
-						// rlc a
-						case 0x07: RLC_R(A); break;
-						// rrc b
-						case 0x08: RRC_R(B); break;
-						// rrc c
-						case 0x09: RRC_R(C); break;
-						// rrc d
-						case 0x0A: RRC_R(D); break;
-						// rrc e
-						case 0x0B: RRC_R(E); break;
-						// rrc h
-						case 0x0C: RRC_R(H); break;
-						// rrc l
-						case 0x0D: RRC_R(L); break;
-						// rrc (hl)
-						case 0x0E: RRC_DHL(); break;
-						// rrc a
-						case 0x0F: RRC_R(A); break;
-						// rl b
-						case 0x10: RL_R(B); break;
-						// rl c
-						case 0x11: RL_R(C); break;
-						// rl d
-						case 0x12: RL_R(D); break;
-						// rl e
-						case 0x13: RL_R(E); break;
-						// rl h
-						case 0x14: RL_R(H); break;
-						// rl l
-						case 0x15: RL_R(L); break;
-						// rl (hl)
-						case 0x16: RL_DHL(); break;
-						// rl a
-						case 0x17: RL_R(A); break;
-						// rr b
-						case 0x18: RR_R(B); break;
-						// rr c
-						case 0x19: RR_R(C); break;
-						// rr d
-						case 0x1A: RR_R(D); break;
-						// rr e
-						case 0x1B: RR_R(E); break;
-						// rr h
-						case 0x1C: RR_R(H); break;
-						// rr l
-						case 0x1D: RR_R(L); break;
-						// rr (hl)
-						case 0x1E: RR_DHL(); break;
-						// rr a
-						case 0x1F: RR_R(A); break;
-						// sla b
-						case 0x20: SLA_R(B); break;
-						// sla c
-						case 0x21: SLA_R(C); break;
-						// sla d
-						case 0x22: SLA_R(D); break;
-						// sla e
-						case 0x23: SLA_R(E); break;
-						// sla h
-						case 0x24: SLA_R(H); break;
-						// sla l
-						case 0x25: SLA_R(L); break;
-						// sla (hl)
-						case 0x26: SLA_DHL(); break;
-						// sla a
-						case 0x27: SLA_R(A); break;
-						// sra b
-						case 0x28: SRA_R(B); break;
-						// sra c
-						case 0x29: SRA_R(C); break;
-						// sra d
-						case 0x2A: SRA_R(D); break;
-						// sra e
-						case 0x2B: SRA_R(E); break;
-						// sra h
-						case 0x2C: SRA_R(H); break;
-						// sra l
-						case 0x2D: SRA_R(L); break;
-						// sra (hl)
-						case 0x2E: SRA_DHL(); break;
-						// sra a
-						case 0x2F: SRA_R(A); break;
-						// sll b
-						case 0x30: SLL_R(B); break;
-						// sll c
-						case 0x31: SLL_R(C); break;
-						// sll d
-						case 0x32: SLL_R(D); break;
-						// sll e
-						case 0x33: SLL_R(E); break;
-						// sll h
-						case 0x34: SLL_R(H); break;
-						// sll l
-						case 0x35: SLL_R(L); break;
-						// sll (hl)
-						case 0x36: SLL_DHL(); break;
-						// sll a
-						case 0x37: SLL_R(A); break;
-						// srl b
-						case 0x38: SRL_R(B); break;
-						// srl c
-						case 0x39: SRL_R(C); break;
-						// srl d
-						case 0x3A: SRL_R(D); break;
-						// srl e
-						case 0x3B: SRL_R(E); break;
-						// srl h
-						case 0x3C: SRL_R(H); break;
-						// srl l
-						case 0x3D: SRL_R(L); break;
-						// srl (hl)
-						case 0x3E: SRL_DHL(); break;
-						// srl a
-						case 0x3F: SRL_R(A); break;
-						// bit 0,b
-						case 0x40: BIT_N_R(0, B); break;
-						// bit 0,c
-						case 0x41: BIT_N_R(0, C); break;
-						// bit 0,d
-						case 0x42: BIT_N_R(0, D); break;
-						// bit 0,e
-						case 0x43: BIT_N_R(0, E); break;
-						// bit 0,h
-						case 0x44: BIT_N_R(0, H); break;
-						// bit 0,l
-						case 0x45: BIT_N_R(0, L); break;
-						// bit 0,(hl)
-						case 0x46: BIT_N_DHL(0); break;
-						// bit 0,a
-						case 0x47: BIT_N_R(0, A); break;
-						// bit 1,b
-						case 0x48: BIT_N_R(1, B); break;
-						// bit 1,c
-						case 0x49: BIT_N_R(1, C); break;
-						// bit 1,d
-						case 0x4A: BIT_N_R(1, D); break;
-						// bit 1,e
-						case 0x4B: BIT_N_R(1, E); break;
-						// bit 1,h
-						case 0x4C: BIT_N_R(1, H); break;
-						// bit 1,l
-						case 0x4D: BIT_N_R(1, L); break;
-						// bit 1,(hl)
-						case 0x4E: BIT_N_DHL(1); break;
-						// bit 1,a
-						case 0x4F: BIT_N_R(1, A); break;
-						// bit 2,b
-						case 0x50: BIT_N_R(2, B); break;
-						// bit 2,c
-						case 0x51: BIT_N_R(2, C); break;
-						// bit 2,d
-						case 0x52: BIT_N_R(2, D); break;
-						// bit 2,e
-						case 0x53: BIT_N_R(2, E); break;
-						// bit 2,h
-						case 0x54: BIT_N_R(2, H); break;
-						// bit 2,l
-						case 0x55: BIT_N_R(2, L); break;
-						// bit 2,(hl)
-						case 0x56: BIT_N_DHL(2); break;
-						// bit 2,a
-						case 0x57: BIT_N_R(2, A); break;
-						// bit 3,b
-						case 0x58: BIT_N_R(3, B); break;
-						// bit 3,c
-						case 0x59: BIT_N_R(3, C); break;
-						// bit 3,d
-						case 0x5A: BIT_N_R(3, D); break;
-						// bit 3,e
-						case 0x5B: BIT_N_R(3, E); break;
-						// bit 3,h
-						case 0x5C: BIT_N_R(3, H); break;
-						// bit 3,l
-						case 0x5D: BIT_N_R(3, L); break;
-						// bit 3,(hl)
-						case 0x5E: BIT_N_DHL(3); break;
-						// bit 3,a
-						case 0x5F: BIT_N_R(3, A); break;
-						// bit 4,b
-						case 0x60: BIT_N_R(4, B); break;
-						// bit 4,c
-						case 0x61: BIT_N_R(4, C); break;
-						// bit 4,d
-						case 0x62: BIT_N_R(4, D); break;
-						// bit 4,e
-						case 0x63: BIT_N_R(4, E); break;
-						// bit 4,h
-						case 0x64: BIT_N_R(4, H); break;
-						// bit 4,l
-						case 0x65: BIT_N_R(4, L); break;
-						// bit 4,(hl)
-						case 0x66: BIT_N_DHL(4); break;
-						// bit 4,a
-						case 0x67: BIT_N_R(4, A); break;
-						// bit 5,b
-						case 0x68: BIT_N_R(5, B); break;
-						// bit 5,c
-						case 0x69: BIT_N_R(5, C); break;
-						// bit 5,d
-						case 0x6A: BIT_N_R(5, D); break;
-						// bit 5,e
-						case 0x6B: BIT_N_R(5, E); break;
-						// bit 5,h
-						case 0x6C: BIT_N_R(5, H); break;
-						// bit 5,l
-						case 0x6D: BIT_N_R(5, L); break;
-						// bit 5,(hl)
-						case 0x6E: BIT_N_DHL(5); break;
-						// bit 5,a
-						case 0x6F: BIT_N_R(5, A); break;
-						// bit 6,b
-						case 0x70: BIT_N_R(6, B); break;
-						// bit 6,c
-						case 0x71: BIT_N_R(6, C); break;
-						// bit 6,d
-						case 0x72: BIT_N_R(6, D); break;
-						// bit 6,e
-						case 0x73: BIT_N_R(6, E); break;
-						// bit 6,h
-						case 0x74: BIT_N_R(6, H); break;
-						// bit 6,l
-						case 0x75: BIT_N_R(6, L); break;
-						// bit 6,(hl)
-						case 0x76: BIT_N_DHL(6); break;
-						// bit 6,a
-						case 0x77: BIT_N_R(6, A); break;
-						// bit 7,b
-						case 0x78: BIT_N_R(7, B); break;
-						// bit 7,c
-						case 0x79: BIT_N_R(7, C); break;
-						// bit 7,d
-						case 0x7A: BIT_N_R(7, D); break;
-						// bit 7,e
-						case 0x7B: BIT_N_R(7, E); break;
-						// bit 7,h
-						case 0x7C: BIT_N_R(7, H); break;
-						// bit 7,l
-						case 0x7D: BIT_N_R(7, L); break;
-						// bit 7,(hl)
-						case 0x7E: BIT_N_DHL(7); break;
-						// bit 7,a
-						case 0x7F: BIT_N_R(7, A); break;
-						// res 0,b
-						case 0x80: RES_N_R(0, B); break;
-						// res 0,c
-						case 0x81: RES_N_R(0, C); break;
-						// res 0,d
-						case 0x82: RES_N_R(0, D); break;
-						// res 0,e
-						case 0x83: RES_N_R(0, E); break;
-						// res 0,h
-						case 0x84: RES_N_R(0, H); break;
-						// res 0,l
-						case 0x85: RES_N_R(0, L); break;
-						// res 0,(hl)
-						case 0x86: RES_N_DHL(0); break;
-						// res 0,a
-						case 0x87: RES_N_R(0, A); break;
-						// res 1,b
-						case 0x88: RES_N_R(1, B); break;
-						// res 1,c
-						case 0x89: RES_N_R(1, C); break;
-						// res 1,d
-						case 0x8A: RES_N_R(1, D); break;
-						// res 1,e
-						case 0x8B: RES_N_R(1, E); break;
-						// res 1,h
-						case 0x8C: RES_N_R(1, H); break;
-						// res 1,l
-						case 0x8D: RES_N_R(1, L); break;
-						// res 1,(hl)
-						case 0x8E: RES_N_DHL(1); break;
-						// res 1,a
-						case 0x8F: RES_N_R(1, A); break;
-						// res 2,b
-						case 0x90: RES_N_R(2, B); break;
-						// res 2,c
-						case 0x91: RES_N_R(2, C); break;
-						// res 2,d
-						case 0x92: RES_N_R(2, D); break;
-						// res 2,e
-						case 0x93: RES_N_R(2, E); break;
-						// res 2,h
-						case 0x94: RES_N_R(2, H); break;
-						// res 2,l
-						case 0x95: RES_N_R(2, L); break;
-						// res 2,(hl)
-						case 0x96: RES_N_DHL(2); break;
-						// res 2,a
-						case 0x97: RES_N_R(2, A); break;
-						// res 3,b
-						case 0x98: RES_N_R(3, B); break;
-						// res 3,c
-						case 0x99: RES_N_R(3, C); break;
-						// res 3,d
-						case 0x9A: RES_N_R(3, D); break;
-						// res 3,e
-						case 0x9B: RES_N_R(3, E); break;
-						// res 3,h
-						case 0x9C: RES_N_R(3, H); break;
-						// res 3,l
-						case 0x9D: RES_N_R(3, L); break;
-						// res 3,(hl)
-						case 0x9E: RES_N_DHL(3); break;
-						// res 3,a
-						case 0x9F: RES_N_R(3, A); break;
-						// res 4,b
-						case 0xA0: RES_N_R(4, B); break;
-						// res 4,c
-						case 0xA1: RES_N_R(4, C); break;
-						// res 4,d
-						case 0xA2: RES_N_R(4, D); break;
-						// res 4,e
-						case 0xA3: RES_N_R(4, E); break;
-						// res 4,h
-						case 0xA4: RES_N_R(4, H); break;
-						// res 4,l
-						case 0xA5: RES_N_R(4, L); break;
-						// res 4,(hl)
-						case 0xA6: RES_N_DHL(4); break;
-						// res 4,a
-						case 0xA7: RES_N_R(4, A); break;
-						// res 5,b
-						case 0xA8: RES_N_R(5, B); break;
-						// res 5,c
-						case 0xA9: RES_N_R(5, C); break;
-						// res 5,d
-						case 0xAA: RES_N_R(5, D); break;
-						// res 5,e
-						case 0xAB: RES_N_R(5, E); break;
-						// res 5,h
-						case 0xAC: RES_N_R(5, H); break;
-						// res 5,l
-						case 0xAD: RES_N_R(5, L); break;
-						// res 5,(hl)
-						case 0xAE: RES_N_DHL(5); break;
-						// res 5,a
-						case 0xAF: RES_N_R(5, A); break;
-						// res 6,b
-						case 0xB0: RES_N_R(6, B); break;
-						// res 6,c
-						case 0xB1: RES_N_R(6, C); break;
-						// res 6,d
-						case 0xB2: RES_N_R(6, D); break;
-						// res 6,e
-						case 0xB3: RES_N_R(6, E); break;
-						// res 6,h
-						case 0xB4: RES_N_R(6, H); break;
-						// res 6,l
-						case 0xB5: RES_N_R(6, L); break;
-						// res 6,(hl)
-						case 0xB6: RES_N_DHL(6); break;
-						// res 6,a
-						case 0xB7: RES_N_R(6, A); break;
-						// res 7,b
-						case 0xB8: RES_N_R(7, B); break;
-						// res 7,c
-						case 0xB9: RES_N_R(7, C); break;
-						// res 7,d
-						case 0xBA: RES_N_R(7, D); break;
-						// res 7,e
-						case 0xBB: RES_N_R(7, E); break;
-						// res 7,h
-						case 0xBC: RES_N_R(7, H); break;
-						// res 7,l
-						case 0xBD: RES_N_R(7, L); break;
-						// res 7,(hl)
-						case 0xBE: RES_N_DHL(7); break;
-						// res 7,a
-						case 0xBF: RES_N_R(7, A); break;
-						// set 0,b
-						case 0xC0: SET_N_R(0, B); break;
-						// set 0,c
-						case 0xC1: SET_N_R(0, C); break;
-						// set 0,d
-						case 0xC2: SET_N_R(0, D); break;
-						// set 0,e
-						case 0xC3: SET_N_R(0, E); break;
-						// set 0,h
-						case 0xC4: SET_N_R(0, H); break;
-						// set 0,l
-						case 0xC5: SET_N_R(0, L); break;
-						// set 0,(hl)
-						case 0xC6: SET_N_DHL(0); break;
-						// set 0,a
-						case 0xC7: SET_N_R(0, A); break;
-						// set 1,b
-						case 0xC8: SET_N_R(1, B); break;
-						// set 1,c
-						case 0xC9: SET_N_R(1, C); break;
-						// set 1,d
-						case 0xCA: SET_N_R(1, D); break;
-						// set 1,e
-						case 0xCB: SET_N_R(1, E); break;
-						// set 1,h
-						case 0xCC: SET_N_R(1, H); break;
-						// set 1,l
-						case 0xCD: SET_N_R(1, L); break;
-						// set 1,(hl)
-						case 0xCE: SET_N_DHL(1); break;
-						// set 1,a
-						case 0xCF: SET_N_R(1, A); break;
-						// set 2,b
-						case 0xD0: SET_N_R(2, B); break;
-						// set 2,c
-						case 0xD1: SET_N_R(2, C); break;
-						// set 2,d
-						case 0xD2: SET_N_R(2, D); break;
-						// set 2,e
-						case 0xD3: SET_N_R(2, E); break;
-						// set 2,h
-						case 0xD4: SET_N_R(2, H); break;
-						// set 2,l
-						case 0xD5: SET_N_R(2, L); break;
-						// set 2,(hl)
-						case 0xD6: SET_N_DHL(2); break;
-						// set 2,a
-						case 0xD7: SET_N_R(2, A); break;
-						// set 3,b
-						case 0xD8: SET_N_R(3, B); break;
-						// set 3,c
-						case 0xD9: SET_N_R(3, C); break;
-						// set 3,d
-						case 0xDA: SET_N_R(3, D); break;
-						// set 3,e
-						case 0xDB: SET_N_R(3, E); break;
-						// set 3,h
-						case 0xDC: SET_N_R(3, H); break;
-						// set 3,l
-						case 0xDD: SET_N_R(3, L); break;
-						// set 3,(hl)
-						case 0xDE: SET_N_DHL(3); break;
-						// set 3,a
-						case 0xDF: SET_N_R(3, A); break;
-						// set 4,b
-						case 0xE0: SET_N_R(4, B); break;
-						// set 4,c
-						case 0xE1: SET_N_R(4, C); break;
-						// set 4,d
-						case 0xE2: SET_N_R(4, D); break;
-						// set 4,e
-						case 0xE3: SET_N_R(4, E); break;
-						// set 4,h
-						case 0xE4: SET_N_R(4, H); break;
-						// set 4,l
-						case 0xE5: SET_N_R(4, L); break;
-						// set 4,(hl)
-						case 0xE6: SET_N_DHL(4); break;
-						// set 4,a
-						case 0xE7: SET_N_R(4, A); break;
-						// set 5,b
-						case 0xE8: SET_N_R(5, B); break;
-						// set 5,c
-						case 0xE9: SET_N_R(5, C); break;
-						// set 5,d
-						case 0xEA: SET_N_R(5, D); break;
-						// set 5,e
-						case 0xEB: SET_N_R(5, E); break;
-						// set 5,h
-						case 0xEC: SET_N_R(5, H); break;
-						// set 5,l
-						case 0xED: SET_N_R(5, L); break;
-						// set 5,(hl)
-						case 0xEE: SET_N_DHL(5); break;
-						// set 5,a
-						case 0xEF: SET_N_R(5, A); break;
-						// set 6,b
-						case 0xF0: SET_N_R(6, B); break;
-						// set 6,c
-						case 0xF1: SET_N_R(6, C); break;
-						// set 6,d
-						case 0xF2: SET_N_R(6, D); break;
-						// set 6,e
-						case 0xF3: SET_N_R(6, E); break;
-						// set 6,h
-						case 0xF4: SET_N_R(6, H); break;
-						// set 6,l
-						case 0xF5: SET_N_R(6, L); break;
-						// set 6,(hl)
-						case 0xF6: SET_N_DHL(6); break;
-						// set 6,a
-						case 0xF7: SET_N_R(6, A); break;
-						// set 7,b
-						case 0xF8: SET_N_R(7, B); break;
-						// set 7,c
-						case 0xF9: SET_N_R(7, C); break;
-						// set 7,d
-						case 0xFA: SET_N_R(7, D); break;
-						// set 7,e
-						case 0xFB: SET_N_R(7, E); break;
-						// set 7,h
-						case 0xFC: SET_N_R(7, H); break;
-						// set 7,l
-						case 0xFD: SET_N_R(7, L); break;
-						// set 7,(hl)
-						case 0xFE: SET_N_DHL(7); break;
-						// set 7,a
-						case 0xFF: SET_N_R(7, A); break;
-					}
-
+					size = 3;
+					absolute = true;
 					break;
 				}
-				// call z,nn
-				case 0xCC: CALL_CC_NN(REGS(F) & ZF_BIT); break;
-				// call nn
-				case 0xCD: CALL_CC_NN(true); break;
-				// adc a,n
-				case 0xCE: ADC_A_N(); break;
-				// rst 0x08
-				case 0xCF: RST(0x08); break;
-				// ret nc
-				case 0xD0: RET_CC(!(REGS(F) & CF_BIT)); break;
-				// pop de
-				case 0xD1: POP(D, E); break;
-				// jp nc,nn
-				case 0xD2: JP_CC_NN(!(REGS(F) & CF_BIT)); break;
-				// out (n),a
-				case 0xD3: OUT_DN_A(); break;
-				// call nc,nn
-				case 0xD4: CALL_CC_NN(!(REGS(F) & CF_BIT)); break;
-				// push de
-				case 0xD5: PUSH(D, E); break;
-				// sub a,n
-				case 0xD6: SUB_A_N(); break;
-				// rst 0x10
-				case 0xD7: RST(0x10); break;
-				// ret c
-				case 0xD8: RET_CC(REGS(F) & CF_BIT); break;
-				// exx
-				case 0xD9: EXX(); break;
-				// jp c,nn
-				case 0xDA: JP_CC_NN(REGS(F) & CF_BIT); break;
-				// in a,(n)
-				case 0xDB: IN_A_DN(); break;
-				// call c,nn
-				case 0xDC: CALL_CC_NN(REGS(F) & CF_BIT); break;
-				// 0xDD prefix
-				case 0xDD:
+				case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE:
 				{
-					FETCH(opcode, REGS(PC)++);
-					switch (opcode) {
-						// nop
-						case 0x00: break;
-						// ld bc,nn
-						case 0x01: LD_RR_NN(B, C); break;
-						// ld (bc),a
-						case 0x02: LD_DRR_A(BC); break;
-						// inc bc
-						case 0x03: INC_RR(BC); break;
-						// inc b
-						case 0x04: INC_R(B); break;
-						// dec b
-						case 0x05: DEC_R(B); break;
-						// ld b,n
-						case 0x06: LD_R_N(B); break;
-						// rlca
-						case 0x07: RLCA(); break;
-						// ex af,af'
-						case 0x08: EX_RR_ARR(AF); break;
-						// add ix,bc
-						case 0x09: ADD_RR_RR(IX, BC); break;
-						// ld a,(bc)
-						case 0x0A: LD_A_DRR(BC); break;
-						// dec bc
-						case 0x0B: DEC_RR(BC); break;
-						// inc c
-						case 0x0C: INC_R(C); break;
-						// dec c
-						case 0x0D: DEC_R(C); break;
-						// ld c,n
-						case 0x0E: LD_R_N(C); break;
-						// rrca
-						case 0x0F: RRCA(); break;
-						// djnz e
-						case 0x10: DJNZ_E(); break;
-						// ld de,nn
-						case 0x11: LD_RR_NN(D, E); break;
-						// ld (de),a
-						case 0x12: LD_DRR_A(DE); break;
-						// inc de
-						case 0x13: INC_RR(DE); break;
-						// inc d
-						case 0x14: INC_R(D); break;
-						// dec d
-						case 0x15: DEC_R(D); break;
-						// ld d,n
-						case 0x16: LD_R_N(D); break;
-						// rla
-						case 0x17: RLA(); break;
-						// jr e
-						case 0x18: JR_CC_E(true); break;
-						// add ix,de
-						case 0x19: ADD_RR_RR(IX, DE); break;
-						// ld a,(de)
-						case 0x1A: LD_A_DRR(DE); break;
-						// dec de
-						case 0x1B: DEC_RR(DE); break;
-						// inc e
-						case 0x1C: INC_R(E); break;
-						// dec e
-						case 0x1D: DEC_R(E); break;
-						// ld e,n
-						case 0x1E: LD_R_N(E); break;
-						// rra
-						case 0x1F: RRA(); break;
-						// jr nz,e
-						case 0x20: JR_CC_E(!(REGS(F) & ZF_BIT)); break;
-						// ld ix,nn
-						case 0x21: LD_RR_NN(IXH, IXL); break;
-						// ld (nn),ix
-						case 0x22: LD_DNN_RR(IXH, IXL); break;
-						// inc ix
-						case 0x23: INC_RR(IX); break;
-						// inc ixh
-						case 0x24: INC_R(IXH); break;
-						// dec ixh
-						case 0x25: DEC_R(IXH); break;
-						// ld ixh,n
-						case 0x26: LD_R_N(IXH); break;
-						// daa
-						case 0x27: DAA(); break;
-						// jr z,e
-						case 0x28: JR_CC_E(REGS(F) & ZF_BIT); break;
-						// add ix,ix
-						case 0x29: ADD_RR_RR(IX, IX); break;
-						// ld ix,(nn)
-						case 0x2A: LD_RR_DNN(IXH, IXL); break;
-						// dec ix
-						case 0x2B: DEC_RR(IX); break;
-						// inc ixl
-						case 0x2C: INC_R(IXL); break;
-						// dec ixl
-						case 0x2D: DEC_R(IXL); break;
-						// ld ixl,n
-						case 0x2E: LD_R_N(IXL); break;
-						// cpl
-						case 0x2F: CPL(); break;
-						// jr nc,e
-						case 0x30: JR_CC_E(!(REGS(F) & CF_BIT)); break;
-						// ld sp,nn
-						case 0x31: LD_RR_NN(SPH, SPL); break;
-						// ld (nn),a
-						case 0x32: LD_DNN_A(); break;
-						// inc sp
-						case 0x33: INC_RR(SP); break;
-						// inc (ix+e)
-						case 0x34: INC_DRR_E(IX); break;
-						// dec (ix+e)
-						case 0x35: DEC_DRR_E(IX); break;
-						// ld (ix+e),n
-						case 0x36: LD_DRR_E_N(IX); break;
-						// scf
-						case 0x37: SCF(); break;
-						// jr c,e
-						case 0x38: JR_CC_E(REGS(F) & CF_BIT); break;
-						// add ix,sp
-						case 0x39: ADD_RR_RR(IX, SP); break;
-						// ld a,(nn)
-						case 0x3A: LD_A_DNN(); break;
-						// dec sp
-						case 0x3B: DEC_RR(SP); break;
-						// inc a
-						case 0x3C: INC_R(A); break;
-						// dec a
-						case 0x3D: DEC_R(A); break;
-						// ld a,n
-						case 0x3E: LD_R_N(A); break;
-						// ccf
-						case 0x3F: CCF(); break;
-						// ld b,b
-						case 0x40: LD_R_R(B, B); break;
-						// ld b,c
-						case 0x41: LD_R_R(B, C); break;
-						// ld b,d
-						case 0x42: LD_R_R(B, D); break;
-						// ld b,e
-						case 0x43: LD_R_R(B, E); break;
-						// ld b,ixh
-						case 0x44: LD_R_R(B, IXH); break;
-						// ld b,ixl
-						case 0x45: LD_R_R(B, IXL); break;
-						// ld b,(ix+e)
-						case 0x46: LD_R_DRR_E(B, IX); break;
-						// ld b,a
-						case 0x47: LD_R_R(B, A); break;
-						// ld c,b
-						case 0x48: LD_R_R(C, B); break;
-						// ld c,c
-						case 0x49: LD_R_R(C, C); break;
-						// ld c,d
-						case 0x4A: LD_R_R(C, D); break;
-						// ld c,e
-						case 0x4B: LD_R_R(C, E); break;
-						// ld c,ixh
-						case 0x4C: LD_R_R(C, IXH); break;
-						// ld c,ixl
-						case 0x4D: LD_R_R(C, IXL); break;
-						// ld c,(ix+e)
-						case 0x4E: LD_R_DRR_E(C, IX); break;
-						// ld c,a
-						case 0x4F: LD_R_R(C, A); break;
-						// ld d,b
-						case 0x50: LD_R_R(D, B); break;
-						// ld d,c
-						case 0x51: LD_R_R(D, C); break;
-						// ld d,d
-						case 0x52: LD_R_R(D, D); break;
-						// ld d,e
-						case 0x53: LD_R_R(D, E); break;
-						// ld d,ixh
-						case 0x54: LD_R_R(D, IXH); break;
-						// ld d,ixl
-						case 0x55: LD_R_R(D, IXL); break;
-						// ld d,(ix+e)
-						case 0x56: LD_R_DRR_E(D, IX); break;
-						// ld d,a
-						case 0x57: LD_R_R(D, A); break;
-						// ld e,b
-						case 0x58: LD_R_R(E, B); break;
-						// ld e,c
-						case 0x59: LD_R_R(E, C); break;
-						// ld e,d
-						case 0x5A: LD_R_R(E, D); break;
-						// ld e,e
-						case 0x5B: LD_R_R(E, E); break;
-						// ld e,ixh
-						case 0x5C: LD_R_R(E, IXH); break;
-						// ld e,ixl
-						case 0x5D: LD_R_R(E, IXL); break;
-						// ld e,(ix+e)
-						case 0x5E: LD_R_DRR_E(E, IX); break;
-						// ld e,a
-						case 0x5F: LD_R_R(E, A); break;
-						// ld ixh,b
-						case 0x60: LD_R_R(IXH, B); break;
-						// ld ixh,c
-						case 0x61: LD_R_R(IXH, C); break;
-						// ld ixh,d
-						case 0x62: LD_R_R(IXH, D); break;
-						// ld ixh,e
-						case 0x63: LD_R_R(IXH, E); break;
-						// ld ixh,ixh
-						case 0x64: LD_R_R(IXH, IXH); break;
-						// ld ixh,ixl
-						case 0x65: LD_R_R(IXH, IXL); break;
-						// ld h,(ix+e)
-						case 0x66: LD_R_DRR_E(H, IX); break;
-						// ld ixh,a
-						case 0x67: LD_R_R(IXH, A); break;
-						// ld ixl,b
-						case 0x68: LD_R_R(IXL, B); break;
-						// ld ixl,c
-						case 0x69: LD_R_R(IXL, C); break;
-						// ld ixl,d
-						case 0x6A: LD_R_R(IXL, D); break;
-						// ld ixl,e
-						case 0x6B: LD_R_R(IXL, E); break;
-						// ld ixl,ixh
-						case 0x6C: LD_R_R(IXL, IXH); break;
-						// ld ixl,ixl
-						case 0x6D: LD_R_R(IXL, IXL); break;
-						// ld l,(ix+e)
-						case 0x6E: LD_R_DRR_E(L, IX); break;
-						// ld ixl,a
-						case 0x6F: LD_R_R(IXL, A); break;
-						// ld (ix+e),b
-						case 0x70: LD_DRR_E_R(IX, B); break;
-						// ld (ix+e),c
-						case 0x71: LD_DRR_E_R(IX, C); break;
-						// ld (ix+e),d
-						case 0x72: LD_DRR_E_R(IX, D); break;
-						// ld (ix+e),e
-						case 0x73: LD_DRR_E_R(IX, E); break;
-						// ld (ix+e),h
-						case 0x74: LD_DRR_E_R(IX, H); break;
-						// ld (ix+e),l
-						case 0x75: LD_DRR_E_R(IX, L); break;
-						// halt
-						case 0x76: HALT(); break;
-						// ld (ix+e),a
-						case 0x77: LD_DRR_E_R(IX, A); break;
-						// ld a,b
-						case 0x78: LD_R_R(A, B); break;
-						// ld a,c
-						case 0x79: LD_R_R(A, C); break;
-						// ld a,d
-						case 0x7A: LD_R_R(A, D); break;
-						// ld a,e
-						case 0x7B: LD_R_R(A, E); break;
-						// ld a,ixh
-						case 0x7C: LD_R_R(A, IXH); break;
-						// ld a,ixl
-						case 0x7D: LD_R_R(A, IXL); break;
-						// ld a,(ix+e)
-						case 0x7E: LD_R_DRR_E(A, IX); break;
-						// ld a,a
-						case 0x7F: LD_R_R(A, A); break;
-						// add a,b
-						case 0x80: ADD_A_R(B); break;
-						// add a,c
-						case 0x81: ADD_A_R(C); break;
-						// add a,d
-						case 0x82: ADD_A_R(D); break;
-						// add a,e
-						case 0x83: ADD_A_R(E); break;
-						// add a,ixh
-						case 0x84: ADD_A_R(IXH); break;
-						// add a,ixl
-						case 0x85: ADD_A_R(IXL); break;
-						// add a,(ix+e)
-						case 0x86: ADD_A_DRR_E(IX); break;
-						// add a,a
-						case 0x87: ADD_A_R(A); break;
-						// adc a,b
-						case 0x88: ADC_A_R(B); break;
-						// adc a,c
-						case 0x89: ADC_A_R(C); break;
-						// adc a,d
-						case 0x8A: ADC_A_R(D); break;
-						// adc a,e
-						case 0x8B: ADC_A_R(E); break;
-						// adc a,ixh
-						case 0x8C: ADC_A_R(IXH); break;
-						// adc a,ixl
-						case 0x8D: ADC_A_R(IXL); break;
-						// adc a,(ix+e)
-						case 0x8E: ADC_A_DRR_E(IX); break;
-						// adc a,a
-						case 0x8F: ADC_A_R(A); break;
-						// sub a,b
-						case 0x90: SUB_A_R(B); break;
-						// sub a,c
-						case 0x91: SUB_A_R(C); break;
-						// sub a,d
-						case 0x92: SUB_A_R(D); break;
-						// sub a,e
-						case 0x93: SUB_A_R(E); break;
-						// sub a,ixh
-						case 0x94: SUB_A_R(IXH); break;
-						// sub a,ixl
-						case 0x95: SUB_A_R(IXL); break;
-						// sub a,(ix+e)
-						case 0x96: SUB_A_DRR_E(IX); break;
-						// sub a,a
-						case 0x97: SUB_A_R(A); break;
-						// sbc a,b
-						case 0x98: SBC_A_R(B); break;
-						// sbc a,c
-						case 0x99: SBC_A_R(C); break;
-						// sbc a,d
-						case 0x9A: SBC_A_R(D); break;
-						// sbc a,e
-						case 0x9B: SBC_A_R(E); break;
-						// sbc a,ixh
-						case 0x9C: SBC_A_R(IXH); break;
-						// sbc a,ixl
-						case 0x9D: SBC_A_R(IXL); break;
-						// sbc a,(ix+e)
-						case 0x9E: SBC_A_DRR_E(IX); break;
-						// sbc a,a
-						case 0x9F: SBC_A_R(A); break;
-						// and a,b
-						case 0xA0: AND_A_R(B); break;
-						// and a,c
-						case 0xA1: AND_A_R(C); break;
-						// and a,d
-						case 0xA2: AND_A_R(D); break;
-						// and a,e
-						case 0xA3: AND_A_R(E); break;
-						// and a,ixh
-						case 0xA4: AND_A_R(IXH); break;
-						// and a,ixl
-						case 0xA5: AND_A_R(IXL); break;
-						// and a,(ix+e)
-						case 0xA6: AND_A_DRR_E(IX); break;
-						// and a,a
-						case 0xA7: AND_A_R(A); break;
-						// xor a,b
-						case 0xA8: XOR_A_R(B); break;
-						// xor a,c
-						case 0xA9: XOR_A_R(C); break;
-						// xor a,d
-						case 0xAA: XOR_A_R(D); break;
-						// xor a,e
-						case 0xAB: XOR_A_R(E); break;
-						// xor a,ixh
-						case 0xAC: XOR_A_R(IXH); break;
-						// xor a,ixl
-						case 0xAD: XOR_A_R(IXL); break;
-						// xor a,(ix+e)
-						case 0xAE: XOR_A_DRR_E(IX); break;
-						// xor a,a
-						case 0xAF: XOR_A_R(A); break;
-						// or a,b
-						case 0xB0: OR_A_R(B); break;
-						// or a,c
-						case 0xB1: OR_A_R(C); break;
-						// or a,d
-						case 0xB2: OR_A_R(D); break;
-						// or a,e
-						case 0xB3: OR_A_R(E); break;
-						// or a,ixh
-						case 0xB4: OR_A_R(IXH); break;
-						// or a,ixl
-						case 0xB5: OR_A_R(IXL); break;
-						// or a,(ix+e)
-						case 0xB6: OR_A_DRR_E(IX); break;
-						// or a,a
-						case 0xB7: OR_A_R(A); break;
-						// cp a,b
-						case 0xB8: CP_A_R(B); break;
-						// cp a,c
-						case 0xB9: CP_A_R(C); break;
-						// cp a,d
-						case 0xBA: CP_A_R(D); break;
-						// cp a,e
-						case 0xBB: CP_A_R(E); break;
-						// cp a,ixh
-						case 0xBC: CP_A_R(IXH); break;
-						// cp a,ixl
-						case 0xBD: CP_A_R(IXL); break;
-						// cp a,(ix+e)
-						case 0xBE: CP_A_DRR_E(IX); break;
-						// cp a,a
-						case 0xBF: CP_A_R(A); break;
-						// ret nz
-						case 0xC0: RET_CC(!(REGS(F) & ZF_BIT)); break;
-						// pop bc
-						case 0xC1: POP(B, C); break;
-						// jp nz,nn
-						case 0xC2: JP_CC_NN(!(REGS(F) & ZF_BIT)); break;
-						// jp nn
-						case 0xC3: JP_CC_NN(true); break;
-						// call nz,nn
-						case 0xC4: CALL_CC_NN(!(REGS(F) & ZF_BIT)); break;
-						// push bc
-						case 0xC5: PUSH(B, C); break;
-						// add a,n
-						case 0xC6: ADD_A_N(); break;
-						// rst 0x00
-						case 0xC7: RST(0x00); break;
-						// ret z
-						case 0xC8: RET_CC(REGS(F) & ZF_BIT); break;
-						// ret
-						case 0xC9: RET(); break;
-						// jp z,nn
-						case 0xCA: JP_CC_NN(REGS(F) & ZF_BIT); break;
-						// 0xDDCB prefix
-						case 0xCB:
-						{
-							u8 e;
-							READ(e, REGS(PC)++);
-							READ(opcode, REGS(PC)++);
-							cycleCount += 2;
-							REGS(WZ) = REGS(IX) + SIGNED(e, s8);
-							switch (opcode) {
-								// rlc (ix+e),b
-								case 0x00: RLC_DRR_E_R(B); break;
-								// rlc (ix+e),c
-								case 0x01: RLC_DRR_E_R(C); break;
-								// rlc (ix+e),d
-								case 0x02: RLC_DRR_E_R(D); break;
-								// rlc (ix+e),e
-								case 0x03: RLC_DRR_E_R(E); break;
-								// rlc (ix+e),h
-								case 0x04: RLC_DRR_E_R(H); break;
-								// rlc (ix+e),l
-								case 0x05: RLC_DRR_E_R(L); break;
-								// rlc (ix+e)
-								case 0x06: RLC_DRR_E(); break;
-								// rlc (ix+e),a
-								case 0x07: RLC_DRR_E_R(A); break;
-								// rrc (ix+e),b
-								case 0x08: RRC_DRR_E_R(B); break;
-								// rrc (ix+e),c
-								case 0x09: RRC_DRR_E_R(C); break;
-								// rrc (ix+e),d
-								case 0x0A: RRC_DRR_E_R(D); break;
-								// rrc (ix+e),e
-								case 0x0B: RRC_DRR_E_R(E); break;
-								// rrc (ix+e),h
-								case 0x0C: RRC_DRR_E_R(H); break;
-								// rrc (ix+e),l
-								case 0x0D: RRC_DRR_E_R(L); break;
-								// rrc (ix+e)
-								case 0x0E: RRC_DRR_E(); break;
-								// rrc (ix+e),a
-								case 0x0F: RRC_DRR_E_R(A); break;
-								// rl (ix+e),b
-								case 0x10: RL_DRR_E_R(B); break;
-								// rl (ix+e),c
-								case 0x11: RL_DRR_E_R(C); break;
-								// rl (ix+e),d
-								case 0x12: RL_DRR_E_R(D); break;
-								// rl (ix+e),e
-								case 0x13: RL_DRR_E_R(E); break;
-								// rl (ix+e),h
-								case 0x14: RL_DRR_E_R(H); break;
-								// rl (ix+e),l
-								case 0x15: RL_DRR_E_R(L); break;
-								// rl (ix+e)
-								case 0x16: RL_DRR_E(); break;
-								// rl (ix+e),a
-								case 0x17: RL_DRR_E_R(A); break;
-								// rr (ix+e),b
-								case 0x18: RR_DRR_E_R(B); break;
-								// rr (ix+e),c
-								case 0x19: RR_DRR_E_R(C); break;
-								// rr (ix+e),d
-								case 0x1A: RR_DRR_E_R(D); break;
-								// rr (ix+e),e
-								case 0x1B: RR_DRR_E_R(E); break;
-								// rr (ix+e),h
-								case 0x1C: RR_DRR_E_R(H); break;
-								// rr (ix+e),l
-								case 0x1D: RR_DRR_E_R(L); break;
-								// rr (ix+e)
-								case 0x1E: RR_DRR_E(); break;
-								// rr (ix+e),a
-								case 0x1F: RR_DRR_E_R(A); break;
-								// sla (ix+e),b
-								case 0x20: SLA_DRR_E_R(B); break;
-								// sla (ix+e),c
-								case 0x21: SLA_DRR_E_R(C); break;
-								// sla (ix+e),d
-								case 0x22: SLA_DRR_E_R(D); break;
-								// sla (ix+e),e
-								case 0x23: SLA_DRR_E_R(E); break;
-								// sla (ix+e),h
-								case 0x24: SLA_DRR_E_R(H); break;
-								// sla (ix+e),l
-								case 0x25: SLA_DRR_E_R(L); break;
-								// sla (ix+e)
-								case 0x26: SLA_DRR_E(); break;
-								// sla (ix+e),a
-								case 0x27: SLA_DRR_E_R(A); break;
-								// sra (ix+e),b
-								case 0x28: SRA_DRR_E_R(B); break;
-								// sra (ix+e),c
-								case 0x29: SRA_DRR_E_R(C); break;
-								// sra (ix+e),d
-								case 0x2A: SRA_DRR_E_R(D); break;
-								// sra (ix+e),e
-								case 0x2B: SRA_DRR_E_R(E); break;
-								// sra (ix+e),h
-								case 0x2C: SRA_DRR_E_R(H); break;
-								// sra (ix+e),l
-								case 0x2D: SRA_DRR_E_R(L); break;
-								// sra (ix+e)
-								case 0x2E: SRA_DRR_E(); break;
-								// sra (ix+e),a
-								case 0x2F: SRA_DRR_E_R(A); break;
-								// sll (ix+e),b
-								case 0x30: SLL_DRR_E_R(B); break;
-								// sll (ix+e),c
-								case 0x31: SLL_DRR_E_R(C); break;
-								// sll (ix+e),d
-								case 0x32: SLL_DRR_E_R(D); break;
-								// sll (ix+e),e
-								case 0x33: SLL_DRR_E_R(E); break;
-								// sll (ix+e),h
-								case 0x34: SLL_DRR_E_R(H); break;
-								// sll (ix+e),l
-								case 0x35: SLL_DRR_E_R(L); break;
-								// sll (ix+e)
-								case 0x36: SLL_DRR_E(); break;
-								// sll (ix+e),a
-								case 0x37: SLL_DRR_E_R(A); break;
-								// srl (ix+e),b
-								case 0x38: SRL_DRR_E_R(B); break;
-								// srl (ix+e),c
-								case 0x39: SRL_DRR_E_R(C); break;
-								// srl (ix+e),d
-								case 0x3A: SRL_DRR_E_R(D); break;
-								// srl (ix+e),e
-								case 0x3B: SRL_DRR_E_R(E); break;
-								// srl (ix+e),h
-								case 0x3C: SRL_DRR_E_R(H); break;
-								// srl (ix+e),l
-								case 0x3D: SRL_DRR_E_R(L); break;
-								// srl (ix+e)
-								case 0x3E: SRL_DRR_E(); break;
-								// srl (ix+e),a
-								case 0x3F: SRL_DRR_E_R(A); break;
-								// bit 0,(ix+e)
-								case 0x40: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x41: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x42: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x43: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x44: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x45: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x46: BIT_N_DRR_E(0); break;
-								// bit 0,(ix+e)
-								case 0x47: BIT_N_DRR_E(0); break;
-								// bit 1,(ix+e)
-								case 0x48: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x49: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4A: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4B: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4C: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4D: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4E: BIT_N_DRR_E(1); break;
-								// bit 1,(ix+e)
-								case 0x4F: BIT_N_DRR_E(1); break;
-								// bit 2,(ix+e)
-								case 0x50: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x51: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x52: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x53: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x54: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x55: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x56: BIT_N_DRR_E(2); break;
-								// bit 2,(ix+e)
-								case 0x57: BIT_N_DRR_E(2); break;
-								// bit 3,(ix+e)
-								case 0x58: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x59: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5A: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5B: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5C: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5D: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5E: BIT_N_DRR_E(3); break;
-								// bit 3,(ix+e)
-								case 0x5F: BIT_N_DRR_E(3); break;
-								// bit 4,(ix+e)
-								case 0x60: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x61: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x62: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x63: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x64: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x65: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x66: BIT_N_DRR_E(4); break;
-								// bit 4,(ix+e)
-								case 0x67: BIT_N_DRR_E(4); break;
-								// bit 5,(ix+e)
-								case 0x68: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x69: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6A: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6B: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6C: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6D: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6E: BIT_N_DRR_E(5); break;
-								// bit 5,(ix+e)
-								case 0x6F: BIT_N_DRR_E(5); break;
-								// bit 6,(ix+e)
-								case 0x70: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x71: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x72: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x73: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x74: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x75: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x76: BIT_N_DRR_E(6); break;
-								// bit 6,(ix+e)
-								case 0x77: BIT_N_DRR_E(6); break;
-								// bit 7,(ix+e)
-								case 0x78: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x79: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7A: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7B: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7C: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7D: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7E: BIT_N_DRR_E(7); break;
-								// bit 7,(ix+e)
-								case 0x7F: BIT_N_DRR_E(7); break;
-								// res 0,(ix+e),b
-								case 0x80: RES_N_DRR_E_R(0, B); break;
-								// res 0,(ix+e),c
-								case 0x81: RES_N_DRR_E_R(0, C); break;
-								// res 0,(ix+e),d
-								case 0x82: RES_N_DRR_E_R(0, D); break;
-								// res 0,(ix+e),e
-								case 0x83: RES_N_DRR_E_R(0, E); break;
-								// res 0,(ix+e),h
-								case 0x84: RES_N_DRR_E_R(0, H); break;
-								// res 0,(ix+e),l
-								case 0x85: RES_N_DRR_E_R(0, L); break;
-								// res 0,(ix+e)
-								case 0x86: RES_N_DRR_E(0); break;
-								// res 0,(ix+e),a
-								case 0x87: RES_N_DRR_E_R(0, A); break;
-								// res 1,(ix+e),b
-								case 0x88: RES_N_DRR_E_R(1, B); break;
-								// res 1,(ix+e),c
-								case 0x89: RES_N_DRR_E_R(1, C); break;
-								// res 1,(ix+e),d
-								case 0x8A: RES_N_DRR_E_R(1, D); break;
-								// res 1,(ix+e),e
-								case 0x8B: RES_N_DRR_E_R(1, E); break;
-								// res 1,(ix+e),h
-								case 0x8C: RES_N_DRR_E_R(1, H); break;
-								// res 1,(ix+e),l
-								case 0x8D: RES_N_DRR_E_R(1, L); break;
-								// res 1,(ix+e)
-								case 0x8E: RES_N_DRR_E(1); break;
-								// res 1,(ix+e),a
-								case 0x8F: RES_N_DRR_E_R(1, A); break;
-								// res 2,(ix+e),b
-								case 0x90: RES_N_DRR_E_R(2, B); break;
-								// res 2,(ix+e),c
-								case 0x91: RES_N_DRR_E_R(2, C); break;
-								// res 2,(ix+e),d
-								case 0x92: RES_N_DRR_E_R(2, D); break;
-								// res 2,(ix+e),e
-								case 0x93: RES_N_DRR_E_R(2, E); break;
-								// res 2,(ix+e),h
-								case 0x94: RES_N_DRR_E_R(2, H); break;
-								// res 2,(ix+e),l
-								case 0x95: RES_N_DRR_E_R(2, L); break;
-								// res 2,(ix+e)
-								case 0x96: RES_N_DRR_E(2); break;
-								// res 2,(ix+e),a
-								case 0x97: RES_N_DRR_E_R(2, A); break;
-								// res 3,(ix+e),b
-								case 0x98: RES_N_DRR_E_R(3, B); break;
-								// res 3,(ix+e),c
-								case 0x99: RES_N_DRR_E_R(3, C); break;
-								// res 3,(ix+e),d
-								case 0x9A: RES_N_DRR_E_R(3, D); break;
-								// res 3,(ix+e),e
-								case 0x9B: RES_N_DRR_E_R(3, E); break;
-								// res 3,(ix+e),h
-								case 0x9C: RES_N_DRR_E_R(3, H); break;
-								// res 3,(ix+e),l
-								case 0x9D: RES_N_DRR_E_R(3, L); break;
-								// res 3,(ix+e)
-								case 0x9E: RES_N_DRR_E(3); break;
-								// res 3,(ix+e),a
-								case 0x9F: RES_N_DRR_E_R(3, A); break;
-								// res 4,(ix+e),b
-								case 0xA0: RES_N_DRR_E_R(4, B); break;
-								// res 4,(ix+e),c
-								case 0xA1: RES_N_DRR_E_R(4, C); break;
-								// res 4,(ix+e),d
-								case 0xA2: RES_N_DRR_E_R(4, D); break;
-								// res 4,(ix+e),e
-								case 0xA3: RES_N_DRR_E_R(4, E); break;
-								// res 4,(ix+e),h
-								case 0xA4: RES_N_DRR_E_R(4, H); break;
-								// res 4,(ix+e),l
-								case 0xA5: RES_N_DRR_E_R(4, L); break;
-								// res 4,(ix+e)
-								case 0xA6: RES_N_DRR_E(4); break;
-								// res 4,(ix+e),a
-								case 0xA7: RES_N_DRR_E_R(4, A); break;
-								// res 5,(ix+e),b
-								case 0xA8: RES_N_DRR_E_R(5, B); break;
-								// res 5,(ix+e),c
-								case 0xA9: RES_N_DRR_E_R(5, C); break;
-								// res 5,(ix+e),d
-								case 0xAA: RES_N_DRR_E_R(5, D); break;
-								// res 5,(ix+e),e
-								case 0xAB: RES_N_DRR_E_R(5, E); break;
-								// res 5,(ix+e),h
-								case 0xAC: RES_N_DRR_E_R(5, H); break;
-								// res 5,(ix+e),l
-								case 0xAD: RES_N_DRR_E_R(5, L); break;
-								// res 5,(ix+e)
-								case 0xAE: RES_N_DRR_E(5); break;
-								// res 5,(ix+e),a
-								case 0xAF: RES_N_DRR_E_R(5, A); break;
-								// res 6,(ix+e),b
-								case 0xB0: RES_N_DRR_E_R(6, B); break;
-								// res 6,(ix+e),c
-								case 0xB1: RES_N_DRR_E_R(6, C); break;
-								// res 6,(ix+e),d
-								case 0xB2: RES_N_DRR_E_R(6, D); break;
-								// res 6,(ix+e),e
-								case 0xB3: RES_N_DRR_E_R(6, E); break;
-								// res 6,(ix+e),h
-								case 0xB4: RES_N_DRR_E_R(6, H); break;
-								// res 6,(ix+e),l
-								case 0xB5: RES_N_DRR_E_R(6, L); break;
-								// res 6,(ix+e)
-								case 0xB6: RES_N_DRR_E(6); break;
-								// res 6,(ix+e),a
-								case 0xB7: RES_N_DRR_E_R(6, A); break;
-								// res 7,(ix+e),b
-								case 0xB8: RES_N_DRR_E_R(7, B); break;
-								// res 7,(ix+e),c
-								case 0xB9: RES_N_DRR_E_R(7, C); break;
-								// res 7,(ix+e),d
-								case 0xBA: RES_N_DRR_E_R(7, D); break;
-								// res 7,(ix+e),e
-								case 0xBB: RES_N_DRR_E_R(7, E); break;
-								// res 7,(ix+e),h
-								case 0xBC: RES_N_DRR_E_R(7, H); break;
-								// res 7,(ix+e),l
-								case 0xBD: RES_N_DRR_E_R(7, L); break;
-								// res 7,(ix+e)
-								case 0xBE: RES_N_DRR_E(7); break;
-								// res 7,(ix+e),a
-								case 0xBF: RES_N_DRR_E_R(7, A); break;
-								// set 0,(ix+e),b
-								case 0xC0: SET_N_DRR_E_R(0, B); break;
-								// set 0,(ix+e),c
-								case 0xC1: SET_N_DRR_E_R(0, C); break;
-								// set 0,(ix+e),d
-								case 0xC2: SET_N_DRR_E_R(0, D); break;
-								// set 0,(ix+e),e
-								case 0xC3: SET_N_DRR_E_R(0, E); break;
-								// set 0,(ix+e),h
-								case 0xC4: SET_N_DRR_E_R(0, H); break;
-								// set 0,(ix+e),l
-								case 0xC5: SET_N_DRR_E_R(0, L); break;
-								// set 0,(ix+e)
-								case 0xC6: SET_N_DRR_E(0); break;
-								// set 0,(ix+e),a
-								case 0xC7: SET_N_DRR_E_R(0, A); break;
-								// set 1,(ix+e),b
-								case 0xC8: SET_N_DRR_E_R(1, B); break;
-								// set 1,(ix+e),c
-								case 0xC9: SET_N_DRR_E_R(1, C); break;
-								// set 1,(ix+e),d
-								case 0xCA: SET_N_DRR_E_R(1, D); break;
-								// set 1,(ix+e),e
-								case 0xCB: SET_N_DRR_E_R(1, E); break;
-								// set 1,(ix+e),h
-								case 0xCC: SET_N_DRR_E_R(1, H); break;
-								// set 1,(ix+e),l
-								case 0xCD: SET_N_DRR_E_R(1, L); break;
-								// set 1,(ix+e)
-								case 0xCE: SET_N_DRR_E(1); break;
-								// set 1,(ix+e),a
-								case 0xCF: SET_N_DRR_E_R(1, A); break;
-								// set 2,(ix+e),b
-								case 0xD0: SET_N_DRR_E_R(2, B); break;
-								// set 2,(ix+e),c
-								case 0xD1: SET_N_DRR_E_R(2, C); break;
-								// set 2,(ix+e),d
-								case 0xD2: SET_N_DRR_E_R(2, D); break;
-								// set 2,(ix+e),e
-								case 0xD3: SET_N_DRR_E_R(2, E); break;
-								// set 2,(ix+e),h
-								case 0xD4: SET_N_DRR_E_R(2, H); break;
-								// set 2,(ix+e),l
-								case 0xD5: SET_N_DRR_E_R(2, L); break;
-								// set 2,(ix+e)
-								case 0xD6: SET_N_DRR_E(2); break;
-								// set 2,(ix+e),a
-								case 0xD7: SET_N_DRR_E_R(2, A); break;
-								// set 3,(ix+e),b
-								case 0xD8: SET_N_DRR_E_R(3, B); break;
-								// set 3,(ix+e),c
-								case 0xD9: SET_N_DRR_E_R(3, C); break;
-								// set 3,(ix+e),d
-								case 0xDA: SET_N_DRR_E_R(3, D); break;
-								// set 3,(ix+e),e
-								case 0xDB: SET_N_DRR_E_R(3, E); break;
-								// set 3,(ix+e),h
-								case 0xDC: SET_N_DRR_E_R(3, H); break;
-								// set 3,(ix+e),l
-								case 0xDD: SET_N_DRR_E_R(3, L); break;
-								// set 3,(ix+e)
-								case 0xDE: SET_N_DRR_E(3); break;
-								// set 3,(ix+e),a
-								case 0xDF: SET_N_DRR_E_R(3, A); break;
-								// set 4,(ix+e),b
-								case 0xE0: SET_N_DRR_E_R(4, B); break;
-								// set 4,(ix+e),c
-								case 0xE1: SET_N_DRR_E_R(4, C); break;
-								// set 4,(ix+e),d
-								case 0xE2: SET_N_DRR_E_R(4, D); break;
-								// set 4,(ix+e),e
-								case 0xE3: SET_N_DRR_E_R(4, E); break;
-								// set 4,(ix+e),h
-								case 0xE4: SET_N_DRR_E_R(4, H); break;
-								// set 4,(ix+e),l
-								case 0xE5: SET_N_DRR_E_R(4, L); break;
-								// set 4,(ix+e)
-								case 0xE6: SET_N_DRR_E(4); break;
-								// set 4,(ix+e),a
-								case 0xE7: SET_N_DRR_E_R(4, A); break;
-								// set 5,(ix+e),b
-								case 0xE8: SET_N_DRR_E_R(5, B); break;
-								// set 5,(ix+e),c
-								case 0xE9: SET_N_DRR_E_R(5, C); break;
-								// set 5,(ix+e),d
-								case 0xEA: SET_N_DRR_E_R(5, D); break;
-								// set 5,(ix+e),e
-								case 0xEB: SET_N_DRR_E_R(5, E); break;
-								// set 5,(ix+e),h
-								case 0xEC: SET_N_DRR_E_R(5, H); break;
-								// set 5,(ix+e),l
-								case 0xED: SET_N_DRR_E_R(5, L); break;
-								// set 5,(ix+e)
-								case 0xEE: SET_N_DRR_E(5); break;
-								// set 5,(ix+e),a
-								case 0xEF: SET_N_DRR_E_R(5, A); break;
-								// set 6,(ix+e),b
-								case 0xF0: SET_N_DRR_E_R(6, B); break;
-								// set 6,(ix+e),c
-								case 0xF1: SET_N_DRR_E_R(6, C); break;
-								// set 6,(ix+e),d
-								case 0xF2: SET_N_DRR_E_R(6, D); break;
-								// set 6,(ix+e),e
-								case 0xF3: SET_N_DRR_E_R(6, E); break;
-								// set 6,(ix+e),h
-								case 0xF4: SET_N_DRR_E_R(6, H); break;
-								// set 6,(ix+e),l
-								case 0xF5: SET_N_DRR_E_R(6, L); break;
-								// set 6,(ix+e)
-								case 0xF6: SET_N_DRR_E(6); break;
-								// set 6,(ix+e),a
-								case 0xF7: SET_N_DRR_E_R(6, A); break;
-								// set 7,(ix+e),b
-								case 0xF8: SET_N_DRR_E_R(7, B); break;
-								// set 7,(ix+e),c
-								case 0xF9: SET_N_DRR_E_R(7, C); break;
-								// set 7,(ix+e),d
-								case 0xFA: SET_N_DRR_E_R(7, D); break;
-								// set 7,(ix+e),e
-								case 0xFB: SET_N_DRR_E_R(7, E); break;
-								// set 7,(ix+e),h
-								case 0xFC: SET_N_DRR_E_R(7, H); break;
-								// set 7,(ix+e),l
-								case 0xFD: SET_N_DRR_E_R(7, L); break;
-								// set 7,(ix+e)
-								case 0xFE: SET_N_DRR_E(7); break;
-								// set 7,(ix+e),a
-								case 0xFF: SET_N_DRR_E_R(7, A); break;
-							}
-
-							break;
-						}
-						// call z,nn
-						case 0xCC: CALL_CC_NN(REGS(F) & ZF_BIT); break;
-						// call nn
-						case 0xCD: CALL_CC_NN(true); break;
-						// adc a,n
-						case 0xCE: ADC_A_N(); break;
-						// rst 0x08
-						case 0xCF: RST(0x08); break;
-						// ret nc
-						case 0xD0: RET_CC(!(REGS(F) & CF_BIT)); break;
-						// pop de
-						case 0xD1: POP(D, E); break;
-						// jp nc,nn
-						case 0xD2: JP_CC_NN(!(REGS(F) & CF_BIT)); break;
-						// out (n),a
-						case 0xD3: OUT_DN_A(); break;
-						// call nc,nn
-						case 0xD4: CALL_CC_NN(!(REGS(F) & CF_BIT)); break;
-						// push de
-						case 0xD5: PUSH(D, E); break;
-						// sub a,n
-						case 0xD6: SUB_A_N(); break;
-						// rst 0x10
-						case 0xD7: RST(0x10); break;
-						// ret c
-						case 0xD8: RET_CC(REGS(F) & CF_BIT); break;
-						// exx
-						case 0xD9: EXX(); break;
-						// jp c,nn
-						case 0xDA: JP_CC_NN(REGS(F) & CF_BIT); break;
-						// in a,(n)
-						case 0xDB: IN_A_DN(); break;
-						// call c,nn
-						case 0xDC: CALL_CC_NN(REGS(F) & CF_BIT); break;
-						// 0xDD prefix
-						case 0xDD: REPEAT_PREFIX(); break;
-						// sbc a,n
-						case 0xDE: SBC_A_N(); break;
-						// rst 0x18
-						case 0xDF: RST(0x18); break;
-						// ret po
-						case 0xE0: RET_CC(!(REGS(F) & PF_BIT)); break;
-						// pop ix
-						case 0xE1: POP(IXH, IXL); break;
-						// jp po,nn
-						case 0xE2: JP_CC_NN(!(REGS(F) & PF_BIT)); break;
-						// ex (sp),ix
-						case 0xE3: EX_DSP_RR(IXH, IXL); break;
-						// call po,nn
-						case 0xE4: CALL_CC_NN(!(REGS(F) & PF_BIT)); break;
-						// push ix
-						case 0xE5: PUSH(IXH, IXL); break;
-						// and a,n
-						case 0xE6: AND_A_N(); break;
-						// rst 0x20
-						case 0xE7: RST(0x20); break;
-						// ret pe
-						case 0xE8: RET_CC(REGS(F) & PF_BIT); break;
-						// jp ix
-						case 0xE9: JP_RR(IX); break;
-						// jp pe,nn
-						case 0xEA: JP_CC_NN(REGS(F) & PF_BIT); break;
-						// ex de,hl
-						case 0xEB: EX_DE_HL(); break;
-						// call pe,nn
-						case 0xEC: CALL_CC_NN(REGS(F) & PF_BIT); break;
-						// 0xED prefix
-						case 0xED: REPEAT_PREFIX(); break;
-						// xor a,n
-						case 0xEE: XOR_A_N(); break;
-						// rst 0x28
-						case 0xEF: RST(0x28); break;
-						// ret p
-						case 0xF0: RET_CC(!(REGS(F) & SF_BIT)); break;
-						// pop af
-						case 0xF1: POP(A, F); break;
-						// jp p,nn
-						case 0xF2: JP_CC_NN(!(REGS(F) & SF_BIT)); break;
-						// di
-						case 0xF3: DI(); break;
-						// call p,nn
-						case 0xF4: CALL_CC_NN(!(REGS(F) & SF_BIT)); break;
-						// push af
-						case 0xF5: PUSH(A, F); break;
-						// or a,n
-						case 0xF6: OR_A_N(); break;
-						// rst 0x30
-						case 0xF7: RST(0x30); break;
-						// ret m
-						case 0xF8: RET_CC(REGS(F) & SF_BIT); break;
-						// ld sp,ix
-						case 0xF9: LD_SP_RR(IX); break;
-						// jp m,nn
-						case 0xFA: JP_CC_NN(REGS(F) & SF_BIT); break;
-						// ei
-						case 0xFB: EI(); break;
-						// call m,nn
-						case 0xFC: CALL_CC_NN(REGS(F) & SF_BIT); break;
-						// 0xFD prefix
-						case 0xFD: REPEAT_PREFIX(); break;
-						// cp a,n
-						case 0xFE: CP_A_N(); break;
-						// rst 0x38
-						case 0xFF: RST(0x38); break;
+					size = 2;
+					break;
+				}
+				case 0xD9: case 0xEB: case 0xF9:
+				{
+					break; // exx, ex de,hl, ld sp,hl
+				}
+				case 0xDB:
+				{
+					if (i + 1 >= len || !PortReadIsPure(TI83, code[i + 1])) {
+						return false;
 					}
-
+					size = 2;
 					break;
 				}
-				// sbc a,n
-				case 0xDE: SBC_A_N(); break;
-				// rst 0x18
-				case 0xDF: RST(0x18); break;
-				// ret po
-				case 0xE0: RET_CC(!(REGS(F) & PF_BIT)); break;
-				// pop hl
-				case 0xE1: POP(H, L); break;
-				// jp po,nn
-				case 0xE2: JP_CC_NN(!(REGS(F) & PF_BIT)); break;
-				// ex (sp),hl
-				case 0xE3: EX_DSP_RR(H, L); break;
-				// call po,nn
-				case 0xE4: CALL_CC_NN(!(REGS(F) & PF_BIT)); break;
-				// push hl
-				case 0xE5: PUSH(H, L); break;
-				// and a,n
-				case 0xE6: AND_A_N(); break;
-				// rst 0x20
-				case 0xE7: RST(0x20); break;
-				// ret pe
-				case 0xE8: RET_CC(REGS(F) & PF_BIT); break;
-				// jp hl
-				case 0xE9: JP_RR(HL); break;
-				// jp pe,nn
-				case 0xEA: JP_CC_NN(REGS(F) & PF_BIT); break;
-				// ex de,hl
-				case 0xEB: EX_DE_HL(); break;
-				// call pe,nn
-				case 0xEC: CALL_CC_NN(REGS(F) & PF_BIT); break;
-				// 0xED prefix
-				case 0xED:
+				case 0xCB:
 				{
-					FETCH(opcode, REGS(PC)++);
-					switch (opcode) {
-						// nop
-						case 0x00: break;
-						// nop
-						case 0x01: break;
-						// nop
-						case 0x02: break;
-						// nop
-						case 0x03: break;
-						// nop
-						case 0x04: break;
-						// nop
-						case 0x05: break;
-						// nop
-						case 0x06: break;
-						// nop
-						case 0x07: break;
-						// nop
-						case 0x08: break;
-						// nop
-						case 0x09: break;
-						// nop
-						case 0x0A: break;
-						// nop
-						case 0x0B: break;
-						// nop
-						case 0x0C: break;
-						// nop
-						case 0x0D: break;
-						// nop
-						case 0x0E: break;
-						// nop
-						case 0x0F: break;
-						// nop
-						case 0x10: break;
-						// nop
-						case 0x11: break;
-						// nop
-						case 0x12: break;
-						// nop
-						case 0x13: break;
-						// nop
-						case 0x14: break;
-						// nop
-						case 0x15: break;
-						// nop
-						case 0x16: break;
-						// nop
-						case 0x17: break;
-						// nop
-						case 0x18: break;
-						// nop
-						case 0x19: break;
-						// nop
-						case 0x1A: break;
-						// nop
-						case 0x1B: break;
-						// nop
-						case 0x1C: break;
-						// nop
-						case 0x1D: break;
-						// nop
-						case 0x1E: break;
-						// nop
-						case 0x1F: break;
-						// nop
-						case 0x20: break;
-						// nop
-						case 0x21: break;
-						// nop
-						case 0x22: break;
-						// nop
-						case 0x23: break;
-						// nop
-						case 0x24: break;
-						// nop
-						case 0x25: break;
-						// nop
-						case 0x26: break;
-						// nop
-						case 0x27: break;
-						// nop
-						case 0x28: break;
-						// nop
-						case 0x29: break;
-						// nop
-						case 0x2A: break;
-						// nop
-						case 0x2B: break;
-						// nop
-						case 0x2C: break;
-						// nop
-						case 0x2D: break;
-						// nop
-						case 0x2E: break;
-						// nop
-						case 0x2F: break;
-						// nop
-						case 0x30: break;
-						// nop
-						case 0x31: break;
-						// nop
-						case 0x32: break;
-						// nop
-						case 0x33: break;
-						// nop
-						case 0x34: break;
-						// nop
-						case 0x35: break;
-						// nop
-						case 0x36: break;
-						// nop
-						case 0x37: break;
-						// nop
-						case 0x38: break;
-						// nop
-						case 0x39: break;
-						// nop
-						case 0x3A: break;
-						// nop
-						case 0x3B: break;
-						// nop
-						case 0x3C: break;
-						// nop
-						case 0x3D: break;
-						// nop
-						case 0x3E: break;
-						// nop
-						case 0x3F: break;
-						// in b,(c)
-						case 0x40: IN_R_DC(B); break;
-						// out (c),b
-						case 0x41: OUT_DC_R(B); break;
-						// sbc hl,bc
-						case 0x42: SBC_HL_RR(BC); break;
-						// ld (nn),bc
-						case 0x43: LD_DNN_RR(B, C); break;
-						// neg
-						case 0x44: NEG(); break;
-						// retn
-						case 0x45: RET(); break;
-						// im 0
-						case 0x46: IM_N(0); break;
-						// ld i,a
-						case 0x47: LD_IR_A(I); break;
-						// in c,(c)
-						case 0x48: IN_R_DC(C); break;
-						// out (c),c
-						case 0x49: OUT_DC_R(C); break;
-						// adc hl,bc
-						case 0x4A: ADC_HL_RR(BC); break;
-						// ld bc,(nn)
-						case 0x4B: LD_RR_DNN(B, C); break;
-						// neg
-						case 0x4C: NEG(); break;
-						// reti
-						case 0x4D: RET(); break;
-						// im 0
-						case 0x4E: IM_N(0); break;
-						// ld r,a
-						case 0x4F: LD_IR_A(R); break;
-						// in d,(c)
-						case 0x50: IN_R_DC(D); break;
-						// out (c),d
-						case 0x51: OUT_DC_R(D); break;
-						// sbc hl,de
-						case 0x52: SBC_HL_RR(DE); break;
-						// ld (nn),de
-						case 0x53: LD_DNN_RR(D, E); break;
-						// neg
-						case 0x54: NEG(); break;
-						// retn
-						case 0x55: RET(); break;
-						// im 1
-						case 0x56: IM_N(1); break;
-						// ld a,i
-						case 0x57: LD_A_IR(I); break;
-						// in e,(c)
-						case 0x58: IN_R_DC(E); break;
-						// out (c),e
-						case 0x59: OUT_DC_R(E); break;
-						// adc hl,de
-						case 0x5A: ADC_HL_RR(DE); break;
-						// ld de,(nn)
-						case 0x5B: LD_RR_DNN(D, E); break;
-						// neg
-						case 0x5C: NEG(); break;
-						// retn
-						case 0x5D: RET(); break;
-						// im 2
-						case 0x5E: IM_N(2); break;
-						// ld a,r
-						case 0x5F: LD_A_IR(R); break;
-						// in h,(c)
-						case 0x60: IN_R_DC(H); break;
-						// out (c),h
-						case 0x61: OUT_DC_R(H); break;
-						// sbc hl,hl
-						case 0x62: SBC_HL_RR(HL); break;
-						// ld (nn),hl
-						case 0x63: LD_DNN_RR(H, L); break;
-						// neg
-						case 0x64: NEG(); break;
-						// retn
-						case 0x65: RET(); break;
-						// im 0
-						case 0x66: IM_N(0); break;
-						// rrd
-						case 0x67: RRD(); break;
-						// in l,(c)
-						case 0x68: IN_R_DC(L); break;
-						// out (c),l
-						case 0x69: OUT_DC_R(L); break;
-						// adc hl,hl
-						case 0x6A: ADC_HL_RR(HL); break;
-						// ld hl,(nn)
-						case 0x6B: LD_RR_DNN(H, L); break;
-						// neg
-						case 0x6C: NEG(); break;
-						// retn
-						case 0x6D: RET(); break;
-						// im 0
-						case 0x6E: IM_N(0); break;
-						// rld
-						case 0x6F: RLD(); break;
-						// in (c)
-						case 0x70: IN_DC(); break;
-						// out (c),0
-						case 0x71: OUT_DC_0(); break;
-						// sbc hl,sp
-						case 0x72: SBC_HL_RR(SP); break;
-						// ld (nn),sp
-						case 0x73: LD_DNN_RR(SPH, SPL); break;
-						// neg
-						case 0x74: NEG(); break;
-						// retn
-						case 0x75: RET(); break;
-						// im 1
-						case 0x76: IM_N(1); break;
-						// nop
-						case 0x77: break;
-						// in a,(c)
-						case 0x78: IN_R_DC(A); break;
-						// out (c),a
-						case 0x79: OUT_DC_R(A); break;
-						// adc hl,sp
-						case 0x7A: ADC_HL_RR(SP); break;
-						// ld sp,(nn)
-						case 0x7B: LD_RR_DNN(SPH, SPL); break;
-						// neg
-						case 0x7C: NEG(); break;
-						// retn
-						case 0x7D: RET(); break;
-						// im 2
-						case 0x7E: IM_N(2); break;
-						// nop
-						case 0x7F: break;
-						// nop
-						case 0x80: break;
-						// nop
-						case 0x81: break;
-						// nop
-						case 0x82: break;
-						// nop
-						case 0x83: break;
-						// nop
-						case 0x84: break;
-						// nop
-						case 0x85: break;
-						// nop
-						case 0x86: break;
-						// nop
-						case 0x87: break;
-						// nop
-						case 0x88: break;
-						// nop
-						case 0x89: break;
-						// nop
-						case 0x8A: break;
-						// nop
-						case 0x8B: break;
-						// nop
-						case 0x8C: break;
-						// nop
-						case 0x8D: break;
-						// nop
-						case 0x8E: break;
-						// nop
-						case 0x8F: break;
-						// nop
-						case 0x90: break;
-						// nop
-						case 0x91: break;
-						// nop
-						case 0x92: break;
-						// nop
-						case 0x93: break;
-						// nop
-						case 0x94: break;
-						// nop
-						case 0x95: break;
-						// nop
-						case 0x96: break;
-						// nop
-						case 0x97: break;
-						// nop
-						case 0x98: break;
-						// nop
-						case 0x99: break;
-						// nop
-						case 0x9A: break;
-						// nop
-						case 0x9B: break;
-						// nop
-						case 0x9C: break;
-						// nop
-						case 0x9D: break;
-						// nop
-						case 0x9E: break;
-						// nop
-						case 0x9F: break;
-						// ldi
-						case 0xA0: LDI(); break;
-						// cpi
-						case 0xA1: CPI(); break;
-						// ini
-						case 0xA2: INI(); break;
-						// outi
-						case 0xA3: OUTI(); break;
-						// nop
-						case 0xA4: break;
-						// nop
-						case 0xA5: break;
-						// nop
-						case 0xA6: break;
-						// nop
-						case 0xA7: break;
-						// ldd
-						case 0xA8: LDD(); break;
-						// cpd
-						case 0xA9: CPD(); break;
-						// ind
-						case 0xAA: IND(); break;
-						// outd
-						case 0xAB: OUTD(); break;
-						// nop
-						case 0xAC: break;
-						// nop
-						case 0xAD: break;
-						// nop
-						case 0xAE: break;
-						// nop
-						case 0xAF: break;
-						// ldir
-						case 0xB0: LDIR(); break;
-						// cpir
-						case 0xB1: CPIR(); break;
-						// inir
-						case 0xB2: INIR(); break;
-						// otir
-						case 0xB3: OTIR(); break;
-						// nop
-						case 0xB4: break;
-						// nop
-						case 0xB5: break;
-						// nop
-						case 0xB6: break;
-						// nop
-						case 0xB7: break;
-						// lddr
-						case 0xB8: LDDR(); break;
-						// cpdr
-						case 0xB9: CPDR(); break;
-						// indr
-						case 0xBA: INDR(); break;
-						// otdr
-						case 0xBB: OTDR(); break;
-						// nop
-						case 0xBC: break;
-						// nop
-						case 0xBD: break;
-						// nop
-						case 0xBE: break;
-						// nop
-						case 0xBF: break;
-						// nop
-						case 0xC0: break;
-						// nop
-						case 0xC1: break;
-						// nop
-						case 0xC2: break;
-						// nop
-						case 0xC3: break;
-						// nop
-						case 0xC4: break;
-						// nop
-						case 0xC5: break;
-						// nop
-						case 0xC6: break;
-						// nop
-						case 0xC7: break;
-						// nop
-						case 0xC8: break;
-						// nop
-						case 0xC9: break;
-						// nop
-						case 0xCA: break;
-						// nop
-						case 0xCB: break;
-						// nop
-						case 0xCC: break;
-						// nop
-						case 0xCD: break;
-						// nop
-						case 0xCE: break;
-						// nop
-						case 0xCF: break;
-						// nop
-						case 0xD0: break;
-						// nop
-						case 0xD1: break;
-						// nop
-						case 0xD2: break;
-						// nop
-						case 0xD3: break;
-						// nop
-						case 0xD4: break;
-						// nop
-						case 0xD5: break;
-						// nop
-						case 0xD6: break;
-						// nop
-						case 0xD7: break;
-						// nop
-						case 0xD8: break;
-						// nop
-						case 0xD9: break;
-						// nop
-						case 0xDA: break;
-						// nop
-						case 0xDB: break;
-						// nop
-						case 0xDC: break;
-						// nop
-						case 0xDD: break;
-						// nop
-						case 0xDE: break;
-						// nop
-						case 0xDF: break;
-						// nop
-						case 0xE0: break;
-						// nop
-						case 0xE1: break;
-						// nop
-						case 0xE2: break;
-						// nop
-						case 0xE3: break;
-						// nop
-						case 0xE4: break;
-						// nop
-						case 0xE5: break;
-						// nop
-						case 0xE6: break;
-						// nop
-						case 0xE7: break;
-						// nop
-						case 0xE8: break;
-						// nop
-						case 0xE9: break;
-						// nop
-						case 0xEA: break;
-						// nop
-						case 0xEB: break;
-						// nop
-						case 0xEC: break;
-						// nop
-						case 0xED: break;
-						// nop
-						case 0xEE: break;
-						// nop
-						case 0xEF: break;
-						// nop
-						case 0xF0: break;
-						// nop
-						case 0xF1: break;
-						// nop
-						case 0xF2: break;
-						// nop
-						case 0xF3: break;
-						// nop
-						case 0xF4: break;
-						// nop
-						case 0xF5: break;
-						// nop
-						case 0xF6: break;
-						// nop
-						case 0xF7: break;
-						// nop
-						case 0xF8: break;
-						// nop
-						case 0xF9: break;
-						// nop
-						case 0xFA: break;
-						// nop
-						case 0xFB: break;
-						// nop
-						case 0xFC: break;
-						// nop
-						case 0xFD: break;
-						// nop
-						case 0xFE: break;
-						// nop
-						case 0xFF: break;
+					if (i + 1 >= len) {
+						return false;
 					}
-
+					u8 cbOp = code[i + 1];
+					if ((cbOp & 7) == 6 && (cbOp < 0x40 || cbOp >= 0x80)) {
+						return false; // writes (hl)
+					}
+					size = 2;
 					break;
 				}
-				// xor a,n
-				case 0xEE: XOR_A_N(); break;
-				// rst 0x28
-				case 0xEF: RST(0x28); break;
-				// ret p
-				case 0xF0: RET_CC(!(REGS(F) & SF_BIT)); break;
-				// pop af
-				case 0xF1: POP(A, F); break;
-				// jp p,nn
-				case 0xF2: JP_CC_NN(!(REGS(F) & SF_BIT)); break;
-				// di
-				case 0xF3: DI(); break;
-				// call p,nn
-				case 0xF4: CALL_CC_NN(!(REGS(F) & SF_BIT)); break;
-				// push af
-				case 0xF5: PUSH(A, F); break;
-				// or a,n
-				case 0xF6: OR_A_N(); break;
-				// rst 0x30
-				case 0xF7: RST(0x30); break;
-				// ret m
-				case 0xF8: RET_CC(REGS(F) & SF_BIT); break;
-				// ld sp,hl
-				case 0xF9: LD_SP_RR(HL); break;
-				// jp m,nn
-				case 0xFA: JP_CC_NN(REGS(F) & SF_BIT); break;
-				// ei
-				case 0xFB: EI(); break;
-				// call m,nn
-				case 0xFC: CALL_CC_NN(REGS(F) & SF_BIT); break;
-				// 0xFD prefix
-				case 0xFD:
+				case 0xDD: case 0xFD:
 				{
-					FETCH(opcode, REGS(PC)++);
-					switch (opcode) {
-						// nop
-						case 0x00: break;
-						// ld bc,nn
-						case 0x01: LD_RR_NN(B, C); break;
-						// ld (bc),a
-						case 0x02: LD_DRR_A(BC); break;
-						// inc bc
-						case 0x03: INC_RR(BC); break;
-						// inc b
-						case 0x04: INC_R(B); break;
-						// dec b
-						case 0x05: DEC_R(B); break;
-						// ld b,n
-						case 0x06: LD_R_N(B); break;
-						// rlca
-						case 0x07: RLCA(); break;
-						// ex af,af'
-						case 0x08: EX_RR_ARR(AF); break;
-						// add iy,bc
-						case 0x09: ADD_RR_RR(IY, BC); break;
-						// ld a,(bc)
-						case 0x0A: LD_A_DRR(BC); break;
-						// dec bc
-						case 0x0B: DEC_RR(BC); break;
-						// inc c
-						case 0x0C: INC_R(C); break;
-						// dec c
-						case 0x0D: DEC_R(C); break;
-						// ld c,n
-						case 0x0E: LD_R_N(C); break;
-						// rrca
-						case 0x0F: RRCA(); break;
-						// djnz e
-						case 0x10: DJNZ_E(); break;
-						// ld de,nn
-						case 0x11: LD_RR_NN(D, E); break;
-						// ld (de),a
-						case 0x12: LD_DRR_A(DE); break;
-						// inc de
-						case 0x13: INC_RR(DE); break;
-						// inc d
-						case 0x14: INC_R(D); break;
-						// dec d
-						case 0x15: DEC_R(D); break;
-						// ld d,n
-						case 0x16: LD_R_N(D); break;
-						// rla
-						case 0x17: RLA(); break;
-						// jr e
-						case 0x18: JR_CC_E(true); break;
-						// add iy,de
-						case 0x19: ADD_RR_RR(IY, DE); break;
-						// ld a,(de)
-						case 0x1A: LD_A_DRR(DE); break;
-						// dec de
-						case 0x1B: DEC_RR(DE); break;
-						// inc e
-						case 0x1C: INC_R(E); break;
-						// dec e
-						case 0x1D: DEC_R(E); break;
-						// ld e,n
-						case 0x1E: LD_R_N(E); break;
-						// rra
-						case 0x1F: RRA(); break;
-						// jr nz,e
-						case 0x20: JR_CC_E(!(REGS(F) & ZF_BIT)); break;
-						// ld iy,nn
-						case 0x21: LD_RR_NN(IYH, IYL); break;
-						// ld (nn),iy
-						case 0x22: LD_DNN_RR(IYH, IYL); break;
-						// inc iy
-						case 0x23: INC_RR(IY); break;
-						// inc iyh
-						case 0x24: INC_R(IYH); break;
-						// dec iyh
-						case 0x25: DEC_R(IYH); break;
-						// ld iyh,n
-						case 0x26: LD_R_N(IYH); break;
-						// daa
-						case 0x27: DAA(); break;
-						// jr z,e
-						case 0x28: JR_CC_E(REGS(F) & ZF_BIT); break;
-						// add iy,iy
-						case 0x29: ADD_RR_RR(IY, IY); break;
-						// ld iy,(nn)
-						case 0x2A: LD_RR_DNN(IYH, IYL); break;
-						// dec iy
-						case 0x2B: DEC_RR(IY); break;
-						// inc iyl
-						case 0x2C: INC_R(IYL); break;
-						// dec iyl
-						case 0x2D: DEC_R(IYL); break;
-						// ld iyl,n
-						case 0x2E: LD_R_N(IYL); break;
-						// cpl
-						case 0x2F: CPL(); break;
-						// jr nc,e
-						case 0x30: JR_CC_E(!(REGS(F) & CF_BIT)); break;
-						// ld sp,nn
-						case 0x31: LD_RR_NN(SPH, SPL); break;
-						// ld (nn),a
-						case 0x32: LD_DNN_A(); break;
-						// inc sp
-						case 0x33: INC_RR(SP); break;
-						// inc (iy+e)
-						case 0x34: INC_DRR_E(IY); break;
-						// dec (iy+e)
-						case 0x35: DEC_DRR_E(IY); break;
-						// ld (iy+e),n
-						case 0x36: LD_DRR_E_N(IY); break;
-						// scf
-						case 0x37: SCF(); break;
-						// jr c,e
-						case 0x38: JR_CC_E(REGS(F) & CF_BIT); break;
-						// add iy,sp
-						case 0x39: ADD_RR_RR(IY, SP); break;
-						// ld a,(nn)
-						case 0x3A: LD_A_DNN(); break;
-						// dec sp
-						case 0x3B: DEC_RR(SP); break;
-						// inc a
-						case 0x3C: INC_R(A); break;
-						// dec a
-						case 0x3D: DEC_R(A); break;
-						// ld a,n
-						case 0x3E: LD_R_N(A); break;
-						// ccf
-						case 0x3F: CCF(); break;
-						// ld b,b
-						case 0x40: LD_R_R(B, B); break;
-						// ld b,c
-						case 0x41: LD_R_R(B, C); break;
-						// ld b,d
-						case 0x42: LD_R_R(B, D); break;
-						// ld b,e
-						case 0x43: LD_R_R(B, E); break;
-						// ld b,iyh
-						case 0x44: LD_R_R(B, IYH); break;
-						// ld b,iyl
-						case 0x45: LD_R_R(B, IYL); break;
-						// ld b,(iy+e)
-						case 0x46: LD_R_DRR_E(B, IY); break;
-						// ld b,a
-						case 0x47: LD_R_R(B, A); break;
-						// ld c,b
-						case 0x48: LD_R_R(C, B); break;
-						// ld c,c
-						case 0x49: LD_R_R(C, C); break;
-						// ld c,d
-						case 0x4A: LD_R_R(C, D); break;
-						// ld c,e
-						case 0x4B: LD_R_R(C, E); break;
-						// ld c,iyh
-						case 0x4C: LD_R_R(C, IYH); break;
-						// ld c,iyl
-						case 0x4D: LD_R_R(C, IYL); break;
-						// ld c,(iy+e)
-						case 0x4E: LD_R_DRR_E(C, IY); break;
-						// ld c,a
-						case 0x4F: LD_R_R(C, A); break;
-						// ld d,b
-						case 0x50: LD_R_R(D, B); break;
-						// ld d,c
-						case 0x51: LD_R_R(D, C); break;
-						// ld d,d
-						case 0x52: LD_R_R(D, D); break;
-						// ld d,e
-						case 0x53: LD_R_R(D, E); break;
-						// ld d,iyh
-						case 0x54: LD_R_R(D, IYH); break;
-						// ld d,iyl
-						case 0x55: LD_R_R(D, IYL); break;
-						// ld d,(iy+e)
-						case 0x56: LD_R_DRR_E(D, IY); break;
-						// ld d,a
-						case 0x57: LD_R_R(D, A); break;
-						// ld e,b
-						case 0x58: LD_R_R(E, B); break;
-						// ld e,c
-						case 0x59: LD_R_R(E, C); break;
-						// ld e,d
-						case 0x5A: LD_R_R(E, D); break;
-						// ld e,e
-						case 0x5B: LD_R_R(E, E); break;
-						// ld e,iyh
-						case 0x5C: LD_R_R(E, IYH); break;
-						// ld e,iyl
-						case 0x5D: LD_R_R(E, IYL); break;
-						// ld e,(iy+e)
-						case 0x5E: LD_R_DRR_E(E, IY); break;
-						// ld e,a
-						case 0x5F: LD_R_R(E, A); break;
-						// ld iyh,b
-						case 0x60: LD_R_R(IYH, B); break;
-						// ld iyh,c
-						case 0x61: LD_R_R(IYH, C); break;
-						// ld iyh,d
-						case 0x62: LD_R_R(IYH, D); break;
-						// ld iyh,e
-						case 0x63: LD_R_R(IYH, E); break;
-						// ld iyh,iyh
-						case 0x64: LD_R_R(IYH, IYH); break;
-						// ld iyh,iyl
-						case 0x65: LD_R_R(IYH, IYL); break;
-						// ld h,(iy+e)
-						case 0x66: LD_R_DRR_E(H, IY); break;
-						// ld iyh,a
-						case 0x67: LD_R_R(IYH, A); break;
-						// ld iyl,b
-						case 0x68: LD_R_R(IYL, B); break;
-						// ld iyl,c
-						case 0x69: LD_R_R(IYL, C); break;
-						// ld iyl,d
-						case 0x6A: LD_R_R(IYL, D); break;
-						// ld iyl,e
-						case 0x6B: LD_R_R(IYL, E); break;
-						// ld iyl,iyh
-						case 0x6C: LD_R_R(IYL, IYH); break;
-						// ld iyl,iyl
-						case 0x6D: LD_R_R(IYL, IYL); break;
-						// ld l,(iy+e)
-						case 0x6E: LD_R_DRR_E(L, IY); break;
-						// ld iyl,a
-						case 0x6F: LD_R_R(IYL, A); break;
-						// ld (iy+e),b
-						case 0x70: LD_DRR_E_R(IY, B); break;
-						// ld (iy+e),c
-						case 0x71: LD_DRR_E_R(IY, C); break;
-						// ld (iy+e),d
-						case 0x72: LD_DRR_E_R(IY, D); break;
-						// ld (iy+e),e
-						case 0x73: LD_DRR_E_R(IY, E); break;
-						// ld (iy+e),h
-						case 0x74: LD_DRR_E_R(IY, H); break;
-						// ld (iy+e),l
-						case 0x75: LD_DRR_E_R(IY, L); break;
-						// halt
-						case 0x76: HALT(); break;
-						// ld (iy+e),a
-						case 0x77: LD_DRR_E_R(IY, A); break;
-						// ld a,b
-						case 0x78: LD_R_R(A, B); break;
-						// ld a,c
-						case 0x79: LD_R_R(A, C); break;
-						// ld a,d
-						case 0x7A: LD_R_R(A, D); break;
-						// ld a,e
-						case 0x7B: LD_R_R(A, E); break;
-						// ld a,iyh
-						case 0x7C: LD_R_R(A, IYH); break;
-						// ld a,iyl
-						case 0x7D: LD_R_R(A, IYL); break;
-						// ld a,(iy+e)
-						case 0x7E: LD_R_DRR_E(A, IY); break;
-						// ld a,a
-						case 0x7F: LD_R_R(A, A); break;
-						// add a,b
-						case 0x80: ADD_A_R(B); break;
-						// add a,c
-						case 0x81: ADD_A_R(C); break;
-						// add a,d
-						case 0x82: ADD_A_R(D); break;
-						// add a,e
-						case 0x83: ADD_A_R(E); break;
-						// add a,iyh
-						case 0x84: ADD_A_R(IYH); break;
-						// add a,iyl
-						case 0x85: ADD_A_R(IYL); break;
-						// add a,(iy+e)
-						case 0x86: ADD_A_DRR_E(IY); break;
-						// add a,a
-						case 0x87: ADD_A_R(A); break;
-						// adc a,b
-						case 0x88: ADC_A_R(B); break;
-						// adc a,c
-						case 0x89: ADC_A_R(C); break;
-						// adc a,d
-						case 0x8A: ADC_A_R(D); break;
-						// adc a,e
-						case 0x8B: ADC_A_R(E); break;
-						// adc a,iyh
-						case 0x8C: ADC_A_R(IYH); break;
-						// adc a,iyl
-						case 0x8D: ADC_A_R(IYL); break;
-						// adc a,(iy+e)
-						case 0x8E: ADC_A_DRR_E(IY); break;
-						// adc a,a
-						case 0x8F: ADC_A_R(A); break;
-						// sub a,b
-						case 0x90: SUB_A_R(B); break;
-						// sub a,c
-						case 0x91: SUB_A_R(C); break;
-						// sub a,d
-						case 0x92: SUB_A_R(D); break;
-						// sub a,e
-						case 0x93: SUB_A_R(E); break;
-						// sub a,iyh
-						case 0x94: SUB_A_R(IYH); break;
-						// sub a,iyl
-						case 0x95: SUB_A_R(IYL); break;
-						// sub a,(iy+e)
-						case 0x96: SUB_A_DRR_E(IY); break;
-						// sub a,a
-						case 0x97: SUB_A_R(A); break;
-						// sbc a,b
-						case 0x98: SBC_A_R(B); break;
-						// sbc a,c
-						case 0x99: SBC_A_R(C); break;
-						// sbc a,d
-						case 0x9A: SBC_A_R(D); break;
-						// sbc a,e
-						case 0x9B: SBC_A_R(E); break;
-						// sbc a,iyh
-						case 0x9C: SBC_A_R(IYH); break;
-						// sbc a,iyl
-						case 0x9D: SBC_A_R(IYL); break;
-						// sbc a,(iy+e)
-						case 0x9E: SBC_A_DRR_E(IY); break;
-						// sbc a,a
-						case 0x9F: SBC_A_R(A); break;
-						// and a,b
-						case 0xA0: AND_A_R(B); break;
-						// and a,c
-						case 0xA1: AND_A_R(C); break;
-						// and a,d
-						case 0xA2: AND_A_R(D); break;
-						// and a,e
-						case 0xA3: AND_A_R(E); break;
-						// and a,iyh
-						case 0xA4: AND_A_R(IYH); break;
-						// and a,iyl
-						case 0xA5: AND_A_R(IYL); break;
-						// and a,(iy+e)
-						case 0xA6: AND_A_DRR_E(IY); break;
-						// and a,a
-						case 0xA7: AND_A_R(A); break;
-						// xor a,b
-						case 0xA8: XOR_A_R(B); break;
-						// xor a,c
-						case 0xA9: XOR_A_R(C); break;
-						// xor a,d
-						case 0xAA: XOR_A_R(D); break;
-						// xor a,e
-						case 0xAB: XOR_A_R(E); break;
-						// xor a,iyh
-						case 0xAC: XOR_A_R(IYH); break;
-						// xor a,iyl
-						case 0xAD: XOR_A_R(IYL); break;
-						// xor a,(iy+e)
-						case 0xAE: XOR_A_DRR_E(IY); break;
-						// xor a,a
-						case 0xAF: XOR_A_R(A); break;
-						// or a,b
-						case 0xB0: OR_A_R(B); break;
-						// or a,c
-						case 0xB1: OR_A_R(C); break;
-						// or a,d
-						case 0xB2: OR_A_R(D); break;
-						// or a,e
-						case 0xB3: OR_A_R(E); break;
-						// or a,iyh
-						case 0xB4: OR_A_R(IYH); break;
-						// or a,iyl
-						case 0xB5: OR_A_R(IYL); break;
-						// or a,(iy+e)
-						case 0xB6: OR_A_DRR_E(IY); break;
-						// or a,a
-						case 0xB7: OR_A_R(A); break;
-						// cp a,b
-						case 0xB8: CP_A_R(B); break;
-						// cp a,c
-						case 0xB9: CP_A_R(C); break;
-						// cp a,d
-						case 0xBA: CP_A_R(D); break;
-						// cp a,e
-						case 0xBB: CP_A_R(E); break;
-						// cp a,iyh
-						case 0xBC: CP_A_R(IYH); break;
-						// cp a,iyl
-						case 0xBD: CP_A_R(IYL); break;
-						// cp a,(iy+e)
-						case 0xBE: CP_A_DRR_E(IY); break;
-						// cp a,a
-						case 0xBF: CP_A_R(A); break;
-						// ret nz
-						case 0xC0: RET_CC(!(REGS(F) & ZF_BIT)); break;
-						// pop bc
-						case 0xC1: POP(B, C); break;
-						// jp nz,nn
-						case 0xC2: JP_CC_NN(!(REGS(F) & ZF_BIT)); break;
-						// jp nn
-						case 0xC3: JP_CC_NN(true); break;
-						// call nz,nn
-						case 0xC4: CALL_CC_NN(!(REGS(F) & ZF_BIT)); break;
-						// push bc
-						case 0xC5: PUSH(B, C); break;
-						// add a,n
-						case 0xC6: ADD_A_N(); break;
-						// rst 0x00
-						case 0xC7: RST(0x00); break;
-						// ret z
-						case 0xC8: RET_CC(REGS(F) & ZF_BIT); break;
-						// ret
-						case 0xC9: RET(); break;
-						// jp z,nn
-						case 0xCA: JP_CC_NN(REGS(F) & ZF_BIT); break;
-						// 0xFDCB prefix
-						case 0xCB:
-						{
-							u8 e;
-							READ(e, REGS(PC)++);
-							READ(opcode, REGS(PC)++);
-							cycleCount += 2;
-							REGS(WZ) = REGS(IY) + SIGNED(e, s8);
-							switch (opcode) {
-								// rlc (iy+e),b
-								case 0x00: RLC_DRR_E_R(B); break;
-								// rlc (iy+e),c
-								case 0x01: RLC_DRR_E_R(C); break;
-								// rlc (iy+e),d
-								case 0x02: RLC_DRR_E_R(D); break;
-								// rlc (iy+e),e
-								case 0x03: RLC_DRR_E_R(E); break;
-								// rlc (iy+e),h
-								case 0x04: RLC_DRR_E_R(H); break;
-								// rlc (iy+e),l
-								case 0x05: RLC_DRR_E_R(L); break;
-								// rlc (iy+e)
-								case 0x06: RLC_DRR_E(); break;
-								// rlc (iy+e),a
-								case 0x07: RLC_DRR_E_R(A); break;
-								// rrc (iy+e),b
-								case 0x08: RRC_DRR_E_R(B); break;
-								// rrc (iy+e),c
-								case 0x09: RRC_DRR_E_R(C); break;
-								// rrc (iy+e),d
-								case 0x0A: RRC_DRR_E_R(D); break;
-								// rrc (iy+e),e
-								case 0x0B: RRC_DRR_E_R(E); break;
-								// rrc (iy+e),h
-								case 0x0C: RRC_DRR_E_R(H); break;
-								// rrc (iy+e),l
-								case 0x0D: RRC_DRR_E_R(L); break;
-								// rrc (iy+e)
-								case 0x0E: RRC_DRR_E(); break;
-								// rrc (iy+e),a
-								case 0x0F: RRC_DRR_E_R(A); break;
-								// rl (iy+e),b
-								case 0x10: RL_DRR_E_R(B); break;
-								// rl (iy+e),c
-								case 0x11: RL_DRR_E_R(C); break;
-								// rl (iy+e),d
-								case 0x12: RL_DRR_E_R(D); break;
-								// rl (iy+e),e
-								case 0x13: RL_DRR_E_R(E); break;
-								// rl (iy+e),h
-								case 0x14: RL_DRR_E_R(H); break;
-								// rl (iy+e),l
-								case 0x15: RL_DRR_E_R(L); break;
-								// rl (iy+e)
-								case 0x16: RL_DRR_E(); break;
-								// rl (iy+e),a
-								case 0x17: RL_DRR_E_R(A); break;
-								// rr (iy+e),b
-								case 0x18: RR_DRR_E_R(B); break;
-								// rr (iy+e),c
-								case 0x19: RR_DRR_E_R(C); break;
-								// rr (iy+e),d
-								case 0x1A: RR_DRR_E_R(D); break;
-								// rr (iy+e),e
-								case 0x1B: RR_DRR_E_R(E); break;
-								// rr (iy+e),h
-								case 0x1C: RR_DRR_E_R(H); break;
-								// rr (iy+e),l
-								case 0x1D: RR_DRR_E_R(L); break;
-								// rr (iy+e)
-								case 0x1E: RR_DRR_E(); break;
-								// rr (iy+e),a
-								case 0x1F: RR_DRR_E_R(A); break;
-								// sla (iy+e),b
-								case 0x20: SLA_DRR_E_R(B); break;
-								// sla (iy+e),c
-								case 0x21: SLA_DRR_E_R(C); break;
-								// sla (iy+e),d
-								case 0x22: SLA_DRR_E_R(D); break;
-								// sla (iy+e),e
-								case 0x23: SLA_DRR_E_R(E); break;
-								// sla (iy+e),h
-								case 0x24: SLA_DRR_E_R(H); break;
-								// sla (iy+e),l
-								case 0x25: SLA_DRR_E_R(L); break;
-								// sla (iy+e)
-								case 0x26: SLA_DRR_E(); break;
-								// sla (iy+e),a
-								case 0x27: SLA_DRR_E_R(A); break;
-								// sra (iy+e),b
-								case 0x28: SRA_DRR_E_R(B); break;
-								// sra (iy+e),c
-								case 0x29: SRA_DRR_E_R(C); break;
-								// sra (iy+e),d
-								case 0x2A: SRA_DRR_E_R(D); break;
-								// sra (iy+e),e
-								case 0x2B: SRA_DRR_E_R(E); break;
-								// sra (iy+e),h
-								case 0x2C: SRA_DRR_E_R(H); break;
-								// sra (iy+e),l
-								case 0x2D: SRA_DRR_E_R(L); break;
-								// sra (iy+e)
-								case 0x2E: SRA_DRR_E(); break;
-								// sra (iy+e),a
-								case 0x2F: SRA_DRR_E_R(A); break;
-								// sll (iy+e),b
-								case 0x30: SLL_DRR_E_R(B); break;
-								// sll (iy+e),c
-								case 0x31: SLL_DRR_E_R(C); break;
-								// sll (iy+e),d
-								case 0x32: SLL_DRR_E_R(D); break;
-								// sll (iy+e),e
-								case 0x33: SLL_DRR_E_R(E); break;
-								// sll (iy+e),h
-								case 0x34: SLL_DRR_E_R(H); break;
-								// sll (iy+e),l
-								case 0x35: SLL_DRR_E_R(L); break;
-								// sll (iy+e)
-								case 0x36: SLL_DRR_E(); break;
-								// sll (iy+e),a
-								case 0x37: SLL_DRR_E_R(A); break;
-								// srl (iy+e),b
-								case 0x38: SRL_DRR_E_R(B); break;
-								// srl (iy+e),c
-								case 0x39: SRL_DRR_E_R(C); break;
-								// srl (iy+e),d
-								case 0x3A: SRL_DRR_E_R(D); break;
-								// srl (iy+e),e
-								case 0x3B: SRL_DRR_E_R(E); break;
-								// srl (iy+e),h
-								case 0x3C: SRL_DRR_E_R(H); break;
-								// srl (iy+e),l
-								case 0x3D: SRL_DRR_E_R(L); break;
-								// srl (iy+e)
-								case 0x3E: SRL_DRR_E(); break;
-								// srl (iy+e),a
-								case 0x3F: SRL_DRR_E_R(A); break;
-								// bit 0,(iy+e)
-								case 0x40: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x41: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x42: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x43: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x44: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x45: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x46: BIT_N_DRR_E(0); break;
-								// bit 0,(iy+e)
-								case 0x47: BIT_N_DRR_E(0); break;
-								// bit 1,(iy+e)
-								case 0x48: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x49: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4A: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4B: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4C: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4D: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4E: BIT_N_DRR_E(1); break;
-								// bit 1,(iy+e)
-								case 0x4F: BIT_N_DRR_E(1); break;
-								// bit 2,(iy+e)
-								case 0x50: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x51: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x52: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x53: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x54: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x55: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x56: BIT_N_DRR_E(2); break;
-								// bit 2,(iy+e)
-								case 0x57: BIT_N_DRR_E(2); break;
-								// bit 3,(iy+e)
-								case 0x58: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x59: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5A: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5B: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5C: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5D: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5E: BIT_N_DRR_E(3); break;
-								// bit 3,(iy+e)
-								case 0x5F: BIT_N_DRR_E(3); break;
-								// bit 4,(iy+e)
-								case 0x60: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x61: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x62: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x63: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x64: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x65: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x66: BIT_N_DRR_E(4); break;
-								// bit 4,(iy+e)
-								case 0x67: BIT_N_DRR_E(4); break;
-								// bit 5,(iy+e)
-								case 0x68: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x69: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6A: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6B: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6C: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6D: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6E: BIT_N_DRR_E(5); break;
-								// bit 5,(iy+e)
-								case 0x6F: BIT_N_DRR_E(5); break;
-								// bit 6,(iy+e)
-								case 0x70: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x71: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x72: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x73: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x74: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x75: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x76: BIT_N_DRR_E(6); break;
-								// bit 6,(iy+e)
-								case 0x77: BIT_N_DRR_E(6); break;
-								// bit 7,(iy+e)
-								case 0x78: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x79: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7A: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7B: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7C: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7D: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7E: BIT_N_DRR_E(7); break;
-								// bit 7,(iy+e)
-								case 0x7F: BIT_N_DRR_E(7); break;
-								// res 0,(iy+e),b
-								case 0x80: RES_N_DRR_E_R(0, B); break;
-								// res 0,(iy+e),c
-								case 0x81: RES_N_DRR_E_R(0, C); break;
-								// res 0,(iy+e),d
-								case 0x82: RES_N_DRR_E_R(0, D); break;
-								// res 0,(iy+e),e
-								case 0x83: RES_N_DRR_E_R(0, E); break;
-								// res 0,(iy+e),h
-								case 0x84: RES_N_DRR_E_R(0, H); break;
-								// res 0,(iy+e),l
-								case 0x85: RES_N_DRR_E_R(0, L); break;
-								// res 0,(iy+e)
-								case 0x86: RES_N_DRR_E(0); break;
-								// res 0,(iy+e),a
-								case 0x87: RES_N_DRR_E_R(0, A); break;
-								// res 1,(iy+e),b
-								case 0x88: RES_N_DRR_E_R(1, B); break;
-								// res 1,(iy+e),c
-								case 0x89: RES_N_DRR_E_R(1, C); break;
-								// res 1,(iy+e),d
-								case 0x8A: RES_N_DRR_E_R(1, D); break;
-								// res 1,(iy+e),e
-								case 0x8B: RES_N_DRR_E_R(1, E); break;
-								// res 1,(iy+e),h
-								case 0x8C: RES_N_DRR_E_R(1, H); break;
-								// res 1,(iy+e),l
-								case 0x8D: RES_N_DRR_E_R(1, L); break;
-								// res 1,(iy+e)
-								case 0x8E: RES_N_DRR_E(1); break;
-								// res 1,(iy+e),a
-								case 0x8F: RES_N_DRR_E_R(1, A); break;
-								// res 2,(iy+e),b
-								case 0x90: RES_N_DRR_E_R(2, B); break;
-								// res 2,(iy+e),c
-								case 0x91: RES_N_DRR_E_R(2, C); break;
-								// res 2,(iy+e),d
-								case 0x92: RES_N_DRR_E_R(2, D); break;
-								// res 2,(iy+e),e
-								case 0x93: RES_N_DRR_E_R(2, E); break;
-								// res 2,(iy+e),h
-								case 0x94: RES_N_DRR_E_R(2, H); break;
-								// res 2,(iy+e),l
-								case 0x95: RES_N_DRR_E_R(2, L); break;
-								// res 2,(iy+e)
-								case 0x96: RES_N_DRR_E(2); break;
-								// res 2,(iy+e),a
-								case 0x97: RES_N_DRR_E_R(2, A); break;
-								// res 3,(iy+e),b
-								case 0x98: RES_N_DRR_E_R(3, B); break;
-								// res 3,(iy+e),c
-								case 0x99: RES_N_DRR_E_R(3, C); break;
-								// res 3,(iy+e),d
-								case 0x9A: RES_N_DRR_E_R(3, D); break;
-								// res 3,(iy+e),e
-								case 0x9B: RES_N_DRR_E_R(3, E); break;
-								// res 3,(iy+e),h
-								case 0x9C: RES_N_DRR_E_R(3, H); break;
-								// res 3,(iy+e),l
-								case 0x9D: RES_N_DRR_E_R(3, L); break;
-								// res 3,(iy+e)
-								case 0x9E: RES_N_DRR_E(3); break;
-								// res 3,(iy+e),a
-								case 0x9F: RES_N_DRR_E_R(3, A); break;
-								// res 4,(iy+e),b
-								case 0xA0: RES_N_DRR_E_R(4, B); break;
-								// res 4,(iy+e),c
-								case 0xA1: RES_N_DRR_E_R(4, C); break;
-								// res 4,(iy+e),d
-								case 0xA2: RES_N_DRR_E_R(4, D); break;
-								// res 4,(iy+e),e
-								case 0xA3: RES_N_DRR_E_R(4, E); break;
-								// res 4,(iy+e),h
-								case 0xA4: RES_N_DRR_E_R(4, H); break;
-								// res 4,(iy+e),l
-								case 0xA5: RES_N_DRR_E_R(4, L); break;
-								// res 4,(iy+e)
-								case 0xA6: RES_N_DRR_E(4); break;
-								// res 4,(iy+e),a
-								case 0xA7: RES_N_DRR_E_R(4, A); break;
-								// res 5,(iy+e),b
-								case 0xA8: RES_N_DRR_E_R(5, B); break;
-								// res 5,(iy+e),c
-								case 0xA9: RES_N_DRR_E_R(5, C); break;
-								// res 5,(iy+e),d
-								case 0xAA: RES_N_DRR_E_R(5, D); break;
-								// res 5,(iy+e),e
-								case 0xAB: RES_N_DRR_E_R(5, E); break;
-								// res 5,(iy+e),h
-								case 0xAC: RES_N_DRR_E_R(5, H); break;
-								// res 5,(iy+e),l
-								case 0xAD: RES_N_DRR_E_R(5, L); break;
-								// res 5,(iy+e)
-								case 0xAE: RES_N_DRR_E(5); break;
-								// res 5,(iy+e),a
-								case 0xAF: RES_N_DRR_E_R(5, A); break;
-								// res 6,(iy+e),b
-								case 0xB0: RES_N_DRR_E_R(6, B); break;
-								// res 6,(iy+e),c
-								case 0xB1: RES_N_DRR_E_R(6, C); break;
-								// res 6,(iy+e),d
-								case 0xB2: RES_N_DRR_E_R(6, D); break;
-								// res 6,(iy+e),e
-								case 0xB3: RES_N_DRR_E_R(6, E); break;
-								// res 6,(iy+e),h
-								case 0xB4: RES_N_DRR_E_R(6, H); break;
-								// res 6,(iy+e),l
-								case 0xB5: RES_N_DRR_E_R(6, L); break;
-								// res 6,(iy+e)
-								case 0xB6: RES_N_DRR_E(6); break;
-								// res 6,(iy+e),a
-								case 0xB7: RES_N_DRR_E_R(6, A); break;
-								// res 7,(iy+e),b
-								case 0xB8: RES_N_DRR_E_R(7, B); break;
-								// res 7,(iy+e),c
-								case 0xB9: RES_N_DRR_E_R(7, C); break;
-								// res 7,(iy+e),d
-								case 0xBA: RES_N_DRR_E_R(7, D); break;
-								// res 7,(iy+e),e
-								case 0xBB: RES_N_DRR_E_R(7, E); break;
-								// res 7,(iy+e),h
-								case 0xBC: RES_N_DRR_E_R(7, H); break;
-								// res 7,(iy+e),l
-								case 0xBD: RES_N_DRR_E_R(7, L); break;
-								// res 7,(iy+e)
-								case 0xBE: RES_N_DRR_E(7); break;
-								// res 7,(iy+e),a
-								case 0xBF: RES_N_DRR_E_R(7, A); break;
-								// set 0,(iy+e),b
-								case 0xC0: SET_N_DRR_E_R(0, B); break;
-								// set 0,(iy+e),c
-								case 0xC1: SET_N_DRR_E_R(0, C); break;
-								// set 0,(iy+e),d
-								case 0xC2: SET_N_DRR_E_R(0, D); break;
-								// set 0,(iy+e),e
-								case 0xC3: SET_N_DRR_E_R(0, E); break;
-								// set 0,(iy+e),h
-								case 0xC4: SET_N_DRR_E_R(0, H); break;
-								// set 0,(iy+e),l
-								case 0xC5: SET_N_DRR_E_R(0, L); break;
-								// set 0,(iy+e)
-								case 0xC6: SET_N_DRR_E(0); break;
-								// set 0,(iy+e),a
-								case 0xC7: SET_N_DRR_E_R(0, A); break;
-								// set 1,(iy+e),b
-								case 0xC8: SET_N_DRR_E_R(1, B); break;
-								// set 1,(iy+e),c
-								case 0xC9: SET_N_DRR_E_R(1, C); break;
-								// set 1,(iy+e),d
-								case 0xCA: SET_N_DRR_E_R(1, D); break;
-								// set 1,(iy+e),e
-								case 0xCB: SET_N_DRR_E_R(1, E); break;
-								// set 1,(iy+e),h
-								case 0xCC: SET_N_DRR_E_R(1, H); break;
-								// set 1,(iy+e),l
-								case 0xCD: SET_N_DRR_E_R(1, L); break;
-								// set 1,(iy+e)
-								case 0xCE: SET_N_DRR_E(1); break;
-								// set 1,(iy+e),a
-								case 0xCF: SET_N_DRR_E_R(1, A); break;
-								// set 2,(iy+e),b
-								case 0xD0: SET_N_DRR_E_R(2, B); break;
-								// set 2,(iy+e),c
-								case 0xD1: SET_N_DRR_E_R(2, C); break;
-								// set 2,(iy+e),d
-								case 0xD2: SET_N_DRR_E_R(2, D); break;
-								// set 2,(iy+e),e
-								case 0xD3: SET_N_DRR_E_R(2, E); break;
-								// set 2,(iy+e),h
-								case 0xD4: SET_N_DRR_E_R(2, H); break;
-								// set 2,(iy+e),l
-								case 0xD5: SET_N_DRR_E_R(2, L); break;
-								// set 2,(iy+e)
-								case 0xD6: SET_N_DRR_E(2); break;
-								// set 2,(iy+e),a
-								case 0xD7: SET_N_DRR_E_R(2, A); break;
-								// set 3,(iy+e),b
-								case 0xD8: SET_N_DRR_E_R(3, B); break;
-								// set 3,(iy+e),c
-								case 0xD9: SET_N_DRR_E_R(3, C); break;
-								// set 3,(iy+e),d
-								case 0xDA: SET_N_DRR_E_R(3, D); break;
-								// set 3,(iy+e),e
-								case 0xDB: SET_N_DRR_E_R(3, E); break;
-								// set 3,(iy+e),h
-								case 0xDC: SET_N_DRR_E_R(3, H); break;
-								// set 3,(iy+e),l
-								case 0xDD: SET_N_DRR_E_R(3, L); break;
-								// set 3,(iy+e)
-								case 0xDE: SET_N_DRR_E(3); break;
-								// set 3,(iy+e),a
-								case 0xDF: SET_N_DRR_E_R(3, A); break;
-								// set 4,(iy+e),b
-								case 0xE0: SET_N_DRR_E_R(4, B); break;
-								// set 4,(iy+e),c
-								case 0xE1: SET_N_DRR_E_R(4, C); break;
-								// set 4,(iy+e),d
-								case 0xE2: SET_N_DRR_E_R(4, D); break;
-								// set 4,(iy+e),e
-								case 0xE3: SET_N_DRR_E_R(4, E); break;
-								// set 4,(iy+e),h
-								case 0xE4: SET_N_DRR_E_R(4, H); break;
-								// set 4,(iy+e),l
-								case 0xE5: SET_N_DRR_E_R(4, L); break;
-								// set 4,(iy+e)
-								case 0xE6: SET_N_DRR_E(4); break;
-								// set 4,(iy+e),a
-								case 0xE7: SET_N_DRR_E_R(4, A); break;
-								// set 5,(iy+e),b
-								case 0xE8: SET_N_DRR_E_R(5, B); break;
-								// set 5,(iy+e),c
-								case 0xE9: SET_N_DRR_E_R(5, C); break;
-								// set 5,(iy+e),d
-								case 0xEA: SET_N_DRR_E_R(5, D); break;
-								// set 5,(iy+e),e
-								case 0xEB: SET_N_DRR_E_R(5, E); break;
-								// set 5,(iy+e),h
-								case 0xEC: SET_N_DRR_E_R(5, H); break;
-								// set 5,(iy+e),l
-								case 0xED: SET_N_DRR_E_R(5, L); break;
-								// set 5,(iy+e)
-								case 0xEE: SET_N_DRR_E(5); break;
-								// set 5,(iy+e),a
-								case 0xEF: SET_N_DRR_E_R(5, A); break;
-								// set 6,(iy+e),b
-								case 0xF0: SET_N_DRR_E_R(6, B); break;
-								// set 6,(iy+e),c
-								case 0xF1: SET_N_DRR_E_R(6, C); break;
-								// set 6,(iy+e),d
-								case 0xF2: SET_N_DRR_E_R(6, D); break;
-								// set 6,(iy+e),e
-								case 0xF3: SET_N_DRR_E_R(6, E); break;
-								// set 6,(iy+e),h
-								case 0xF4: SET_N_DRR_E_R(6, H); break;
-								// set 6,(iy+e),l
-								case 0xF5: SET_N_DRR_E_R(6, L); break;
-								// set 6,(iy+e)
-								case 0xF6: SET_N_DRR_E(6); break;
-								// set 6,(iy+e),a
-								case 0xF7: SET_N_DRR_E_R(6, A); break;
-								// set 7,(iy+e),b
-								case 0xF8: SET_N_DRR_E_R(7, B); break;
-								// set 7,(iy+e),c
-								case 0xF9: SET_N_DRR_E_R(7, C); break;
-								// set 7,(iy+e),d
-								case 0xFA: SET_N_DRR_E_R(7, D); break;
-								// set 7,(iy+e),e
-								case 0xFB: SET_N_DRR_E_R(7, E); break;
-								// set 7,(iy+e),h
-								case 0xFC: SET_N_DRR_E_R(7, H); break;
-								// set 7,(iy+e),l
-								case 0xFD: SET_N_DRR_E_R(7, L); break;
-								// set 7,(iy+e)
-								case 0xFE: SET_N_DRR_E(7); break;
-								// set 7,(iy+e),a
-								case 0xFF: SET_N_DRR_E_R(7, A); break;
-							}
-
-							break;
+					if (i + 1 >= len) {
+						return false;
+					}
+					u8 indexOp = code[i + 1];
+					if (indexOp == 0xCB) {
+						if (i + 3 >= len || code[i + 3] < 0x40 || code[i + 3] >= 0x80) {
+							return false; // only bit b,(ix+d)
 						}
-						// call z,nn
-						case 0xCC: CALL_CC_NN(REGS(F) & ZF_BIT); break;
-						// call nn
-						case 0xCD: CALL_CC_NN(true); break;
-						// adc a,n
-						case 0xCE: ADC_A_N(); break;
-						// rst 0x08
-						case 0xCF: RST(0x08); break;
-						// ret nc
-						case 0xD0: RET_CC(!(REGS(F) & CF_BIT)); break;
-						// pop de
-						case 0xD1: POP(D, E); break;
-						// jp nc,nn
-						case 0xD2: JP_CC_NN(!(REGS(F) & CF_BIT)); break;
-						// out (n),a
-						case 0xD3: OUT_DN_A(); break;
-						// call nc,nn
-						case 0xD4: CALL_CC_NN(!(REGS(F) & CF_BIT)); break;
-						// push de
-						case 0xD5: PUSH(D, E); break;
-						// sub a,n
-						case 0xD6: SUB_A_N(); break;
-						// rst 0x10
-						case 0xD7: RST(0x10); break;
-						// ret c
-						case 0xD8: RET_CC(REGS(F) & CF_BIT); break;
-						// exx
-						case 0xD9: EXX(); break;
-						// jp c,nn
-						case 0xDA: JP_CC_NN(REGS(F) & CF_BIT); break;
-						// in a,(n)
-						case 0xDB: IN_A_DN(); break;
-						// call c,nn
-						case 0xDC: CALL_CC_NN(REGS(F) & CF_BIT); break;
-						// 0xDD prefix
-						case 0xDD: REPEAT_PREFIX(); break;
-						// sbc a,n
-						case 0xDE: SBC_A_N(); break;
-						// rst 0x18
-						case 0xDF: RST(0x18); break;
-						// ret po
-						case 0xE0: RET_CC(!(REGS(F) & PF_BIT)); break;
-						// pop iy
-						case 0xE1: POP(IYH, IYL); break;
-						// jp po,nn
-						case 0xE2: JP_CC_NN(!(REGS(F) & PF_BIT)); break;
-						// ex (sp),iy
-						case 0xE3: EX_DSP_RR(IYH, IYL); break;
-						// call po,nn
-						case 0xE4: CALL_CC_NN(!(REGS(F) & PF_BIT)); break;
-						// push iy
-						case 0xE5: PUSH(IYH, IYL); break;
-						// and a,n
-						case 0xE6: AND_A_N(); break;
-						// rst 0x20
-						case 0xE7: RST(0x20); break;
-						// ret pe
-						case 0xE8: RET_CC(REGS(F) & PF_BIT); break;
-						// jp iy
-						case 0xE9: JP_RR(IY); break;
-						// jp pe,nn
-						case 0xEA: JP_CC_NN(REGS(F) & PF_BIT); break;
-						// ex de,hl
-						case 0xEB: EX_DE_HL(); break;
-						// call pe,nn
-						case 0xEC: CALL_CC_NN(REGS(F) & PF_BIT); break;
-						// 0xED prefix
-						case 0xED: REPEAT_PREFIX(); break;
-						// xor a,n
-						case 0xEE: XOR_A_N(); break;
-						// rst 0x28
-						case 0xEF: RST(0x28); break;
-						// ret p
-						case 0xF0: RET_CC(!(REGS(F) & SF_BIT)); break;
-						// pop af
-						case 0xF1: POP(A, F); break;
-						// jp p,nn
-						case 0xF2: JP_CC_NN(!(REGS(F) & SF_BIT)); break;
-						// di
-						case 0xF3: DI(); break;
-						// call p,nn
-						case 0xF4: CALL_CC_NN(!(REGS(F) & SF_BIT)); break;
-						// push af
-						case 0xF5: PUSH(A, F); break;
-						// or a,n
-						case 0xF6: OR_A_N(); break;
-						// rst 0x30
-						case 0xF7: RST(0x30); break;
-						// ret m
-						case 0xF8: RET_CC(REGS(F) & SF_BIT); break;
-						// ld sp,iy
-						case 0xF9: LD_SP_RR(IY); break;
-						// jp m,nn
-						case 0xFA: JP_CC_NN(REGS(F) & SF_BIT); break;
-						// ei
-						case 0xFB: EI(); break;
-						// call m,nn
-						case 0xFC: CALL_CC_NN(REGS(F) & SF_BIT); break;
-						// 0xFD prefix
-						case 0xFD: REPEAT_PREFIX(); break;
-						// cp a,n
-						case 0xFE: CP_A_N(); break;
-						// rst 0x38
-						case 0xFF: RST(0x38); break;
+						size = 4;
+					} else if ((indexOp & 0xC7) == 0x46 && indexOp != 0x76) {
+						size = 3; // ld r,(ix+d)
+					} else {
+						return false;
 					}
-
 					break;
 				}
-				// cp a,n
-				case 0xFE: CP_A_N(); break;
-				// rst 0x38
-				case 0xFF: RST(0x38); break;
+				default:
+				{
+					return false;
+				}
 			}
 		}
 
-		cycleCount = Event(TI83, cycleCount);
+		if (i + size > len) {
+			return false;
+		}
+		if (relative) {
+			targets[numTargets++] = start + i + 2 + SIGNED(code[i + 1], s8);
+		} else if (absolute) {
+			targets[numTargets++] = code[i + 1] | (code[i + 2] << 8);
+		}
+		i += size;
+	}
+
+	// branches leaving the body are fine (they stop the watch), branches within it must land on an instruction
+	for (u32 j = 0; j < numTargets; j++) {
+		u16 offset = targets[j] - start;
+		if (offset < len && !(boundaries & (1ull << offset))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void GetIdleLoopRegs(TI83_t* TI83, IdleLoopRegs_t* regs) {
+	memset(regs, 0, sizeof (IdleLoopRegs_t)); // padding is compared too
+	regs->MainRegs = TI83->MainRegs;
+	regs->AltRegs = TI83->AltRegs;
+	regs->LazyFlags = TI83->LazyFlags;
+	regs->IX = REGS(IX);
+	regs->IY = REGS(IY);
+	regs->SP = REGS(SP);
+	regs->WZ = REGS(WZ);
+}
+
+// polling loops waiting for an interrupt are fast forwarded like HALT, returning the cycles skipped
+// a short backward branch to a body without side effects is watched for as long as execution stays in it
+// once an iteration leaves the registers as they were, every later one will too until the next event (input only changes between frames)
+// so all iterations which finish before the next event are skipped, each one taking the same cycles and R increments as the last
+static u32 IdleLoopBranch(TI83_t* TI83, u64 cycleCount, u16 end) {
+	IdleLoop_t* loop = &TI83->IdleLoop;
+	u16 start = REGS(PC);
+	if (start >= end || end - start > IDLE_LOOP_MAX_LENGTH) {
+		if (start < loop->Start || start >= loop->End) {
+			loop->End = 0;
+		}
+		return 0;
+	}
+
+	IdleLoopRegs_t regs;
+	GetIdleLoopRegs(TI83, &regs);
+	if (start != loop->Start || end != loop->End || TI83->NextEventTime != loop->NextEventTime) {
+		loop->Start = start;
+		loop->End = end;
+		loop->Pure = IdleLoopIsPure(TI83, start, end);
+		loop->NextEventTime = TI83->NextEventTime;
+	} else if (loop->Pure && !memcmp(&regs, &loop->Regs, sizeof (IdleLoopRegs_t))
+		&& !TI83->ReadCallback && !TI83->WriteCallback && !TI83->ExecuteCallback && !TI83->TraceCallback && !TI83->MemoryLogKinds && !TI83->NumBreakpoints
+		&& cycleCount < TI83->NextEventTime) {
+		u64 period = cycleCount - loop->CycleCount;
+		u64 iterations = (TI83->NextEventTime - cycleCount) / period;
+		u8 fetches = (REGS(R) - loop->R) & 0x7F;
+		REGS(R) = (REGS(R) & 0x80) | ((REGS(R) + iterations * fetches) & 0x7F);
+		loop->CycleCount = cycleCount + iterations * period;
+		loop->R = REGS(R);
+		TI83->IdleCyclesSkipped += iterations * period;
+		return iterations * period;
+	}
+
+	memcpy(&loop->Regs, &regs, sizeof (IdleLoopRegs_t));
+	loop->CycleCount = cycleCount;
+	loop->R = REGS(R);
+	return 0;
+}
+
+// each variant only tests for the callbacks it was picked for, the rest compile out
+// RunFrame picks one for the frame's callbacks, and switches to another if more are set mid frame (see CallbacksChanged)
+// the memory log and breakpoints are checked along with the memory callbacks, as they also need every instruction run on its own
+// fast mode (see TI83_SetFastModeEnabled) has its own variant, which is only used without callbacks, logging, or breakpoints
+// the reference core (z80ref.c) isn't built from runframe.h, but is picked the same way, as it handles every callback and overrides everything else
+typedef enum {
+	RUN_FRAME_FAST,
+	RUN_FRAME_NO_CALLBACKS,
+	RUN_FRAME_MEMORY_CALLBACKS,
+	RUN_FRAME_ALL_CALLBACKS,
+	RUN_FRAME_REFERENCE,
+} RunFrameVariant_t;
+
+static RunFrameVariant_t SelectRunFrameVariant(TI83_t* TI83) {
+	if (TI83->ReferenceCore) {
+		return RUN_FRAME_REFERENCE;
 	}
 
-	TI83->CycleCount = cycleCount;
+	if (TI83->TraceCallback) {
+		return RUN_FRAME_ALL_CALLBACKS;
+	}
+
+	if (TI83->ReadCallback || TI83->WriteCallback || TI83->ExecuteCallback || TI83->MemoryLogKinds || TI83->NumBreakpoints) {
+		return RUN_FRAME_MEMORY_CALLBACKS;
+	}
+
+	return TI83->FastMode ? RUN_FRAME_FAST : RUN_FRAME_NO_CALLBACKS;
+}
+
+#ifdef THREADED_DISPATCH
+// label addresses and computed gotos are GNU extensions
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+// inside RunFrame, PC, SP, WZ, and R (as a fetch counter, see ADVANCE_R) live in locals, which the compiler can keep in host registers
+// through TI83 they would be reloaded after every ReadMem/WriteMem call and the like, as those could alias them
+// they are only synced with TI83 around port I/O, callbacks, events, the helpers above, and the JIT
+// the 8-bit register pairs and lazy flags stay in TI83, as locals they ended up slower
+// (their halves get merged into a host register or spilled to the stack anyways)
+
+#if !defined(EMU83_NO_REGISTER_CACHE)
+	#define CACHE_REGISTERS
+#endif
+
+#ifdef CACHE_REGISTERS
+	#undef REGS_PC
+	#undef REGS_SP
+	#undef REGS_PCH
+	#undef REGS_PCL
+	#undef REGS_SPH
+	#undef REGS_SPL
+	#undef REGS_WZ
+	#undef REGS_W
+	#undef REGS_Z
+	#undef REGS_R
+	#undef SPILL_REGS
+	#undef RELOAD_REGS
+	#undef ADVANCE_R
+	#undef GET_R
+	#undef SET_R
+
+	#define REGS_PC pc.Full
+	#define REGS_SP sp.Full
+
+	#define REGS_PCH pc.High
+	#define REGS_PCL pc.Low
+	#define REGS_SPH sp.High
+	#define REGS_SPL sp.Low
+
+	#define REGS_WZ wz.Full
+
+	#define REGS_W wz.High
+	#define REGS_Z wz.Low
+
+	// refresh is a plain counter, bit 7 of R only changes with ld r,a so it stays in TI83->R
+	#define ADVANCE_R(N) do { refresh += (N); } while (0)
+	#define GET_R() ((TI83->R & 0x80) | (refresh & 0x7F))
+	#define SET_R(VAL) do { TI83->R = refresh = VAL; } while (0)
+
+	#define SPILL_REGS() do { \
+		TI83->PC = pc.Full; \
+		TI83->SP = sp.Full; \
+		TI83->WZ = wz.Full; \
+		TI83->R = GET_R(); \
+	} while (0)
+
+	#define RELOAD_REGS() do { \
+		pc.Full = TI83->PC; \
+		sp.Full = TI83->SP; \
+		wz.Full = TI83->WZ; \
+		refresh = TI83->R; \
+	} while (0)
+#endif
+
+#define RUN_FRAME_NAME RunFrameNoCallbacks
+#define RUN_FRAME_VARIANT RUN_FRAME_NO_CALLBACKS
+#include "runframe.h"
+
+#define RUN_FRAME_NAME RunFrameMemoryCallbacks
+#define RUN_FRAME_VARIANT RUN_FRAME_MEMORY_CALLBACKS
+#include "runframe.h"
+
+#define RUN_FRAME_NAME RunFrameAllCallbacks
+#define RUN_FRAME_VARIANT RUN_FRAME_ALL_CALLBACKS
+#include "runframe.h"
+
+// fast mode drops the upkeep of state only undocumented behavior can observe, for bulk runs which don't care about it
+// WZ lives in a local which is never synced back to TI83, so nothing is left to read the updates and they compile out
+// bit and the block instructions leave XF and YF as the flag LUTs have them, and the explicit copies compile out
+// R isn't counted on every fetch, reads make up its low 7 bits from the cycle count instead
+// this is the last variant, so the redefinitions don't leak into the others
+
+#undef REGS_WZ
+#undef REGS_W
+#undef REGS_Z
+#undef XF_CHECK
+#undef YF_CHECK
+#undef XY_FLAGS
+#undef BLOCK_XY_CHECK
+#undef ADVANCE_R
+#undef GET_R
+#undef SET_R
+#undef SPILL_REGS
+#undef RELOAD_REGS
+
+#define REGS_WZ wz.Full
+
+#define REGS_W wz.High
+#define REGS_Z wz.Low
+
+#define XF_CHECK(N) do { (void)(N); } while (0)
+#define YF_CHECK(N) do { (void)(N); } while (0)
+#define XY_FLAGS(N) 0
+#define BLOCK_XY_CHECK(N) do { (void)(N); } while (0)
+
+#define ADVANCE_R(N) do { } while (0)
+#define GET_R() ((TI83->R & 0x80) | ((u8)(CYCLE_COUNT() >> 2) & 0x7F))
+#define SET_R(VAL) do { TI83->R = VAL; } while (0)
+
+#ifdef CACHE_REGISTERS
+	#define SPILL_REGS() do { \
+		TI83->PC = pc.Full; \
+		TI83->SP = sp.Full; \
+		TI83->R = GET_R(); \
+	} while (0)
+
+	#define RELOAD_REGS() do { \
+		pc.Full = TI83->PC; \
+		sp.Full = TI83->SP; \
+		wz.Full = TI83->WZ; \
+	} while (0)
+#else
+	#define SPILL_REGS() do { TI83->R = GET_R(); } while (0)
+	#define RELOAD_REGS() do { wz.Full = TI83->WZ; } while (0)
+#endif
+
+#define FAST_MODE
+#define RUN_FRAME_NAME RunFrameFast
+#define RUN_FRAME_VARIANT RUN_FRAME_FAST
+#include "runframe.h"
+
+#ifdef THREADED_DISPATCH
+#pragma GCC diagnostic pop
+#endif
+
+void RunFrame(TI83_t* TI83) {
+	static bool (*const RunFrameVariants[])(TI83_t* TI83, u64 nextFrameCycleCount) = {
+		[RUN_FRAME_FAST] = RunFrameFast,
+		[RUN_FRAME_NO_CALLBACKS] = RunFrameNoCallbacks,
+		[RUN_FRAME_MEMORY_CALLBACKS] = RunFrameMemoryCallbacks,
+		[RUN_FRAME_ALL_CALLBACKS] = RunFrameAllCallbacks,
+		[RUN_FRAME_REFERENCE] = RunFrameReference,
+	};
+
+	u64 nextFrameCycleCount = TI83->CycleCount + 100000 - (TI83->CycleCount % 100000);
+	ScheduleEvent(TI83, END_FRAME, nextFrameCycleCount);
+	TI83->IdleLoop.End = 0; // input may have changed
+	TI83->InFrame = true;
+	TI83->BreakpointHit = false;
+	while (!RunFrameVariants[SelectRunFrameVariant(TI83)](TI83, nextFrameCycleCount) && !TI83->BreakpointHit) {
+	}
+	TI83->InFrame = false;
+	FlushMemoryLog(TI83);
+}
+
+// callbacks can be set from within other callbacks, which a running variant might not test for
+// bringing the next event forward stops it at the next instruction, after which RunFrame switches variants
+// the flag keeps it there even if other events are scheduled before then, and is cleared by the variant
+void CallbacksChanged(TI83_t* TI83) {
+	if (TI83->InFrame) {
+		TI83->CallbacksChanged = true;
+		TI83->NextEventTime = EVENT_TIME_NOW;
+	}
 }
@@ -28,5 +28,10 @@ SOFTWARE.
 #include "ti83.h"
 
 void RunFrame(TI83_t* TI83);
+void CallbacksChanged(TI83_t* TI83);
+u8 MaterializeFlags(TI83_t* TI83);
+
+// the reference core (z80ref.c), returns false if it stopped early for a breakpoint
+bool RunFrameReference(TI83_t* TI83, u64 nextFrameCycleCount);
 
 #endif